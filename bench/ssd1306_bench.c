@@ -0,0 +1,545 @@
+/**
+ * @file   ssd1306_bench.c
+ * @brief  SSD1306 OLED display C library.
+ *
+ * @copyright
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  any later version.
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ *  GNU General Public License for more details.
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program. If not, see <http://www.gnu.org/licenses/>.
+ *
+ * @author Giovanni Scotti
+ */
+
+
+///////////////////////////////////////////////////////////
+// SSD1306 OLED display C library MICROBENCHMARKS!
+//
+// Links the driver against a mock port layer which only counts
+// transactions and bytes, then measures every drawing primitive
+// and the flush path with representative workloads.
+//
+// On a host machine:
+//   gcc -O2 -std=c99 -Ilib/inc lib/src/*.c bench/ssd1306_bench.c -o bench
+//   ./bench
+//
+// On a Cortex-M3/M4/M7 target, compile this file together with the
+// library, define BENCH_NO_MAIN and call ssd1306_bench_run from the
+// firmware: times are then measured in cpu cycles by the DWT unit.
+// Results are printed by means of printf, which must be retargeted.
+//
+// Define BENCH_MAX_TRANSFER to emulate a port with a limited
+// transaction size (e.g. 32 for the Arduino Wire library).
+
+
+#include <stdio.h>
+#include "ssd1306_driver.h"
+#include "ssd1306_field.h"
+
+
+#ifndef BENCH_MAX_TRANSFER
+#define BENCH_MAX_TRANSFER 0 /// Max bytes per transaction, 0 if unlimited.
+#endif
+
+#define BENCH_I2C_CHANNEL 0
+#define BENCH_I2C_ADDR    0x78
+
+
+///////////////////////////////////////////////////////////
+// TIMER
+///////////////////////////////////////////////////////////
+
+#if defined(__ARM_ARCH_7M__) || defined(__ARM_ARCH_7EM__)
+
+// Cortex-M cycle counter, accessed without CMSIS headers.
+#define BENCH_DEMCR      (*(volatile uint32_t *)0xE000EDFC)
+#define BENCH_DWT_CTRL   (*(volatile uint32_t *)0xE0001000)
+#define BENCH_DWT_CYCCNT (*(volatile uint32_t *)0xE0001004)
+#define BENCH_TIME_UNIT  "cycles"
+
+static void
+bench_timer_init(void) {
+    BENCH_DEMCR     |= 1UL << 24; // Enables trace and debug blocks.
+    BENCH_DWT_CYCCNT = 0;
+    BENCH_DWT_CTRL  |= 1UL;       // Enables the cycle counter.
+}
+
+static inline uint64_t
+bench_timer_now(void) {
+    return BENCH_DWT_CYCCNT;
+}
+
+#elif defined(__x86_64__) || defined(__i386__)
+
+// Time stamp counter of x86 processors.
+#include <x86intrin.h>
+#define BENCH_TIME_UNIT  "tsc ticks"
+
+static void
+bench_timer_init(void) {}
+
+static inline uint64_t
+bench_timer_now(void) {
+    return __rdtsc();
+}
+
+#else
+
+// Any other POSIX host.
+#include <time.h>
+#define BENCH_TIME_UNIT  "ns"
+
+static void
+bench_timer_init(void) {}
+
+static inline uint64_t
+bench_timer_now(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint64_t)ts.tv_sec * 1000000000ULL + ts.tv_nsec;
+}
+
+#endif
+
+
+///////////////////////////////////////////////////////////
+// MOCK PORT LAYER
+///////////////////////////////////////////////////////////
+
+static uint32_t bench_transactions; /// Transactions issued by the driver.
+static uint32_t bench_bytes;        /// Bytes that would go on the wire.
+
+
+ssd1306_status_t
+ssd1306_i2c_init(uint8_t channel) {
+    (void)channel;
+    return SSD1306_OK;
+}
+
+
+size_t
+ssd1306_i2c_max_transfer_size(uint8_t channel) {
+    (void)channel;
+    return BENCH_MAX_TRANSFER;
+}
+
+
+ssd1306_status_t
+ssd1306_i2c_write_v(uint8_t channel, uint8_t addr,
+        const uint8_t *header_ptr, size_t header_size,
+        const uint8_t *data_ptr, size_t data_size) {
+    (void)channel; (void)addr; (void)header_ptr; (void)data_ptr;
+
+    bench_transactions++;
+    bench_bytes += 1 + header_size + data_size;
+    return SSD1306_OK;
+}
+
+
+#ifdef SSD1306_ENABLE_LOCKING
+
+// The benchmark is single threaded: the bus needs no lock.
+void
+ssd1306_i2c_lock(uint8_t channel) {
+    (void)channel;
+}
+
+
+void
+ssd1306_i2c_unlock(uint8_t channel) {
+    (void)channel;
+}
+
+#endif
+
+
+#ifdef SSD1306_ENABLE_ASYNC
+
+static void *bench_async_ctx; /// Context of the pending transaction.
+
+
+ssd1306_status_t
+ssd1306_i2c_write_async(uint8_t channel, uint8_t addr,
+        const uint8_t *header_ptr, size_t header_size,
+        const uint8_t *data_ptr, size_t data_size, void *ctx) {
+    (void)channel; (void)addr; (void)header_ptr; (void)data_ptr;
+
+    bench_transactions++;
+    bench_bytes += 1 + header_size + data_size;
+    bench_async_ctx = ctx;
+    return SSD1306_OK;
+}
+
+
+/**
+ * Completes the pending transactions, as the i2c interrupt would do.
+ */
+static void
+bench_async_pump(void) {
+    while (bench_async_ctx != NULL) {
+        void *ctx = bench_async_ctx;
+        bench_async_ctx = NULL;
+        ssd1306_i2c_write_async_complete(ctx, SSD1306_OK);
+    }
+}
+
+#endif
+
+
+#ifdef SSD1306_ENABLE_SPI
+
+ssd1306_status_t
+ssd1306_spi_init(uint8_t channel) {
+    (void)channel;
+    return SSD1306_OK;
+}
+
+
+ssd1306_status_t
+ssd1306_spi_write(uint8_t channel, bool data,
+        const uint8_t *data_ptr, size_t data_size) {
+    (void)channel; (void)data; (void)data_ptr;
+
+    // No address nor control bytes go on the wire.
+    bench_transactions++;
+    bench_bytes += data_size;
+    return SSD1306_OK;
+}
+
+
+#ifdef SSD1306_ENABLE_ASYNC
+
+ssd1306_status_t
+ssd1306_spi_write_async(uint8_t channel, bool data,
+        const uint8_t *data_ptr, size_t data_size, void *ctx) {
+    (void)channel; (void)data; (void)data_ptr;
+
+    bench_transactions++;
+    bench_bytes += data_size;
+    bench_async_ctx = ctx;
+    return SSD1306_OK;
+}
+
+#endif
+
+#endif
+
+
+///////////////////////////////////////////////////////////
+// WORKLOADS
+///////////////////////////////////////////////////////////
+
+static ssd1306_t bench_display;
+
+/// 16x16 icon, row-major and MSB first as expected by ssd1306_draw_bitmap.
+static const unsigned char bench_icon[] = {
+    0x07, 0xE0, 0x18, 0x18, 0x20, 0x04, 0x40, 0x02,
+    0x4C, 0x32, 0x8C, 0x31, 0x80, 0x01, 0x80, 0x01,
+    0x80, 0x01, 0x88, 0x11, 0x44, 0x22, 0x43, 0xC2,
+    0x20, 0x04, 0x18, 0x18, 0x07, 0xE0, 0x00, 0x00
+};
+
+/// Same icon, page-major as expected by ssd1306_draw_page_bitmap.
+static const uint8_t bench_icon_pages[] = {
+    0xE0, 0x18, 0x04, 0x02, 0x32, 0x31, 0x01, 0x01,
+    0x01, 0x01, 0x31, 0x32, 0x02, 0x04, 0x18, 0xE0,
+    0x03, 0x0C, 0x10, 0x20, 0x22, 0x44, 0x48, 0x48,
+    0x48, 0x48, 0x44, 0x22, 0x20, 0x10, 0x0C, 0x03
+};
+
+/// Same icon, run-length encoded as expected by ssd1306_draw_rle_bitmap.
+static const uint8_t bench_icon_rle[] = {
+    0x05, 0xE0, 0x18, 0x04, 0x02, 0x32, 0x31, 0x82,
+    0x01, 0x0B, 0x31, 0x32, 0x02, 0x04, 0x18, 0xE0,
+    0x03, 0x0C, 0x10, 0x20, 0x22, 0x44, 0x82, 0x48,
+    0x05, 0x44, 0x22, 0x20, 0x10, 0x0C, 0x03
+};
+
+
+static void
+bench_fill(ssd1306_t *ssd1306_ptr) {
+    ssd1306_draw_fill(ssd1306_ptr, SSD1306_COLOR_WHITE);
+}
+
+static void
+bench_pixels(ssd1306_t *ssd1306_ptr) {
+    for (uint8_t y = 0; y < SSD1306_PXL_HEIGHT; y++)
+        for (uint8_t x = 0; x < SSD1306_PXL_WIDTH; x++)
+            ssd1306_draw_pixel(ssd1306_ptr, x, y, (x ^ y) & 1);
+}
+
+static void
+bench_lines(ssd1306_t *ssd1306_ptr) {
+    for (uint8_t x = 0; x < SSD1306_PXL_WIDTH; x += 8)
+        ssd1306_draw_line(ssd1306_ptr, x, 0, SSD1306_PXL_WIDTH - 1 - x,
+                SSD1306_PXL_HEIGHT - 1, SSD1306_COLOR_WHITE);
+}
+
+static void
+bench_hlines(ssd1306_t *ssd1306_ptr) {
+    for (uint8_t y = 0; y < SSD1306_PXL_HEIGHT; y++)
+        ssd1306_draw_hline(ssd1306_ptr, 0, y, SSD1306_PXL_WIDTH,
+                SSD1306_COLOR_WHITE);
+}
+
+static void
+bench_vlines(ssd1306_t *ssd1306_ptr) {
+    for (uint8_t x = 0; x < SSD1306_PXL_WIDTH; x++)
+        ssd1306_draw_vline(ssd1306_ptr, x, x & 7, SSD1306_PXL_HEIGHT - 8,
+                SSD1306_COLOR_WHITE);
+}
+
+static void
+bench_rects(ssd1306_t *ssd1306_ptr) {
+    for (uint8_t i = 0; i < 16; i++)
+        ssd1306_draw_rect(ssd1306_ptr, i * 2, i, 100 - i * 4, 60 - i * 2,
+                SSD1306_COLOR_WHITE);
+}
+
+static void
+bench_filled_rects(ssd1306_t *ssd1306_ptr) {
+    // Bar graph: 16 bars of growing height.
+    for (uint8_t i = 0; i < 16; i++)
+        ssd1306_draw_filled_rect(ssd1306_ptr, i * 8, 63 - i * 4, 6, i * 4,
+                SSD1306_COLOR_WHITE);
+}
+
+static void
+bench_circles(ssd1306_t *ssd1306_ptr) {
+    for (uint8_t r = 2; r < 32; r += 3)
+        ssd1306_draw_circle(ssd1306_ptr, 64, 32, r, SSD1306_COLOR_WHITE);
+}
+
+static void
+bench_filled_circles(ssd1306_t *ssd1306_ptr) {
+    ssd1306_draw_filled_circle(ssd1306_ptr, 32, 32, 30, SSD1306_COLOR_WHITE);
+    ssd1306_draw_filled_circle(ssd1306_ptr, 96, 32, 8, SSD1306_COLOR_WHITE);
+}
+
+static void
+bench_triangles(ssd1306_t *ssd1306_ptr) {
+    ssd1306_draw_triangle(ssd1306_ptr, 0, 63, 64, 0, 127, 63,
+            SSD1306_COLOR_WHITE);
+}
+
+static void
+bench_filled_triangles(ssd1306_t *ssd1306_ptr) {
+    // Gauge needle.
+    ssd1306_draw_filled_triangle(ssd1306_ptr, 60, 60, 68, 60, 100, 5,
+            SSD1306_COLOR_WHITE);
+    ssd1306_draw_filled_triangle(ssd1306_ptr, 0, 63, 64, 0, 127, 63,
+            SSD1306_COLOR_WHITE);
+}
+
+static void
+bench_bitmaps(ssd1306_t *ssd1306_ptr) {
+    for (uint8_t x = 0; x < SSD1306_PXL_WIDTH; x += 16)
+        ssd1306_draw_bitmap(ssd1306_ptr, x, x & 0x1F, bench_icon, 16, 16,
+                SSD1306_COLOR_WHITE);
+}
+
+static void
+bench_page_bitmaps(ssd1306_t *ssd1306_ptr) {
+    for (uint8_t x = 0; x < SSD1306_PXL_WIDTH; x += 16)
+        ssd1306_draw_page_bitmap(ssd1306_ptr, x, x & 0x1F, bench_icon_pages,
+                16, 16, SSD1306_COLOR_WHITE, SSD1306_TEXT_OPAQUE);
+}
+
+static void
+bench_rle_bitmaps(ssd1306_t *ssd1306_ptr) {
+    for (uint8_t x = 0; x < SSD1306_PXL_WIDTH; x += 16)
+        ssd1306_draw_rle_bitmap(ssd1306_ptr, x, x & 0x1F, bench_icon_rle,
+                sizeof(bench_icon_rle), 16, 16, SSD1306_COLOR_WHITE,
+                SSD1306_TEXT_OPAQUE);
+}
+
+static void
+bench_chars(ssd1306_t *ssd1306_ptr) {
+    ssd1306_goto_xy(ssd1306_ptr, 0, 3);
+    for (char c = 'A'; c < 'A' + 18; c++)
+        ssd1306_draw_char(ssd1306_ptr, c, FONT_7X10, SSD1306_COLOR_WHITE);
+}
+
+static void
+bench_strings(ssd1306_t *ssd1306_ptr) {
+    // A text-heavy dashboard: six lines of label and value.
+    for (uint8_t line = 0; line < 6; line++) {
+        ssd1306_goto_xy(ssd1306_ptr, 0, line * 10);
+        ssd1306_draw_str(ssd1306_ptr, "Speed: 123 rpm", 14, FONT_7X10,
+                SSD1306_COLOR_WHITE);
+    }
+}
+
+static void
+bench_ints(ssd1306_t *ssd1306_ptr) {
+    for (uint8_t line = 0; line < 6; line++) {
+        ssd1306_goto_xy(ssd1306_ptr, 64, line * 10);
+        ssd1306_draw_int(ssd1306_ptr, -12345 * line, 10, FONT_7X10,
+                SSD1306_COLOR_WHITE);
+    }
+}
+
+#define BENCH_FIELD_PITCH 43 /// Columns between fields, 6 chars of FONT_7X10.
+#define BENCH_FIELD_COLS  ((SSD1306_PXL_WIDTH + 1) / BENCH_FIELD_PITCH)
+#define BENCH_FIELD_ROWS  (SSD1306_PXL_HEIGHT / 10)
+#define BENCH_FIELDS      (BENCH_FIELD_COLS * BENCH_FIELD_ROWS)
+
+// Fields redraw their cells within the whole software buffer.
+#if !defined(SSD1306_ENABLE_PAGE_MODE) && BENCH_FIELDS != 0
+static void
+bench_fields(ssd1306_t *ssd1306_ptr) {
+    // A telemetry page: as many readouts as the panel holds (eighteen on a
+    // 128x64 one) drawn, then each one ticking once.
+    ssd1306_field_t fields[BENCH_FIELDS];
+    uint8_t count = 0;
+    for (uint8_t i = 0; i < BENCH_FIELDS; i++) {
+        if (ssd1306_field_init(&fields[count], ssd1306_ptr,
+                (i % BENCH_FIELD_COLS) * BENCH_FIELD_PITCH,
+                (i / BENCH_FIELD_COLS) * 10,
+                6, FONT_7X10, SSD1306_COLOR_WHITE) != SSD1306_OK)
+            continue;
+        ssd1306_field_set_format(&fields[count], 1, SSD1306_FIELD_ALIGN_RIGHT);
+        ssd1306_field_set_int(&fields[count], -1234 + 617 * i);
+        count++;
+    }
+    for (uint8_t i = 0; i < count; i++)
+        ssd1306_field_set_int(&fields[i], -1233 + 617 * i);
+}
+#endif
+
+static void
+bench_update(ssd1306_t *ssd1306_ptr) {
+    ssd1306_update(ssd1306_ptr);
+}
+
+static void
+bench_update_dirty(ssd1306_t *ssd1306_ptr) {
+    // A single digit changes.
+    ssd1306_goto_xy(ssd1306_ptr, 60, 20);
+    ssd1306_draw_char(ssd1306_ptr, '7', FONT_7X10, SSD1306_COLOR_WHITE);
+    ssd1306_update_dirty(ssd1306_ptr);
+}
+
+static ssd1306_status_t
+bench_producer(uint8_t *dst, size_t offset, size_t size, void *ctx) {
+    (void)ctx;
+    // A generated checkerboard, as a video decoder would produce frames.
+    for (size_t i = 0; i < size; i++)
+        dst[i] = ((offset + i) & 0x8) ? 0x0F : 0xF0;
+    return SSD1306_OK;
+}
+
+static void
+bench_stream(ssd1306_t *ssd1306_ptr) {
+    ssd1306_stream(ssd1306_ptr, bench_producer, NULL);
+}
+
+#ifdef SSD1306_ENABLE_ASYNC
+static void
+bench_update_async(ssd1306_t *ssd1306_ptr) {
+    ssd1306_update_async(ssd1306_ptr, NULL, NULL);
+    bench_async_pump();
+}
+#endif
+
+
+/**
+ * Benchmark descriptor.
+ */
+typedef struct {
+    const char *name;                 /*!< Name of the benchmark. */
+    void (*run)(ssd1306_t *);         /*!< Workload. */
+    uint16_t   iterations;            /*!< Number of measured runs. */
+} bench_t;
+
+
+static const bench_t bench_list[] = {
+    {"draw_fill",            bench_fill,             100},
+    {"draw_pixel x8192",     bench_pixels,            20},
+    {"draw_line x16",        bench_lines,            100},
+    {"draw_hline x64",       bench_hlines,           100},
+    {"draw_vline x128",      bench_vlines,           100},
+    {"draw_rect x16",        bench_rects,            100},
+    {"draw_filled_rect x16", bench_filled_rects,     100},
+    {"draw_circle x10",      bench_circles,          100},
+    {"draw_filled_circle x2", bench_filled_circles,  100},
+    {"draw_triangle",        bench_triangles,        100},
+    {"draw_filled_triangle x2", bench_filled_triangles, 100},
+    {"draw_bitmap 16x16 x8", bench_bitmaps,          100},
+    {"draw_page_bitmap x8",  bench_page_bitmaps,     100},
+    {"draw_rle_bitmap x8",   bench_rle_bitmaps,      100},
+    {"draw_char x18",        bench_chars,            100},
+    {"draw_str 14ch x6",     bench_strings,          100},
+    {"draw_int x6",          bench_ints,             100},
+#if !defined(SSD1306_ENABLE_PAGE_MODE) && BENCH_FIELDS != 0
+    {"field_set_int x36",    bench_fields,           100},
+#endif
+    {"update",               bench_update,           100},
+    {"update_dirty 1 char",  bench_update_dirty,     100},
+    {"stream (producer)",    bench_stream,           100},
+#ifdef SSD1306_ENABLE_ASYNC
+    {"update_async",         bench_update_async,     100},
+#endif
+};
+
+
+/**
+ * Runs all the benchmarks and prints, for each one, the average time,
+ * bytes and transactions per iteration.
+ *
+ * @return 0 on success, 1 if the display could not be initialized.
+ */
+int
+ssd1306_bench_run(void) {
+
+    bench_timer_init();
+
+    if (ssd1306_init(&bench_display, BENCH_I2C_CHANNEL, BENCH_I2C_ADDR)
+            != SSD1306_OK)
+        return 1;
+
+    printf("%-26s %14s %10s %8s\n", "benchmark", BENCH_TIME_UNIT "/iter",
+            "bytes", "txns");
+
+    for (size_t b = 0; b < sizeof(bench_list) / sizeof(bench_list[0]); b++) {
+        const bench_t *bench = &bench_list[b];
+        uint64_t ticks = 0;
+        uint32_t bytes = 0, transactions = 0;
+
+        for (uint16_t i = 0; i < bench->iterations; i++) {
+            // Each iteration starts from a clean, synchronized display.
+            ssd1306_clear_buffer(&bench_display);
+            ssd1306_update(&bench_display);
+            bench_bytes = 0;
+            bench_transactions = 0;
+
+            uint64_t start = bench_timer_now();
+            bench->run(&bench_display);
+            ticks += bench_timer_now() - start;
+
+            bytes += bench_bytes;
+            transactions += bench_transactions;
+        }
+
+        printf("%-26s %14lu %10lu %8lu\n", bench->name,
+                (unsigned long)(ticks / bench->iterations),
+                (unsigned long)(bytes / bench->iterations),
+                (unsigned long)(transactions / bench->iterations));
+    }
+
+    return 0;
+}
+
+
+#ifndef BENCH_NO_MAIN
+int
+main(void) {
+    return ssd1306_bench_run();
+}
+#endif
@@ -29,42 +29,76 @@
 #include <arduino.h>
 #include <Wire.h>
 
-void i2c_write_arduino(uint8_t addr, const uint8_t *data_ptr, size_t data_size) {
+// WARNING: the Wire library has a maximum buffer size of 32 bytes.
+// It means that the user cannot write more than 32 bytes in a row.
+// The driver is told about this limit and splits longer writes.
+#ifdef BUFFER_LENGTH
+#define I2C_MAX_TRANSFER_SIZE BUFFER_LENGTH
+#else
+#define I2C_MAX_TRANSFER_SIZE 32
+#endif
 
-    int32_t proc_bytes = 1;
+static bool i2c_initialized = false;
 
-    while(proc_bytes < data_size){
-        uint8_t chunk_size =
-            ((data_size - proc_bytes) > 31) ? 31 : data_size - proc_bytes;
 
-        // WARNING: the Wire library has a maximum buffer size of 32 bytes.
-        // It means that the user cannot write more than 32 bytes in a row.
-        Wire.begin();
-        Wire.beginTransmission(addr);
-        // We need to transmit the command/data specifier before
-        // sending a sequence of bytes.
-        Wire.write(data_ptr[0]);
-        Wire.write(data_ptr + proc_bytes, chunk_size);
-        Wire.endTransmission();
+void i2c_init_arduino() {
 
-        proc_bytes += chunk_size;
-    }
+    // The bus is set up only once, even if several displays share it.
+    if (i2c_initialized) return;
+
+    Wire.begin();
+    i2c_initialized = true;
+}
+
+
+bool i2c_write_v_arduino(uint8_t addr, const uint8_t *header_ptr,
+        size_t header_size, const uint8_t *data_ptr, size_t data_size) {
+
+    // The driver guarantees that header and data fit the Wire buffer.
+    Wire.beginTransmission(addr);
+    Wire.write(header_ptr, header_size);
+    Wire.write(data_ptr, data_size);
+    return Wire.endTransmission() == 0;
 }
 
 
 extern "C" {
 
 ///////////////////////////////////////////////////////////
-// The following function must be implemented as C code
-// otherwise it cannot be called by the library code.
-// i2c_write_arduino is a C++ function that is able to
+// The following functions must be implemented as C code
+// otherwise they cannot be called by the library code.
+// i2c_*_arduino are C++ functions that are able to
 // use the Wire library from Arduino to manage the i2c
 // peripheral.
 
 #include "ssd1306_driver.h"
 
 ssd1306_status_t
-ssd1306_i2c_write(uint8_t channel, uint8_t addr,
+ssd1306_i2c_init(uint8_t channel) {
+
+    switch (channel) {
+        case 0:
+            i2c_init_arduino();
+            break;
+        default:
+            return SSD1306_WRONG_PARAMS;
+    }
+
+    return SSD1306_OK;
+}
+
+
+size_t
+ssd1306_i2c_max_transfer_size(uint8_t channel) {
+
+    (void)channel;
+    return I2C_MAX_TRANSFER_SIZE;
+}
+
+
+ssd1306_status_t
+ssd1306_i2c_write_v(uint8_t channel, uint8_t addr,
+        const uint8_t *header_ptr, size_t header_size,
         const uint8_t *data_ptr, size_t data_size) {
 
     // Platform-dependent i2c write function implementation.
@@ -72,12 +106,10 @@ ssd1306_i2c_write(uint8_t channel, uint8_t addr,
     // i2c peripheral. The address allows to reach the desired slave.
     switch (channel) {
         case 0:
-            i2c_write_arduino(addr, data_ptr, data_size);
+            if (!i2c_write_v_arduino(addr, header_ptr, header_size,
+                    data_ptr, data_size))
+                return SSD1306_COMM_ERROR;
             break;
-        //case 1:
-            // Some other i2c peripheral hooked to another display.
-            //break;
-        // ...
         default:
             return SSD1306_WRONG_PARAMS;
     }
@@ -85,4 +117,5 @@ ssd1306_i2c_write(uint8_t channel, uint8_t addr,
     return SSD1306_OK;
 }
 
+
 } // End of extern "C".
\ No newline at end of file
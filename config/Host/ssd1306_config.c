@@ -0,0 +1,706 @@
+/**
+ * @file   ssd1306_config.c
+ * @brief  SSD1306 OLED display C library.
+ *
+ * @copyright
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  any later version.
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ *  GNU General Public License for more details.
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program. If not, see <http://www.gnu.org/licenses/>.
+ *
+ * @author Giovanni Scotti
+ */
+
+/* C++ detection */
+#ifdef __cplusplus
+    extern "C" {
+#endif
+
+///////////////////////////////////////////////////////////
+// SSD1306 OLED display C library CONFIGURATION FILE!
+//
+// This file is supposed to be modified by the user to port
+// the code on (possibly) any microcontroller.
+// The following is a virtual display for host machines: the i2c
+// stream is decoded by a software model of the controller, so that
+// the whole driver can be run, profiled and checked on a PC.
+
+
+#include <stdio.h>
+#include <string.h>
+#include "ssd1306_host.h"
+
+#ifdef SSD1306_ENABLE_SPI
+#include "ssd1306_spi.h"
+#endif
+
+#ifdef SSD1306_ENABLE_LOCKING
+#include <pthread.h> // Link with -pthread.
+#endif
+
+
+// Control byte fields.
+#define HOST_CONTROL_CO 0x80 /// Continuation bit: a single byte follows.
+#define HOST_CONTROL_DC 0x40 /// Data/command selection bit.
+
+
+static ssd1306_host_display_t host_displays[SSD1306_HOST_NUM_CHANNELS];
+
+
+#ifdef SSD1306_ENABLE_ASYNC
+static void *host_async_ctx[SSD1306_HOST_NUM_CHANNELS];
+static ssd1306_status_t host_async_status[SSD1306_HOST_NUM_CHANNELS];
+static bool host_async_spi[SSD1306_HOST_NUM_CHANNELS]; // Completed as spi transfers.
+#endif
+
+#ifdef SSD1306_ENABLE_LOCKING
+static pthread_once_t  host_locks_once = PTHREAD_ONCE_INIT;
+static pthread_mutex_t host_locks[SSD1306_HOST_NUM_CHANNELS];
+#endif
+
+
+///////////////////////////////////////////////////////////
+// CONTROLLER MODEL
+///////////////////////////////////////////////////////////
+
+/**
+ * Returns the length of a command, arguments included.
+ *
+ * @param  cmd the first byte of the command.
+ * @return the number of bytes of the command.
+ */
+static uint8_t
+host_cmd_length(uint8_t cmd) {
+
+    switch (cmd) {
+        case 0x21: case 0x22:           // Column and page address.
+        case 0xA3:                      // Vertical scroll area.
+            return 3;
+        case 0x26: case 0x27:           // Horizontal scroll setup.
+            return 7;
+        case 0x29: case 0x2A:           // Vertical and horizontal scroll.
+            return 6;
+        case 0x20: case 0x81: case 0x8D: case 0xA8: case 0xD3:
+        case 0xD5: case 0xD9: case 0xDA: case 0xDB:
+            return 2;
+        default:
+            return 1;
+    }
+}
+
+
+/**
+ * Executes a complete command.
+ *
+ * @param  disp the emulated display.
+ */
+static void
+host_cmd_execute(ssd1306_host_display_t *disp) {
+
+    const uint8_t *cmd = disp->cmd;
+
+    if (cmd[0] <= 0x0F) {
+        // Lower column start address of page addressing mode.
+        disp->pam_col_start = (disp->pam_col_start & 0xF0) | cmd[0];
+        disp->col = disp->pam_col_start;
+        return;
+    }
+    if (cmd[0] <= 0x1F) {
+        // Higher column start address of page addressing mode.
+        disp->pam_col_start = (disp->pam_col_start & 0x0F) | ((cmd[0] & 0x07) << 4);
+        disp->col = disp->pam_col_start;
+        return;
+    }
+    if (cmd[0] >= 0x40 && cmd[0] <= 0x7F) {
+        disp->start_line = cmd[0] & 0x3F;
+        return;
+    }
+    if (cmd[0] >= 0xB0 && cmd[0] <= 0xB7) {
+        disp->page = cmd[0] & 0x07;
+        return;
+    }
+
+    switch (cmd[0]) {
+        case 0x20:
+            if ((cmd[1] & 0x03) == 0x03) disp->stats.errors++;
+            else disp->addr_mode = cmd[1] & 0x03;
+            break;
+        case 0x21:
+            disp->col_start = cmd[1] & 0x7F;
+            disp->col_end   = cmd[2] & 0x7F;
+            disp->col       = disp->col_start;
+            break;
+        case 0x22:
+            disp->page_start = cmd[1] & 0x07;
+            disp->page_end   = cmd[2] & 0x07;
+            disp->page       = disp->page_start;
+            break;
+        case 0x81: disp->contrast        = cmd[1];               break;
+        case 0x8D: disp->charge_pump     = (cmd[1] & 0x04) != 0; break;
+        case 0xA8:
+            if ((cmd[1] & 0x3F) < 15) disp->stats.errors++;
+            else disp->mux_ratio = cmd[1] & 0x3F;
+            break;
+        case 0xD3: disp->display_offset  = cmd[1] & 0x3F;        break;
+        case 0xDA: disp->com_pins        = cmd[1];               break;
+        case 0xA0: disp->seg_remap       = false;                break;
+        case 0xA1: disp->seg_remap       = true;                 break;
+        case 0xC0: disp->com_remap       = false;                break;
+        case 0xC8: disp->com_remap       = true;                 break;
+        case 0xA4: disp->entire_on       = false;                break;
+        case 0xA5: disp->entire_on       = true;                 break;
+        case 0xA6: disp->inverted        = false;                break;
+        case 0xA7: disp->inverted        = true;                 break;
+        case 0xAE: disp->display_on      = false;                break;
+        case 0xAF: disp->display_on      = true;                 break;
+        case 0x2E: disp->scrolling       = false;                break;
+        case 0x2F: disp->scrolling       = true;                 break;
+        case 0x26: case 0x27: case 0x29: case 0x2A: case 0xA3:
+        case 0xD5: case 0xD9: case 0xDB: case 0xE3:
+            // Scrolling setup, timings and nop: no effect on the model.
+            break;
+        default:
+            disp->stats.errors++;
+            break;
+    }
+}
+
+
+/**
+ * Feeds a command byte to the command decoder.
+ *
+ * @param  disp the emulated display.
+ * @param  byte the received byte.
+ */
+static void
+host_cmd_byte(ssd1306_host_display_t *disp, uint8_t byte) {
+
+    disp->stats.cmd_bytes++;
+    disp->cmd[disp->cmd_len++] = byte;
+
+    if (disp->cmd_len == host_cmd_length(disp->cmd[0])) {
+        host_cmd_execute(disp);
+        disp->cmd_len = 0;
+    }
+}
+
+
+/**
+ * Writes a data byte to the GDDRAM and advances the address pointers
+ * according to the current addressing mode.
+ *
+ * @param  disp the emulated display.
+ * @param  byte the received byte.
+ */
+static void
+host_data_byte(ssd1306_host_display_t *disp, uint8_t byte) {
+
+    disp->stats.data_bytes++;
+    disp->gddram[disp->page][disp->col] = byte;
+
+    switch (disp->addr_mode) {
+        case 0x00: // Horizontal addressing mode.
+            if (disp->col < disp->col_end) {
+                disp->col++;
+                break;
+            }
+            disp->col = disp->col_start;
+            disp->page = (disp->page < disp->page_end) ?
+                    disp->page + 1 : disp->page_start;
+            break;
+        case 0x01: // Vertical addressing mode.
+            if (disp->page < disp->page_end) {
+                disp->page++;
+                break;
+            }
+            disp->page = disp->page_start;
+            disp->col = (disp->col < disp->col_end) ?
+                    disp->col + 1 : disp->col_start;
+            break;
+        default:   // Page addressing mode.
+            disp->col = (disp->col < SSD1306_HOST_GDDRAM_WIDTH - 1) ?
+                    disp->col + 1 : disp->pam_col_start;
+            break;
+    }
+}
+
+
+/**
+ * Decodes the bytes of a transaction: a control byte selects whether the
+ * following bytes are commands or data. If its continuation bit is set,
+ * only one byte follows before the next control byte.
+ *
+ * @param  disp the emulated display.
+ * @param  data pointer to the transaction bytes.
+ * @param  size number of bytes.
+ * @param  expect_control true if the next byte is a control byte.
+ * @param  stream_bits    control bits of the stream, once started.
+ * @return true if the next byte is expected to be a control byte.
+ */
+static bool
+host_decode(ssd1306_host_display_t *disp, const uint8_t *data, size_t size,
+        bool expect_control, uint8_t *stream_bits) {
+
+    for (size_t i = 0; i < size; i++) {
+        if (expect_control) {
+            *stream_bits = data[i];
+            expect_control = false;
+            continue;
+        }
+
+        if (*stream_bits & HOST_CONTROL_DC) host_data_byte(disp, data[i]);
+        else host_cmd_byte(disp, data[i]);
+
+        // A single byte follows a control byte with the continuation bit.
+        if (*stream_bits & HOST_CONTROL_CO) expect_control = true;
+    }
+
+    return expect_control;
+}
+
+
+/**
+ * Receives a whole transaction made of a header and a payload.
+ *
+ * @param  channel     the i2c channel.
+ * @param  header_ptr  the first bytes of the transaction.
+ * @param  header_size number of header bytes.
+ * @param  data_ptr    the remaining bytes of the transaction.
+ * @param  data_size   number of payload bytes.
+ * @return the outcome of the function call.
+ */
+static ssd1306_status_t
+host_transaction(uint8_t channel,
+        const uint8_t *header_ptr, size_t header_size,
+        const uint8_t *data_ptr, size_t data_size) {
+
+    if (channel >= SSD1306_HOST_NUM_CHANNELS) return SSD1306_WRONG_PARAMS;
+
+    ssd1306_host_display_t *disp = &host_displays[channel];
+    size_t size = header_size + data_size;
+    uint8_t stream_bits = 0;
+
+    // Emulated bus failure: the transaction does not reach the display.
+    if (disp->fail_countdown != 0 && --disp->fail_countdown == 0)
+        return SSD1306_COMM_ERROR;
+
+    disp->stats.transactions++;
+    disp->stats.bytes += 1 + size; // Address byte included.
+
+    if (size == 0 || (disp->max_transfer != 0 && size > disp->max_transfer)) {
+        disp->stats.errors++;
+        return SSD1306_COMM_ERROR;
+    }
+
+    bool expect_control = host_decode(disp, header_ptr, header_size,
+            true, &stream_bits);
+    expect_control = host_decode(disp, data_ptr, data_size,
+            expect_control, &stream_bits);
+
+    // A control byte with the continuation bit must be followed by a byte.
+    if (!expect_control && (stream_bits & HOST_CONTROL_CO))
+        disp->stats.errors++;
+
+    return SSD1306_OK;
+}
+
+
+///////////////////////////////////////////////////////////
+// PORT FUNCTIONS
+///////////////////////////////////////////////////////////
+
+/**
+ * Initializes the emulated display of the given channel. Registers are
+ * set to their power-on values only the first time, as a warm restart
+ * of the microcontroller does not reset the display.
+ *
+ * @param  channel
+ * @return the outcome of the function call.
+ */
+ssd1306_status_t
+ssd1306_i2c_init(uint8_t channel) {
+
+    if (channel >= SSD1306_HOST_NUM_CHANNELS) return SSD1306_WRONG_PARAMS;
+
+    if (!host_displays[channel].powered) return ssd1306_host_reset(channel);
+    return SSD1306_OK;
+}
+
+
+/**
+ * Returns the maximum number of bytes of a single transaction,
+ * as set by ssd1306_host_set_max_transfer.
+ *
+ * @param  channel
+ * @return the maximum transaction size, 0 if unlimited.
+ */
+size_t
+ssd1306_i2c_max_transfer_size(uint8_t channel) {
+
+    if (channel >= SSD1306_HOST_NUM_CHANNELS) return 0;
+    return host_displays[channel].max_transfer;
+}
+
+
+/**
+ * Decodes the transaction made of the header followed by the data.
+ *
+ * @param  channel
+ * @param  addr
+ * @param  header_ptr
+ * @param  header_size
+ * @param  data_ptr
+ * @param  data_size
+ * @return the outcome of the function call.
+ */
+ssd1306_status_t
+ssd1306_i2c_write_v(uint8_t channel, uint8_t addr,
+        const uint8_t *header_ptr, size_t header_size,
+        const uint8_t *data_ptr, size_t data_size) {
+
+    (void)addr;
+    return host_transaction(channel, header_ptr, header_size,
+            data_ptr, data_size);
+}
+
+
+#ifdef SSD1306_ENABLE_ASYNC
+
+/**
+ * Decodes the transaction right away, while its completion is delivered
+ * later by ssd1306_host_poll, as an interrupt would do.
+ *
+ * @param  channel
+ * @param  addr
+ * @param  header_ptr
+ * @param  header_size
+ * @param  data_ptr
+ * @param  data_size
+ * @param  ctx
+ * @return the outcome of the function call.
+ */
+ssd1306_status_t
+ssd1306_i2c_write_async(uint8_t channel, uint8_t addr,
+        const uint8_t *header_ptr, size_t header_size,
+        const uint8_t *data_ptr, size_t data_size, void *ctx) {
+
+    (void)addr;
+
+    if (channel >= SSD1306_HOST_NUM_CHANNELS) return SSD1306_WRONG_PARAMS;
+    if (host_async_ctx[channel] != NULL) return SSD1306_BUSY;
+
+    host_async_status[channel] = host_transaction(channel,
+            header_ptr, header_size, data_ptr, data_size);
+    host_async_ctx[channel] = ctx;
+    host_async_spi[channel] = false;
+    return SSD1306_OK;
+}
+
+
+uint32_t
+ssd1306_host_poll(void) {
+
+    uint32_t completed = 0;
+
+    for (uint8_t ch = 0; ch < SSD1306_HOST_NUM_CHANNELS; ch++) {
+        void *ctx = host_async_ctx[ch];
+        if (ctx == NULL) continue;
+
+        // Cleared first: the completion may start the next transaction.
+        host_async_ctx[ch] = NULL;
+        completed++;
+#ifdef SSD1306_ENABLE_SPI
+        if (host_async_spi[ch]) {
+            ssd1306_spi_write_async_complete(ctx, host_async_status[ch]);
+            continue;
+        }
+#endif
+        ssd1306_i2c_write_async_complete(ctx, host_async_status[ch]);
+    }
+
+    return completed;
+}
+
+#endif
+
+
+#ifdef SSD1306_ENABLE_LOCKING
+
+/**
+ * Creates the mutexes of the channels, once.
+ */
+static void
+host_locks_init(void) {
+
+    for (uint8_t ch = 0; ch < SSD1306_HOST_NUM_CHANNELS; ch++)
+        pthread_mutex_init(&host_locks[ch], NULL);
+}
+
+
+/**
+ * Locks the mutex of the given channel, so that threads driving the
+ * emulated displays are serialized as on a shared bus.
+ *
+ * @param  channel
+ */
+void
+ssd1306_i2c_lock(uint8_t channel) {
+
+    pthread_once(&host_locks_once, host_locks_init);
+    if (channel < SSD1306_HOST_NUM_CHANNELS)
+        pthread_mutex_lock(&host_locks[channel]);
+}
+
+
+/**
+ * Unlocks the mutex of the given channel.
+ *
+ * @param  channel
+ */
+void
+ssd1306_i2c_unlock(uint8_t channel) {
+
+    if (channel < SSD1306_HOST_NUM_CHANNELS)
+        pthread_mutex_unlock(&host_locks[channel]);
+}
+
+#endif
+
+
+#ifdef SSD1306_ENABLE_SPI
+
+/**
+ * Receives an spi transfer: the D/C line tells whether the bytes are
+ * commands or data, no control byte is involved.
+ *
+ * @param  channel   the spi channel.
+ * @param  data      the level of the D/C line.
+ * @param  data_ptr  the transferred bytes.
+ * @param  data_size number of bytes.
+ * @return the outcome of the function call.
+ */
+static ssd1306_status_t
+host_spi_transfer(uint8_t channel, bool data,
+        const uint8_t *data_ptr, size_t data_size) {
+
+    if (channel >= SSD1306_HOST_NUM_CHANNELS) return SSD1306_WRONG_PARAMS;
+
+    ssd1306_host_display_t *disp = &host_displays[channel];
+
+    if (disp->fail_countdown != 0 && --disp->fail_countdown == 0)
+        return SSD1306_COMM_ERROR;
+
+    disp->stats.transactions++;
+    disp->stats.bytes += data_size;
+
+    for (size_t i = 0; i < data_size; i++) {
+        if (data) host_data_byte(disp, data_ptr[i]);
+        else host_cmd_byte(disp, data_ptr[i]);
+    }
+
+    return SSD1306_OK;
+}
+
+
+/**
+ * Initializes the emulated display of the given channel, as
+ * ssd1306_i2c_init does. The displays are shared by both buses.
+ *
+ * @param  channel
+ * @return the outcome of the function call.
+ */
+ssd1306_status_t
+ssd1306_spi_init(uint8_t channel) {
+
+    return ssd1306_i2c_init(channel);
+}
+
+
+/**
+ * Decodes the transfer by means of the controller model.
+ *
+ * @param  channel
+ * @param  data
+ * @param  data_ptr
+ * @param  data_size
+ * @return the outcome of the function call.
+ */
+ssd1306_status_t
+ssd1306_spi_write(uint8_t channel, bool data,
+        const uint8_t *data_ptr, size_t data_size) {
+
+    return host_spi_transfer(channel, data, data_ptr, data_size);
+}
+
+
+#ifdef SSD1306_ENABLE_ASYNC
+
+/**
+ * Decodes the transfer right away, while its completion is delivered
+ * later by ssd1306_host_poll.
+ *
+ * @param  channel
+ * @param  data
+ * @param  data_ptr
+ * @param  data_size
+ * @param  ctx
+ * @return the outcome of the function call.
+ */
+ssd1306_status_t
+ssd1306_spi_write_async(uint8_t channel, bool data,
+        const uint8_t *data_ptr, size_t data_size, void *ctx) {
+
+    if (channel >= SSD1306_HOST_NUM_CHANNELS) return SSD1306_WRONG_PARAMS;
+    if (host_async_ctx[channel] != NULL) return SSD1306_BUSY;
+
+    host_async_status[channel] = host_spi_transfer(channel, data,
+            data_ptr, data_size);
+    host_async_ctx[channel] = ctx;
+    host_async_spi[channel] = true;
+    return SSD1306_OK;
+}
+
+#endif
+
+#endif
+
+
+///////////////////////////////////////////////////////////
+// INSPECTION API
+///////////////////////////////////////////////////////////
+
+ssd1306_status_t
+ssd1306_host_reset(uint8_t channel) {
+
+    if (channel >= SSD1306_HOST_NUM_CHANNELS) return SSD1306_WRONG_PARAMS;
+
+    ssd1306_host_display_t *disp = &host_displays[channel];
+    size_t max_transfer = disp->max_transfer;
+
+    // Power-on values of the registers, as reported by the datasheet.
+    memset(disp, 0, sizeof(ssd1306_host_display_t));
+    disp->addr_mode    = 0x02;
+    disp->col_end      = SSD1306_HOST_GDDRAM_WIDTH - 1;
+    disp->page_end     = SSD1306_HOST_GDDRAM_PAGES - 1;
+    disp->mux_ratio    = 0x3F;
+    disp->contrast     = 0x7F;
+    disp->com_pins     = 0x12;
+    disp->max_transfer = max_transfer;
+    disp->powered      = true;
+
+#ifdef SSD1306_ENABLE_ASYNC
+    host_async_ctx[channel] = NULL;
+#endif
+
+    return SSD1306_OK;
+}
+
+
+ssd1306_host_display_t *
+ssd1306_host_get_display(uint8_t channel) {
+
+    if (channel >= SSD1306_HOST_NUM_CHANNELS) return NULL;
+    return &host_displays[channel];
+}
+
+
+ssd1306_status_t
+ssd1306_host_set_max_transfer(uint8_t channel, size_t max_transfer) {
+
+    if (channel >= SSD1306_HOST_NUM_CHANNELS) return SSD1306_WRONG_PARAMS;
+
+    host_displays[channel].max_transfer = max_transfer;
+    return SSD1306_OK;
+}
+
+
+ssd1306_status_t
+ssd1306_host_fail_after(uint8_t channel, uint32_t count) {
+
+    if (channel >= SSD1306_HOST_NUM_CHANNELS) return SSD1306_WRONG_PARAMS;
+
+    host_displays[channel].fail_countdown = count;
+    return SSD1306_OK;
+}
+
+
+bool
+ssd1306_host_get_pixel(uint8_t channel, uint8_t x, uint8_t y) {
+
+    if (channel >= SSD1306_HOST_NUM_CHANNELS ||
+            x >= SSD1306_PXL_WIDTH || y >= SSD1306_PXL_HEIGHT)
+        return false;
+
+    const ssd1306_host_display_t *disp = &host_displays[channel];
+    uint8_t rows = disp->mux_ratio + 1;
+
+    if (!disp->display_on) return false;
+
+    // Rows beyond the multiplex ratio are not driven.
+    uint8_t com = disp->com_remap ? y : SSD1306_PXL_HEIGHT - 1 - y;
+    if (com >= rows) return false;
+    if (disp->entire_on) return true;
+
+    uint8_t row = (com + disp->start_line + disp->display_offset) & 0x3F;
+    uint8_t col = disp->seg_remap ? SSD1306_COL_OFFSET + x :
+            SSD1306_HOST_GDDRAM_WIDTH - 1 - SSD1306_COL_OFFSET - x;
+    bool lit = (disp->gddram[row >> 3][col] >> (row & 7)) & 1;
+
+    return lit != disp->inverted;
+}
+
+
+ssd1306_status_t
+ssd1306_host_render(uint8_t channel, uint8_t *frame) {
+
+    if (channel >= SSD1306_HOST_NUM_CHANNELS || frame == NULL)
+        return SSD1306_WRONG_PARAMS;
+
+    memset(frame, 0, SSD1306_FRAME_SIZE);
+
+    for (uint8_t y = 0; y < SSD1306_PXL_HEIGHT; y++) {
+        for (uint8_t x = 0; x < SSD1306_PXL_WIDTH; x++) {
+            if (ssd1306_host_get_pixel(channel, x, y))
+                frame[x + (y / 8) * SSD1306_PXL_WIDTH] |= 1 << (y & 7);
+        }
+    }
+
+    return SSD1306_OK;
+}
+
+
+ssd1306_status_t
+ssd1306_host_dump_pbm(uint8_t channel, const char *path) {
+
+    if (channel >= SSD1306_HOST_NUM_CHANNELS || path == NULL)
+        return SSD1306_WRONG_PARAMS;
+
+    FILE *file = fopen(path, "wb");
+    if (file == NULL) return SSD1306_WRONG_PARAMS;
+
+    fprintf(file, "P4\n%d %d\n", SSD1306_PXL_WIDTH, SSD1306_PXL_HEIGHT);
+
+    // Rows are packed MSB first, 1 stands for a black pixel.
+    for (uint8_t y = 0; y < SSD1306_PXL_HEIGHT; y++) {
+        uint8_t row[(SSD1306_PXL_WIDTH + 7) / 8] = {0};
+        for (uint8_t x = 0; x < SSD1306_PXL_WIDTH; x++) {
+            if (!ssd1306_host_get_pixel(channel, x, y))
+                row[x / 8] |= 0x80 >> (x & 7);
+        }
+        fwrite(row, 1, sizeof(row), file);
+    }
+
+    return (fclose(file) == 0) ? SSD1306_OK : SSD1306_WRONG_PARAMS;
+}
+
+
+/* C++ detection */
+#ifdef __cplusplus
+    }
+#endif
@@ -0,0 +1,201 @@
+/**
+ * @file   ssd1306_host.h
+ * @brief  SSD1306 OLED display C library.
+ *
+ * @copyright
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  any later version.
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ *  GNU General Public License for more details.
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program. If not, see <http://www.gnu.org/licenses/>.
+ *
+ * @author Giovanni Scotti
+ */
+
+#ifndef __SSD1306_HOST_H__
+#define __SSD1306_HOST_H__
+
+/* C++ detection */
+#ifdef __cplusplus
+    extern "C" {
+#endif
+
+
+#include <stdint.h>  // for uint_t.
+#include <stdlib.h>  // for size_t.
+#include <stdbool.h> // for bool.
+#include "ssd1306_driver.h"
+
+
+#ifndef SSD1306_HOST_NUM_CHANNELS
+#define SSD1306_HOST_NUM_CHANNELS 4 /// Number of emulated i2c/spi channels.
+#endif
+
+#define SSD1306_HOST_GDDRAM_WIDTH 128 /// Columns of the controller ram.
+#define SSD1306_HOST_GDDRAM_PAGES 8   /// Pages of the controller ram.
+
+
+/**
+ * Traffic counters of an emulated display.
+ */
+typedef struct {
+    uint32_t transactions;  /*!< Number of i2c transactions or spi transfers. */
+    uint32_t bytes;         /*!< Bytes on the wire, address bytes included. */
+    uint32_t cmd_bytes;     /*!< Command bytes, arguments included. */
+    uint32_t data_bytes;    /*!< Bytes written to the GDDRAM. */
+    uint32_t errors;        /*!< Malformed or rejected transactions. */
+} ssd1306_host_stats_t;
+
+
+/**
+ * Software model of the SSD1306 controller hooked to an i2c (or spi) channel.
+ * Commands and data received through the port functions of the driver
+ * are decoded exactly as the controller would do.
+ */
+typedef struct {
+    uint8_t gddram[SSD1306_HOST_GDDRAM_PAGES][SSD1306_HOST_GDDRAM_WIDTH];
+                                  /*!< Graphic display data ram. */
+    uint8_t addr_mode;            /*!< Memory addressing mode (0x20 command). */
+    uint8_t col_start;            /*!< Column window start. */
+    uint8_t col_end;              /*!< Column window end. */
+    uint8_t page_start;           /*!< Page window start. */
+    uint8_t page_end;             /*!< Page window end. */
+    uint8_t col;                  /*!< Column address pointer. */
+    uint8_t page;                 /*!< Page address pointer. */
+    uint8_t pam_col_start;        /*!< Column start of page addressing mode. */
+    uint8_t start_line;           /*!< Display start line. */
+    uint8_t display_offset;       /*!< Vertical shift by COM. */
+    uint8_t mux_ratio;            /*!< Multiplex ratio (number of rows - 1). */
+    uint8_t contrast;             /*!< Contrast value. */
+    uint8_t com_pins;             /*!< COM pins hardware configuration. */
+    bool    seg_remap;            /*!< Column 127 is mapped to SEG0. */
+    bool    com_remap;            /*!< COM scan direction is remapped. */
+    bool    inverted;             /*!< Inverse display. */
+    bool    entire_on;            /*!< Entire display on, ram ignored. */
+    bool    display_on;           /*!< Display is on. */
+    bool    charge_pump;          /*!< Charge pump is enabled. */
+    bool    scrolling;            /*!< Scrolling is active. */
+    bool    powered;              /*!< Power-on values have been set. */
+    uint8_t cmd[7];               /*!< Command being received. */
+    uint8_t cmd_len;              /*!< Bytes of the command received so far. */
+    size_t  max_transfer;         /*!< Emulated port limit, 0 if unlimited. */
+    uint32_t fail_countdown;      /*!< Transactions before a failure, 0 = off. */
+    ssd1306_host_stats_t stats;   /*!< Traffic counters. */
+} ssd1306_host_display_t;
+
+
+/**
+ * Resets the emulated display of the given channel to its power-on
+ * state and clears its traffic counters. The GDDRAM content is cleared
+ * as well, although it is random on real hardware. Displays are reset
+ * automatically the first time their channel is initialized by the driver.
+ *
+ * @param  channel the i2c channel of the display.
+ * @return the outcome of the function call.
+ */
+ssd1306_status_t
+ssd1306_host_reset(uint8_t channel);
+
+
+/**
+ * Returns the emulated display of the given channel. It allows to
+ * inspect its ram and registers.
+ *
+ * @param  channel the i2c channel of the display.
+ * @return a pointer to the emulated display, NULL if the channel is invalid.
+ */
+ssd1306_host_display_t *
+ssd1306_host_get_display(uint8_t channel);
+
+
+/**
+ * Sets the maximum transaction size advertised to the driver by means of
+ * ssd1306_i2c_max_transfer_size. Longer transactions are rejected. It must
+ * be called before ssd1306_init to take effect.
+ *
+ * @param  channel      the i2c channel of the display.
+ * @param  max_transfer the maximum transaction size, 0 if unlimited.
+ * @return the outcome of the function call.
+ */
+ssd1306_status_t
+ssd1306_host_set_max_transfer(uint8_t channel, size_t max_transfer);
+
+
+/**
+ * Makes the given transaction fail with SSD1306_COMM_ERROR, in order to
+ * test error handling. Failed transactions do not reach the display.
+ *
+ * @param  channel the i2c channel of the display.
+ * @param  count   the next transaction to fail (1 is the next one),
+ *                 0 disables the failure.
+ * @return the outcome of the function call.
+ */
+ssd1306_status_t
+ssd1306_host_fail_after(uint8_t channel, uint32_t count);
+
+
+/**
+ * Returns the color of a pixel as it appears on the panel. Addressing is
+ * the same of the driver: (0,0) is the top-left corner. The display state,
+ * the start line, the display offset, the multiplex ratio, the remaps and
+ * the inversion are taken into account. The panel is assumed to be
+ * mounted as the driver expects, i.e. the default configuration set by
+ * ssd1306_init shows the GDDRAM content upright.
+ *
+ * @param  channel the i2c channel of the display.
+ * @param  x       the x coordinate of the pixel.
+ * @param  y       the y coordinate of the pixel.
+ * @return true if the pixel is lit.
+ */
+bool
+ssd1306_host_get_pixel(uint8_t channel, uint8_t x, uint8_t y);
+
+
+/**
+ * Renders the panel content in the same page-major format of the driver
+ * buffer, so that frames can be compared with memcmp against a golden
+ * image or against the buffer of the driver itself.
+ *
+ * @param  channel the i2c channel of the display.
+ * @param  frame   destination of SSD1306_FRAME_SIZE bytes.
+ * @return the outcome of the function call.
+ */
+ssd1306_status_t
+ssd1306_host_render(uint8_t channel, uint8_t *frame);
+
+
+/**
+ * Dumps the panel content to a binary PBM (P4) image file.
+ *
+ * @param  channel the i2c channel of the display.
+ * @param  path    the path of the image file.
+ * @return the outcome of the function call.
+ */
+ssd1306_status_t
+ssd1306_host_dump_pbm(uint8_t channel, const char *path);
+
+
+#ifdef SSD1306_ENABLE_ASYNC
+/**
+ * Completes the pending non-blocking transactions, as the i2c interrupts
+ * would do on a real target. Transactions are decoded when started, while
+ * completions are delivered only by this function.
+ *
+ * @return the number of completed transactions.
+ */
+uint32_t
+ssd1306_host_poll(void);
+#endif
+
+
+/* C++ detection */
+#ifdef __cplusplus
+    }
+#endif
+
+#endif // __SSD1306_HOST_H__
@@ -42,6 +42,76 @@
 // Needed to use the i2c API provided by ST HAL.
 extern I2C_HandleTypeDef hi2c1;
 
+#ifdef SSD1306_ENABLE_SPI
+#include "ssd1306_spi.h"
+
+// spi peripherals instantiated in the main.c file, and the GPIO lines
+// of the display hooked to them (4-wire spi).
+extern SPI_HandleTypeDef hspi1;
+
+#define SPI1_DC_PORT  GPIOB
+#define SPI1_DC_PIN   GPIO_PIN_0
+#define SPI1_CS_PORT  GPIOB
+#define SPI1_CS_PIN   GPIO_PIN_1
+#define SPI1_RES_PORT GPIOB
+#define SPI1_RES_PIN  GPIO_PIN_10
+#endif
+
+#ifdef SSD1306_ENABLE_LOCKING
+// In this example threads are FreeRTOS tasks: each i2c peripheral
+// is guarded by a mutex, created with the first display using it.
+#include "FreeRTOS.h"
+#include "semphr.h"
+
+static StaticSemaphore_t i2c1_lock_buffer;
+static SemaphoreHandle_t i2c1_lock;
+#endif
+
+
+/**
+ * Initializes the given i2c peripheral. With ST HAL, peripherals are
+ * initialized by the generated code (see MX_I2C1_Init in main.c),
+ * hence it only checks that the channel is valid.
+ *
+ * @param  channel
+ * @return the outcome of the function call.
+ */
+ssd1306_status_t
+ssd1306_i2c_init(uint8_t channel) {
+
+    switch (channel) {
+        case 0:
+            if (HAL_I2C_GetState(&hi2c1) == HAL_I2C_STATE_RESET)
+                return SSD1306_NOINIT;
+#ifdef SSD1306_ENABLE_LOCKING
+            // Displays are initialized from a single task, e.g. before
+            // the scheduler is started.
+            if (i2c1_lock == NULL)
+                i2c1_lock = xSemaphoreCreateMutexStatic(&i2c1_lock_buffer);
+#endif
+            break;
+        default:
+            return SSD1306_WRONG_PARAMS;
+    }
+
+    return SSD1306_OK;
+}
+
+
+/**
+ * Returns the maximum number of bytes of a single transaction.
+ * ST HAL has no buffer of its own, hence there is no limit.
+ *
+ * @param  channel
+ * @return the maximum transaction size, 0 if unlimited.
+ */
+size_t
+ssd1306_i2c_max_transfer_size(uint8_t channel) {
+
+    (void)channel;
+    return 0;
+}
+
 
 /**
  * This is the core function of this configuration file.
@@ -49,24 +119,97 @@ extern I2C_HandleTypeDef hi2c1;
  * hardware platform. Its implementation is strongly hardware-
  * dependent.
  *
+ * Writes the header bytes followed by the data bytes. Since ST HAL does not
+ * offer blocking scatter/gather transmissions, the command pairs leading the
+ * header are sent first, then the data bytes are sent within a memory write
+ * whose memory address is the final control byte of the header. This way,
+ * data bytes are transmitted straight from the driver buffer.
+ *
  * @param  channel
  * @param  addr
+ * @param  header_ptr
+ * @param  header_size
  * @param  data_ptr
  * @param  data_size
  * @return the outcome of the function call.
  */
 ssd1306_status_t
-ssd1306_i2c_write(uint8_t channel, uint8_t addr,
+ssd1306_i2c_write_v(uint8_t channel, uint8_t addr,
+        const uint8_t *header_ptr, size_t header_size,
         const uint8_t *data_ptr, size_t data_size) {
 
     HAL_StatusTypeDef status;
 
-    // Platform-dependent i2c write function implementation.
-    // The channel allows to route the write request to the appropriate
-    // i2c peripheral. The address allows to reach the desired slave.
     switch (channel) {
         case 0:
-            status = HAL_I2C_Master_Transmit(&hi2c1, addr, data_ptr, data_size, 1000);
+            if (header_size > 1) {
+                status = HAL_I2C_Master_Transmit(&hi2c1, addr,
+                        (uint8_t *)header_ptr, header_size - 1, 1000);
+                if (status != HAL_OK) return SSD1306_COMM_ERROR;
+            }
+            status = HAL_I2C_Mem_Write(&hi2c1, addr, header_ptr[header_size - 1],
+                    I2C_MEMADD_SIZE_8BIT, (uint8_t *)data_ptr, data_size, 1000);
+            if (status != HAL_OK) return SSD1306_COMM_ERROR;
+            break;
+        //case 1:
+            // Some other i2c peripheral hooked to another display.
+            //break;
+        // ...
+        default:
+            return SSD1306_WRONG_PARAMS;
+    }
+
+    return SSD1306_OK;
+}
+
+
+#ifdef SSD1306_ENABLE_ASYNC
+
+/**
+ * State of the non-blocking transaction of an i2c peripheral.
+ * The header bytes are sent first without generating a stop condition,
+ * then the data bytes follow within the same transaction.
+ */
+typedef struct {
+    uint8_t       addr;      /*!< Address of the target display. */
+    const uint8_t *data_ptr; /*!< Data bytes to be sent after the header. */
+    size_t        data_size; /*!< Number of data bytes still to be sent. */
+    void          *ctx;      /*!< Context to be given back to the driver. */
+} i2c_async_state_t;
+
+static i2c_async_state_t i2c1_async_state;
+
+
+/**
+ * Non-blocking version of ssd1306_i2c_write_v. It takes advantage of
+ * the DMA and returns as soon as the transaction has been started.
+ * The driver is notified by means of ssd1306_i2c_write_async_complete.
+ *
+ * @param  channel
+ * @param  addr
+ * @param  header_ptr
+ * @param  header_size
+ * @param  data_ptr
+ * @param  data_size
+ * @param  ctx
+ * @return the outcome of the function call.
+ */
+ssd1306_status_t
+ssd1306_i2c_write_async(uint8_t channel, uint8_t addr,
+        const uint8_t *header_ptr, size_t header_size,
+        const uint8_t *data_ptr, size_t data_size, void *ctx) {
+
+    HAL_StatusTypeDef status;
+
+    switch (channel) {
+        case 0:
+            i2c1_async_state.addr      = addr;
+            i2c1_async_state.data_ptr  = data_ptr;
+            i2c1_async_state.data_size = data_size;
+            i2c1_async_state.ctx       = ctx;
+
+            status = HAL_I2C_Master_Seq_Transmit_DMA(&hi2c1, addr,
+                    (uint8_t *)header_ptr, header_size, I2C_FIRST_FRAME);
             if (status != HAL_OK) return SSD1306_COMM_ERROR;
             break;
         //case 1:
@@ -80,6 +223,218 @@ ssd1306_i2c_write(uint8_t channel, uint8_t addr,
     return SSD1306_OK;
 }
 
+
+// WARNING: the following ST HAL callbacks must not be defined elsewhere.
+// If the application needs them, their bodies must be merged.
+
+void
+HAL_I2C_MasterTxCpltCallback(I2C_HandleTypeDef *hi2c) {
+
+    if (hi2c != &hi2c1) return;
+
+    if (i2c1_async_state.data_size != 0) {
+        // Header sent, the data bytes close the transaction.
+        size_t data_size = i2c1_async_state.data_size;
+        i2c1_async_state.data_size = 0;
+
+        if (HAL_I2C_Master_Seq_Transmit_DMA(hi2c, i2c1_async_state.addr,
+                (uint8_t *)i2c1_async_state.data_ptr, data_size,
+                I2C_LAST_FRAME) != HAL_OK) {
+            ssd1306_i2c_write_async_complete(i2c1_async_state.ctx,
+                    SSD1306_COMM_ERROR);
+        }
+        return;
+    }
+
+    ssd1306_i2c_write_async_complete(i2c1_async_state.ctx, SSD1306_OK);
+}
+
+
+void
+HAL_I2C_ErrorCallback(I2C_HandleTypeDef *hi2c) {
+
+    if (hi2c != &hi2c1) return;
+
+    i2c1_async_state.data_size = 0;
+    ssd1306_i2c_write_async_complete(i2c1_async_state.ctx, SSD1306_COMM_ERROR);
+}
+
+#endif
+
+
+#ifdef SSD1306_ENABLE_LOCKING
+
+/**
+ * Takes the mutex of the given i2c peripheral, waiting as long as
+ * another task is sending a transaction on it.
+ *
+ * @param  channel
+ */
+void
+ssd1306_i2c_lock(uint8_t channel) {
+
+    switch (channel) {
+        case 0:
+            xSemaphoreTake(i2c1_lock, portMAX_DELAY);
+            break;
+        default:
+            break;
+    }
+}
+
+
+/**
+ * Gives the mutex of the given i2c peripheral back.
+ *
+ * @param  channel
+ */
+void
+ssd1306_i2c_unlock(uint8_t channel) {
+
+    switch (channel) {
+        case 0:
+            xSemaphoreGive(i2c1_lock);
+            break;
+        default:
+            break;
+    }
+}
+
+#endif
+
+
+#ifdef SSD1306_ENABLE_SPI
+
+/**
+ * Checks that the given spi peripheral has been initialized by the
+ * generated code (see MX_SPI1_Init in main.c) and resets the display
+ * by pulsing its RES line.
+ *
+ * @param  channel
+ * @return the outcome of the function call.
+ */
+ssd1306_status_t
+ssd1306_spi_init(uint8_t channel) {
+
+    switch (channel) {
+        case 0:
+            if (HAL_SPI_GetState(&hspi1) == HAL_SPI_STATE_RESET)
+                return SSD1306_NOINIT;
+            HAL_GPIO_WritePin(SPI1_CS_PORT, SPI1_CS_PIN, GPIO_PIN_SET);
+            HAL_GPIO_WritePin(SPI1_RES_PORT, SPI1_RES_PIN, GPIO_PIN_RESET);
+            HAL_Delay(1);
+            HAL_GPIO_WritePin(SPI1_RES_PORT, SPI1_RES_PIN, GPIO_PIN_SET);
+            HAL_Delay(1);
+            break;
+        default:
+            return SSD1306_WRONG_PARAMS;
+    }
+
+    return SSD1306_OK;
+}
+
+
+/**
+ * Sends the given bytes while the CS line is asserted. The D/C line
+ * tells the display whether they are data or command bytes.
+ *
+ * @param  channel
+ * @param  data
+ * @param  data_ptr
+ * @param  data_size
+ * @return the outcome of the function call.
+ */
+ssd1306_status_t
+ssd1306_spi_write(uint8_t channel, bool data,
+        const uint8_t *data_ptr, size_t data_size) {
+
+    HAL_StatusTypeDef status;
+
+    switch (channel) {
+        case 0:
+            HAL_GPIO_WritePin(SPI1_DC_PORT, SPI1_DC_PIN,
+                    data ? GPIO_PIN_SET : GPIO_PIN_RESET);
+            HAL_GPIO_WritePin(SPI1_CS_PORT, SPI1_CS_PIN, GPIO_PIN_RESET);
+            status = HAL_SPI_Transmit(&hspi1, (uint8_t *)data_ptr, data_size, 1000);
+            HAL_GPIO_WritePin(SPI1_CS_PORT, SPI1_CS_PIN, GPIO_PIN_SET);
+            if (status != HAL_OK) return SSD1306_COMM_ERROR;
+            break;
+        default:
+            return SSD1306_WRONG_PARAMS;
+    }
+
+    return SSD1306_OK;
+}
+
+
+#ifdef SSD1306_ENABLE_ASYNC
+
+static void *spi1_async_ctx; // Context to be given back to the driver.
+
+
+/**
+ * Non-blocking version of ssd1306_spi_write, based on the DMA. The CS
+ * line is released and the driver is notified by the completion callback.
+ *
+ * @param  channel
+ * @param  data
+ * @param  data_ptr
+ * @param  data_size
+ * @param  ctx
+ * @return the outcome of the function call.
+ */
+ssd1306_status_t
+ssd1306_spi_write_async(uint8_t channel, bool data,
+        const uint8_t *data_ptr, size_t data_size, void *ctx) {
+
+    HAL_StatusTypeDef status;
+
+    switch (channel) {
+        case 0:
+            spi1_async_ctx = ctx;
+            HAL_GPIO_WritePin(SPI1_DC_PORT, SPI1_DC_PIN,
+                    data ? GPIO_PIN_SET : GPIO_PIN_RESET);
+            HAL_GPIO_WritePin(SPI1_CS_PORT, SPI1_CS_PIN, GPIO_PIN_RESET);
+            status = HAL_SPI_Transmit_DMA(&hspi1, (uint8_t *)data_ptr, data_size);
+            if (status != HAL_OK) {
+                HAL_GPIO_WritePin(SPI1_CS_PORT, SPI1_CS_PIN, GPIO_PIN_SET);
+                return SSD1306_COMM_ERROR;
+            }
+            break;
+        default:
+            return SSD1306_WRONG_PARAMS;
+    }
+
+    return SSD1306_OK;
+}
+
+
+// WARNING: the following ST HAL callbacks must not be defined elsewhere.
+// If the application needs them, their bodies must be merged.
+
+void
+HAL_SPI_TxCpltCallback(SPI_HandleTypeDef *hspi) {
+
+    if (hspi != &hspi1) return;
+
+    HAL_GPIO_WritePin(SPI1_CS_PORT, SPI1_CS_PIN, GPIO_PIN_SET);
+    ssd1306_spi_write_async_complete(spi1_async_ctx, SSD1306_OK);
+}
+
+
+void
+HAL_SPI_ErrorCallback(SPI_HandleTypeDef *hspi) {
+
+    if (hspi != &hspi1) return;
+
+    HAL_GPIO_WritePin(SPI1_CS_PORT, SPI1_CS_PIN, GPIO_PIN_SET);
+    ssd1306_spi_write_async_complete(spi1_async_ctx, SSD1306_COMM_ERROR);
+}
+
+#endif
+
+#endif
+
 /* C++ detection */
 #ifdef __cplusplus
     }
@@ -0,0 +1,187 @@
+/**
+ * @file   ssd1306_console.h
+ * @brief  SSD1306 OLED display C library.
+ *
+ * @copyright
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  any later version.
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ *  GNU General Public License for more details.
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program. If not, see <http://www.gnu.org/licenses/>.
+ *
+ * @author Giovanni Scotti
+ */
+
+#ifndef __SSD1306_CONSOLE_H__
+#define __SSD1306_CONSOLE_H__
+
+/* C++ detection */
+#ifdef __cplusplus
+    extern "C" {
+#endif
+
+
+#include "ssd1306_driver.h"
+
+
+// The console redraws single cells, hence it needs the whole software buffer.
+#ifndef SSD1306_ENABLE_PAGE_MODE
+
+#ifndef SSD1306_CONSOLE_MAX_COLS
+#define SSD1306_CONSOLE_MAX_COLS 32 /// Max number of columns of a console.
+#endif
+#ifndef SSD1306_CONSOLE_MAX_ROWS
+#define SSD1306_CONSOLE_MAX_ROWS 8  /// Max number of rows of a console.
+#endif
+
+#if SSD1306_CONSOLE_MAX_COLS > 32
+#error "SSD1306_CONSOLE_MAX_COLS cannot exceed 32 (one dirty bit per column)."
+#endif
+
+
+/**
+ * Text console covering the whole display. Characters are stored in a grid
+ * of cells and each cell modified since the last rendering is tracked by
+ * a bit of dirty, so that only the modified cells are redrawn and only
+ * their page spans are flushed.
+ *
+ * If hw_scroll is set, rows are aligned to pages and scrolling moves the
+ * display start line (see ssd1306_scroll_up), so that only the new bottom
+ * row is transmitted. Otherwise, rows are packed and scrolling redraws the
+ * cells whose character changes.
+ */
+typedef struct {
+    ssd1306_t          *display;   /*!< The display the console draws on. */
+    ssd1306_font_name_t font_name; /*!< Font of the console, fixed-width. */
+    uint8_t  cols;                 /*!< Number of columns. */
+    uint8_t  rows;                 /*!< Number of rows. */
+    uint8_t  cell_width;           /*!< Width of a cell in pixels. */
+    uint8_t  cell_height;          /*!< Height of a cell in pixels. */
+    uint8_t  cur_col;              /*!< Cursor column, cols if a wrap is pending. */
+    uint8_t  cur_row;              /*!< Cursor row. */
+    uint8_t  drawn_col;            /*!< Column of the cursor last drawn. */
+    uint8_t  drawn_row;            /*!< Row of the cursor last drawn. */
+    bool     hw_scroll;            /*!< Scrolling moves the display start line. */
+    bool     show_cursor;          /*!< The cursor cell is drawn inverted. */
+    char     cells[SSD1306_CONSOLE_MAX_ROWS][SSD1306_CONSOLE_MAX_COLS];
+                                   /*!< Characters of the console. */
+    uint32_t dirty[SSD1306_CONSOLE_MAX_ROWS]; /*!< Cells to be redrawn. */
+} ssd1306_console_t;
+
+
+/**
+ * Initializes a console on the given display, whose software buffer is
+ * cleared. The grid is as large as the display allows for the given font.
+ *
+ * @param  console_ptr a pointer to a ssd1306_console_t structure.
+ * @param  ssd1306_ptr a pointer to an initialized ssd1306_t structure.
+ * @param  font_name   the font to use. It must be enabled, fixed-width and
+ *                     hold all the printable characters.
+ * @param  hw_scroll   if true, scrolling moves the display start line. This
+ *                     requires a 64 rows high panel and a font height
+ *                     dividing it once rounded up to a whole page.
+ * @return the outcome of the function call.
+ */
+ssd1306_status_t
+ssd1306_console_init(ssd1306_console_t *console_ptr, ssd1306_t *ssd1306_ptr,
+        ssd1306_font_name_t font_name, bool hw_scroll);
+
+
+/**
+ * Prints a character at the cursor position and advances the cursor,
+ * wrapping to the next line at the end of a row and scrolling the console
+ * up at the end of the last row. '\n' moves the cursor to the beginning of
+ * the next line, '\r' to the beginning of the current line and '\b' one
+ * cell back. Other non printable characters are ignored.
+ * Nothing is drawn until ssd1306_console_render or ssd1306_console_flush.
+ *
+ * @param  console_ptr a pointer to a ssd1306_console_t structure.
+ * @param  ch          the character to print.
+ * @return the outcome of the function call.
+ */
+ssd1306_status_t
+ssd1306_console_putc(ssd1306_console_t *console_ptr, char ch);
+
+
+/**
+ * Prints a string by means of ssd1306_console_putc.
+ *
+ * @param  console_ptr a pointer to a ssd1306_console_t structure.
+ * @param  str         the string to print.
+ * @param  str_len     the length of the string.
+ * @return the outcome of the function call.
+ */
+ssd1306_status_t
+ssd1306_console_write(ssd1306_console_t *console_ptr, const char *str,
+        size_t str_len);
+
+
+/**
+ * Moves the cursor to the given cell.
+ *
+ * @param  console_ptr a pointer to a ssd1306_console_t structure.
+ * @param  col         the column, from 0 to cols - 1.
+ * @param  row         the row, from 0 to rows - 1.
+ * @return the outcome of the function call.
+ */
+ssd1306_status_t
+ssd1306_console_goto(ssd1306_console_t *console_ptr, uint8_t col, uint8_t row);
+
+
+/**
+ * Clears all the cells and moves the cursor to the top-left cell.
+ *
+ * @param  console_ptr a pointer to a ssd1306_console_t structure.
+ * @return the outcome of the function call.
+ */
+ssd1306_status_t
+ssd1306_console_clear(ssd1306_console_t *console_ptr);
+
+
+/**
+ * Shows or hides the cursor, drawn as an inverted cell.
+ *
+ * @param  console_ptr a pointer to a ssd1306_console_t structure.
+ * @param  show        true to show the cursor.
+ * @return the outcome of the function call.
+ */
+ssd1306_status_t
+ssd1306_console_show_cursor(ssd1306_console_t *console_ptr, bool show);
+
+
+/**
+ * Redraws the modified cells into the software buffer of the display.
+ * It allows to transmit them by means of any update function, e.g. a
+ * non-blocking one.
+ *
+ * @param  console_ptr a pointer to a ssd1306_console_t structure.
+ * @return the outcome of the function call.
+ */
+ssd1306_status_t
+ssd1306_console_render(ssd1306_console_t *console_ptr);
+
+
+/**
+ * Redraws the modified cells and flushes their page spans to the display
+ * by means of ssd1306_update_dirty.
+ *
+ * @param  console_ptr a pointer to a ssd1306_console_t structure.
+ * @return the outcome of the function call.
+ */
+ssd1306_status_t
+ssd1306_console_flush(ssd1306_console_t *console_ptr);
+
+#endif
+
+
+/* C++ detection */
+#ifdef __cplusplus
+    }
+#endif
+
+#endif // __SSD1306_CONSOLE_H__
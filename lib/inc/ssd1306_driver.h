@@ -32,9 +32,82 @@
 #include "ssd1306_fonts.h"
 
 
+// Macros to tailor the library.
+//#define SSD1306_ENABLE_ASYNC /// Uncomment to enable non-blocking updates.
+//#define SSD1306_ENABLE_PAGE_MODE /// Uncomment to render a band at a time.
+//#define SSD1306_ENABLE_SPI /// Uncomment to drive displays over 4-wire spi.
+//#define SSD1306_ENABLE_STATS /// Uncomment to collect statistics and traces.
+//#define SSD1306_ENABLE_FRAME_DIFF /// Uncomment to send only the bytes changed since the last update.
+//#define SSD1306_ENABLE_LOCKING /// Uncomment to share displays and i2c buses between threads.
+
+
+// Panel geometry. Common panels are 128x64 (default), 128x32, 96x16 and 64x48.
+// Define both values at compile time (e.g. -DSSD1306_PXL_HEIGHT=32) to fit
+// the actual panel: buffer size, transmitted pages and init sequence scale.
+#ifndef SSD1306_PXL_WIDTH
 #define SSD1306_PXL_WIDTH   128
+#endif
+#ifndef SSD1306_PXL_HEIGHT
 #define SSD1306_PXL_HEIGHT  64
-#define SSD1306_BUFFER_SIZE (SSD1306_PXL_WIDTH * SSD1306_PXL_HEIGHT / 8)
+#endif
+
+#if SSD1306_PXL_WIDTH < 1 || SSD1306_PXL_WIDTH > 128
+#error "SSD1306_PXL_WIDTH must be between 1 and 128."
+#endif
+#if SSD1306_PXL_HEIGHT < 16 || SSD1306_PXL_HEIGHT > 64 || SSD1306_PXL_HEIGHT % 8
+#error "SSD1306_PXL_HEIGHT must be a multiple of 8 between 16 and 64."
+#endif
+
+// First controller column wired to the panel. Panels 64 pixels wide are
+// centered on the 128 columns of the controller ram.
+#ifndef SSD1306_COL_OFFSET
+#if SSD1306_PXL_WIDTH == 64
+#define SSD1306_COL_OFFSET  32
+#else
+#define SSD1306_COL_OFFSET  0
+#endif
+#endif
+
+// COM pins hardware configuration: panels with 32 rows or less use
+// the sequential configuration, taller panels the alternative one.
+#ifndef SSD1306_COM_PINS_CONFIG
+#if SSD1306_PXL_HEIGHT > 32
+#define SSD1306_COM_PINS_CONFIG 0x12
+#else
+#define SSD1306_COM_PINS_CONFIG 0x02
+#endif
+#endif
+
+#if SSD1306_COL_OFFSET + SSD1306_PXL_WIDTH > 128
+#error "The panel exceeds the 128 columns of the controller ram."
+#endif
+
+#define SSD1306_FRAME_SIZE  (SSD1306_PXL_WIDTH * SSD1306_PXL_HEIGHT / 8)
+#define SSD1306_NUM_PAGES   (SSD1306_PXL_HEIGHT / 8)
+
+// Number of pages held by the software buffer. In page mode, the display
+// is rendered a band of SSD1306_BUFFER_PAGES pages at a time, so that the
+// software buffer only takes SSD1306_BUFFER_PAGES * SSD1306_PXL_WIDTH bytes.
+#ifdef SSD1306_ENABLE_PAGE_MODE
+#ifndef SSD1306_BUFFER_PAGES
+#define SSD1306_BUFFER_PAGES 1
+#endif
+#else
+#undef  SSD1306_BUFFER_PAGES
+#define SSD1306_BUFFER_PAGES SSD1306_NUM_PAGES
+#endif
+
+#if SSD1306_BUFFER_PAGES < 1 || SSD1306_BUFFER_PAGES > SSD1306_NUM_PAGES
+#error "SSD1306_BUFFER_PAGES must be between 1 and the number of pages."
+#endif
+#if defined(SSD1306_ENABLE_PAGE_MODE) && defined(SSD1306_ENABLE_ASYNC)
+#error "Non-blocking updates require the whole software buffer."
+#endif
+#if defined(SSD1306_ENABLE_PAGE_MODE) && defined(SSD1306_ENABLE_FRAME_DIFF)
+#error "Frame diffing requires the whole software buffer."
+#endif
+
+#define SSD1306_BUFFER_SIZE (SSD1306_PXL_WIDTH * SSD1306_BUFFER_PAGES)
 
 
 /**
@@ -45,7 +118,8 @@ typedef enum {
     SSD1306_NOINIT       = 1, /*!< Display has not been initialized before use. */
     SSD1306_WRONG_PARAMS = 2, /*!< Invalid arguments. */
     SSD1306_COMM_ERROR   = 3, /*!< Error while communicating with the display. */
-    SSD1306_STATUS_COUNT = 4  /*!< Total number of possible status. */
+    SSD1306_BUSY         = 4, /*!< A non-blocking update is still in progress. */
+    SSD1306_STATUS_COUNT = 5  /*!< Total number of possible status. */
 } ssd1306_status_t;
 
 
@@ -58,6 +132,29 @@ typedef enum {
 } ssd1306_color_t;
 
 
+/**
+ * Text drawing modes. They define how characters are combined with
+ * the content of the software buffer.
+ */
+typedef enum {
+    SSD1306_TEXT_OPAQUE      = 0, /*!< Glyph background takes the opposite color. */
+    SSD1306_TEXT_TRANSPARENT = 1, /*!< Glyph background is left untouched. */
+    SSD1306_TEXT_XOR         = 2  /*!< Glyph pixels invert the underlying ones. */
+} ssd1306_text_mode_t;
+
+
+/**
+ * Raster operations. They define how the pixels drawn by every primitive are
+ * combined with the content of the software buffer, according to their color.
+ */
+typedef enum {
+    SSD1306_ROP_COPY    = 0, /*!< Pixels take their color. */
+    SSD1306_ROP_OR      = 1, /*!< White pixels are lit, black ones are left untouched. */
+    SSD1306_ROP_AND_NOT = 2, /*!< White pixels are turned off, black ones are left untouched. */
+    SSD1306_ROP_XOR     = 3  /*!< White pixels are inverted, black ones are left untouched. */
+} ssd1306_rop_t;
+
+
 /**
  * Types of scrolling animations.
  */
@@ -100,6 +197,180 @@ typedef enum {
 } ssd1306_time_int_t;
 
 
+/**
+ * Function called when a non-blocking update completes or fails.
+ * Depending on the port implementation, it may be invoked from
+ * interrupt context.
+ *
+ * @param status the outcome of the update.
+ * @param ctx    the user context given when the update was started.
+ */
+typedef void (*ssd1306_callback_t)(ssd1306_status_t status, void *ctx);
+
+
+#ifdef SSD1306_ENABLE_LOCKING
+/**
+ * Function acquiring or releasing the lock of the software buffer of
+ * a display (see ssd1306_set_lock), e.g. by means of an RTOS mutex.
+ * The lock is never acquired twice by the driver, which holds it only
+ * while copying or marking the dirty spans.
+ *
+ * @param acquire true to acquire the lock, false to release it.
+ * @param ctx     the user context given to ssd1306_set_lock.
+ */
+typedef void (*ssd1306_lock_t)(bool acquire, void *ctx);
+#endif
+
+
+/**
+ * Function filling the given buffer with the bytes of a page-major frame
+ * streamed by ssd1306_stream. Frames are requested sequentially, from the
+ * first column of page 0 to the last column of the last page.
+ *
+ * @param  dst    the buffer to be filled.
+ * @param  offset the offset of the first byte within the frame.
+ * @param  size   the number of bytes to be produced.
+ * @param  ctx    the user context given to ssd1306_stream.
+ * @return the outcome of the call. Streaming stops on any status
+ *         other than SSD1306_OK, which is returned to the caller.
+ */
+typedef ssd1306_status_t (*ssd1306_producer_t)(uint8_t *dst, size_t offset,
+        size_t size, void *ctx);
+
+
+/// Size of the control and command bytes preceding the data bytes of
+/// a transaction: two bytes for each address window command or parameter,
+/// and the data control byte.
+#define SSD1306_TX_HEADER_SIZE 13
+
+// Max number of unchanged bytes sent along with the changed ones around them
+// when frame diffing is enabled, rather than starting a new address window.
+// The default one costs as much as the header of the new window.
+#ifndef SSD1306_DIFF_MERGE_GAP
+#define SSD1306_DIFF_MERGE_GAP SSD1306_TX_HEADER_SIZE
+#endif
+
+// Max number of command bytes queued between ssd1306_begin_batch and
+// ssd1306_commit_batch. Longer batches are sent in more transactions.
+#ifndef SSD1306_CMD_BATCH_SIZE
+#define SSD1306_CMD_BATCH_SIZE 32
+#endif
+
+/// Size of the longest header of a transaction, made of the queued commands
+/// and the display start line command, each one preceded by a single command
+/// control byte, and of the address window header.
+#define SSD1306_TX_MAX_HEADER_SIZE \
+    (2 * (SSD1306_CMD_BATCH_SIZE + 1) + SSD1306_TX_HEADER_SIZE)
+
+// Max number of command bytes leading a transaction over spi, once its
+// header is stripped of the control bytes (see ssd1306_spi.h).
+#define SSD1306_SPI_MAX_HEADER_CMDS ((SSD1306_TX_MAX_HEADER_SIZE - 1) / 2)
+
+// Size of the chunks requested to the producer of ssd1306_stream, which
+// are held on the stack. Each chunk is sent within a single transaction.
+#ifndef SSD1306_STREAM_CHUNK_SIZE
+#define SSD1306_STREAM_CHUNK_SIZE 32
+#endif
+
+// Size of a buffer holding any integer formatted by ssd1306_format_int:
+// 32 binary digits, or a sign and 10 decimal digits.
+#define SSD1306_INT_STR_SIZE 32
+
+
+/**
+ * Operations of the transport connecting a display to the driver.
+ * Transactions are described as i2c ones: the header is made of zero or
+ * more pairs of single command control byte and command byte, followed by
+ * one control byte telling whether the data bytes are commands or display
+ * ram bytes. A transport without control bytes (e.g. spi, where a D/C line
+ * selects commands or data) translates them before sending the bytes.
+ * Each operation receives the context given to ssd1306_init_transport.
+ *
+ * write_async only starts the transaction: both buffers stay valid until
+ * the port calls ssd1306_i2c_write_async_complete with complete_ctx,
+ * which must happen after returning.
+ */
+typedef struct {
+    ssd1306_status_t (*init)(void *ctx);   /*!< Initializes the peripheral. */
+    size_t (*max_transfer_size)(void *ctx); /*!< Max bytes per transaction, 0 if unlimited. */
+    ssd1306_status_t (*write_v)(void *ctx,
+            const uint8_t *header_ptr, size_t header_size,
+            const uint8_t *data_ptr, size_t data_size);
+                                           /*!< Sends the header and the data bytes. */
+#ifdef SSD1306_ENABLE_ASYNC
+    ssd1306_status_t (*write_async)(void *ctx,
+            const uint8_t *header_ptr, size_t header_size,
+            const uint8_t *data_ptr, size_t data_size, void *complete_ctx);
+                                           /*!< Starts sending them, non-blocking. */
+#endif
+} ssd1306_transport_t;
+
+
+#ifdef SSD1306_ENABLE_STATS
+
+// Timestamp used to measure the duration of updates, in any unit (e.g.
+// microseconds or cpu cycles). Define it at compile time to read a
+// free-running counter of the port, e.g. -DSSD1306_STATS_TIME()=micros().
+// Durations are measured modulo 2^32, hence the counter may wrap around.
+#ifndef SSD1306_STATS_TIME
+#define SSD1306_STATS_TIME() 0
+#endif
+
+
+/**
+ * Events reported to the trace hook.
+ */
+typedef enum {
+    SSD1306_TRACE_WRITE_BEGIN  = 0x00, /*!< A transaction is about to be sent. */
+    SSD1306_TRACE_WRITE_END    = 0x01, /*!< A transaction is over. */
+    SSD1306_TRACE_UPDATE_BEGIN = 0x02, /*!< An update is about to start. */
+    SSD1306_TRACE_UPDATE_END   = 0x03  /*!< An update is over. */
+} ssd1306_trace_event_t;
+
+
+/**
+ * Function called by the driver around each transaction and each update
+ * of a display (see ssd1306_set_trace). It is called from the context
+ * sending the transaction: for non-blocking updates, possibly from
+ * interrupt context, hence it must be short.
+ *
+ * @param event  the event being reported.
+ * @param size   for SSD1306_TRACE_WRITE_BEGIN, the number of bytes of the
+ *               transaction (header and data bytes), otherwise 0.
+ * @param status for the end events, the outcome of the transaction or of
+ *               the update, otherwise SSD1306_OK.
+ * @param ctx    the user context given to ssd1306_set_trace.
+ */
+typedef void (*ssd1306_trace_t)(ssd1306_trace_event_t event, size_t size,
+        ssd1306_status_t status, void *ctx);
+
+
+/**
+ * Counters of the activity of a display since its initialization or since
+ * the last ssd1306_reset_stats. Pixels and primitives count the work done
+ * on the software buffer, after clipping: each primitive is a pixel, a line,
+ * a circle outline, an area or a bitmap written into the buffer, which
+ * higher-level drawing functions are made of (e.g. a rectangle is made of
+ * four areas). In page mode, they are counted for each band rendered.
+ * Updates are counted by ssd1306_update, ssd1306_update_dirty, their
+ * non-blocking versions and, in page mode, ssd1306_render, whose duration
+ * includes drawing the bands. Times are given in SSD1306_STATS_TIME units.
+ */
+typedef struct {
+    uint32_t pixels;            /*!< Pixels written into the software buffer. */
+    uint32_t primitives;        /*!< Primitives drawn into the software buffer. */
+    uint32_t bytes;             /*!< Bytes sent, control bytes included. */
+    uint32_t transactions;      /*!< Transactions sent. */
+    uint32_t comm_errors;       /*!< Transactions failed. */
+    uint32_t updates;           /*!< Updates completed or failed. */
+    uint32_t update_time_last;  /*!< Duration of the last update. */
+    uint32_t update_time_max;   /*!< Duration of the longest update. */
+    uint32_t update_time_total; /*!< Duration of all the updates. */
+} ssd1306_stats_t;
+
+#endif
+
+
 /**
  * Structure to store information about the ssd1306 display status.
  * The internal software buffer is configured as follows:
@@ -110,19 +381,146 @@ typedef enum {
  * | | | | ... | | page 1 (byte 128 to byte 255)
  *   ...            ...
  *
+ * For each page, the range of columns modified since the last update
+ * is tracked by dirty_start and dirty_end. A page is clean when its
+ * dirty_start is greater than its dirty_end.
+ *
+ * While a non-blocking update is in progress, the software buffer is
+ * being transmitted and cannot be modified: functions drawing into it
+ * return SSD1306_BUSY until the update completes. The spans and the queued
+ * commands being sent are held by the tx_* fields. If the update fails,
+ * its completion only sets tx_failed, possibly from interrupt context:
+ * the spans left are marked as dirty again by the next update.
+ *
+ * Drawing functions write into the buffer pointed by buffer (back buffer)
+ * while updates transmit it and then make it the front buffer. By default
+ * both point to frame. If the application provides a second buffer by means
+ * of ssd1306_set_back_buffer, the two buffers are exchanged at each update,
+ * so that the next frame can be drawn while the previous one is being sent.
+ *
+ * The software buffer mirrors the display ram. After ssd1306_scroll_up,
+ * the display shows it starting from start_page, wrapping around: drawing
+ * functions translate their coordinates accordingly. The start line of the
+ * display is sent along with each transaction writing the display ram until
+ * one succeeds, i.e. as long as start_line_acked differs from start_line_seq.
+ *
+ * Drawing coordinates are relative to the origin (origin_x, origin_y) and
+ * drawings are clipped to the rectangle from (clip_x0, clip_y0) to
+ * (clip_x1, clip_y1), both included and given in display coordinates, which
+ * is empty if clip_x0 is greater than clip_x1. By default, the origin is the
+ * top-left corner and the clip rectangle covers the whole display.
+ *
+ * Between ssd1306_begin_batch and ssd1306_commit_batch, command bytes are
+ * queued in cmd_batch instead of being sent one transaction at a time.
+ *
+ * In page mode, the software buffer only holds the band of pages being
+ * rendered by ssd1306_render, starting from band_page: drawing functions
+ * clip their output to it.
+ *
+ * Every transaction goes through the operations of transport, which are
+ * the i2c port hooks by default (see ssd1306_init_transport).
+ *
+ * If statistics are enabled, the activity of the display is counted
+ * in stats, which the application may read at any time.
+ *
+ * If frame diffing is enabled, shadow holds the content of the display ram
+ * as last transmitted, for each page whose bit is set in shadow_valid.
+ * Updates compare the spans to be sent with it, so that only the runs of
+ * changed bytes are transmitted.
+ *
+ * If locking is enabled, lock guards the software buffer and the dirty
+ * spans against concurrent access, so that a thread can draw while another
+ * one is sending the previous frame (see ssd1306_update_snapshot).
  */
 typedef struct {
     uint8_t x_pos;       /*!< Current position of the cursor on x axis. */
     uint8_t y_pos;       /*!< Current position of the cursor on y axis. */
+    ssd1306_text_mode_t text_mode; /*!< How characters are drawn. */
+    ssd1306_rop_t rop;   /*!< How drawn pixels are combined with the buffer. */
+    int16_t origin_x;    /*!< Offset added to the x coordinate of drawings. */
+    int16_t origin_y;    /*!< Offset added to the y coordinate of drawings. */
+    uint8_t clip_x0;     /*!< First column of the clip rectangle. */
+    uint8_t clip_y0;     /*!< First row of the clip rectangle. */
+    uint8_t clip_x1;     /*!< Last column of the clip rectangle. */
+    uint8_t clip_y1;     /*!< Last row of the clip rectangle. */
     bool    inverted;    /*!< Display color is inverted. */
     bool    initialized; /*!< Display initialization flag. */
     bool    scrolling;   /*!< Display is performing scrolling activities. */
-    uint8_t i2c_channel; /*!< Defines the i2c peripheral connected to the display. */
+    uint8_t start_page;  /*!< Page of the software buffer shown at the top. */
+    uint8_t start_line_seq; /*!< Number of start line changes, modulo 256. */
+    volatile uint8_t start_line_acked; /*!< start_line_seq last applied by the display. */
+    uint8_t i2c_channel; /*!< Defines the peripheral (bus) connected to the display. */
     uint8_t i2c_addr;    /*!< Address of the display for i2c communication. */
-    uint8_t buffer[SSD1306_BUFFER_SIZE]; /*!< Holds display content. */
+    size_t  i2c_max_transfer; /*!< Max bytes per transaction, 0 if unlimited. */
+    const ssd1306_transport_t *transport; /*!< Operations sending transactions. */
+    void    *transport_ctx;               /*!< Context of the transport operations. */
+    uint8_t *buffer;                     /*!< Buffer being drawn (back buffer). */
+    uint8_t *front_buffer;               /*!< Buffer last submitted to the display. */
+    uint8_t frame[SSD1306_BUFFER_SIZE];  /*!< Holds display content. */
+    uint8_t dirty_start[SSD1306_NUM_PAGES]; /*!< First modified column of each page. */
+    uint8_t dirty_end[SSD1306_NUM_PAGES];   /*!< Last modified column of each page. */
+    uint8_t cmd_batch[SSD1306_CMD_BATCH_SIZE]; /*!< Queued command bytes. */
+    uint8_t cmd_batch_len;                  /*!< Number of queued command bytes. */
+    bool    batching;                       /*!< Commands are being queued. */
+#ifdef SSD1306_ENABLE_PAGE_MODE
+    uint8_t band_page;                      /*!< First page held by the buffer. */
+#endif
+#ifdef SSD1306_ENABLE_ASYNC
+    volatile bool busy;                     /*!< A non-blocking update is in progress. */
+    uint8_t tx_page;                        /*!< First page of the ongoing transaction. */
+    uint8_t tx_page_end;                    /*!< Last page of the ongoing transaction. */
+    uint8_t tx_col_end;                     /*!< Last column of the ongoing transaction. */
+    uint8_t tx_start[SSD1306_NUM_PAGES];    /*!< First column of each page to be transmitted. */
+    uint8_t tx_end[SSD1306_NUM_PAGES];      /*!< Last column of each page to be transmitted. */
+    uint8_t tx_header[SSD1306_TX_MAX_HEADER_SIZE]; /*!< Header of the ongoing transaction. */
+    size_t  tx_header_size;                 /*!< Size of tx_header in bytes. */
+    uint8_t tx_cmd[SSD1306_CMD_BATCH_SIZE + 1]; /*!< Queued commands and start line sent by the update. */
+    uint8_t tx_line_seq;                    /*!< start_line_seq sent by the update. */
+    uint8_t tx_cmd_len;                     /*!< Number of bytes of tx_cmd still to be sent. */
+    bool    tx_cmd_only;                    /*!< The ongoing transaction only carries tx_cmd. */
+    volatile bool tx_failed;                /*!< The spans left in tx_start and tx_end were not sent. */
+    const uint8_t *tx_data_ptr;             /*!< Data bytes of the span still to be sent. */
+    size_t  tx_data_size;                   /*!< Number of data bytes still to be sent. */
+    ssd1306_callback_t tx_callback;         /*!< Called when the update ends. */
+    void    *tx_ctx;                        /*!< User context of tx_callback. */
+#endif
+#if defined(SSD1306_ENABLE_SPI) && defined(SSD1306_ENABLE_ASYNC)
+    uint8_t spi_cmd[SSD1306_SPI_MAX_HEADER_CMDS]; /*!< Command bytes of the ongoing spi transaction. */
+    bool    spi_data;                       /*!< D/C line level of its data bytes. */
+    const uint8_t *spi_data_ptr;            /*!< Data bytes sent once the commands are. */
+    size_t  spi_data_size;                  /*!< Their size, 0 once they are being sent. */
+    void    *spi_complete_ctx;              /*!< Context given back to the driver. */
+#endif
+#ifdef SSD1306_ENABLE_FRAME_DIFF
+    uint8_t shadow[SSD1306_BUFFER_SIZE];    /*!< Display ram content as last transmitted. */
+    uint8_t shadow_valid;                   /*!< Pages of shadow matching the display ram. */
+#endif
+#ifdef SSD1306_ENABLE_LOCKING
+    ssd1306_lock_t lock;                    /*!< Guards the software buffer, NULL if none. */
+    void    *lock_ctx;                      /*!< User context of lock. */
+#endif
+#ifdef SSD1306_ENABLE_STATS
+    ssd1306_stats_t stats;                  /*!< Activity counters. */
+    uint32_t update_began;                  /*!< Start time of the ongoing update. */
+    ssd1306_trace_t trace;                  /*!< Called around transactions and updates. */
+    void    *trace_ctx;                     /*!< User context of trace. */
+#endif
 } ssd1306_t;
 
 
+/**
+ * Function drawing the content of the display by means of the drawing
+ * functions, invoked by ssd1306_render once for each band of pages.
+ *
+ * @param  ssd1306_ptr the display being rendered.
+ * @param  ctx         the user context given to ssd1306_render.
+ * @return the outcome of the call. Rendering stops on any status
+ *         other than SSD1306_OK, which is returned to the caller.
+ */
+typedef ssd1306_status_t (*ssd1306_draw_cb_t)(ssd1306_t *ssd1306_ptr,
+        void *ctx);
+
+
 /**
  * Turns the display on. This function has a direct effect on the
  * display hardware.
@@ -208,6 +606,56 @@ ssd1306_scroll(ssd1306_t *ssd1306_ptr, ssd1306_scroll_t type, ssd1306_page_t sta
     ssd1306_page_t end_page, ssd1306_time_int_t interval);
 
 
+/**
+ * Scrolls the display content up by the given number of pages (8 rows
+ * each) without moving the software buffer: the display start line is
+ * moved instead, so the buffer and the display ram act as a ring. The
+ * pages exposed at the bottom are cleared and marked as dirty, while the
+ * content scrolled out at the top is lost. The start line command is sent
+ * within the first transaction of the next update, which also rewrites the
+ * exposed pages, and again by the following ones until a transaction
+ * carrying it succeeds: a new line of text can then be drawn at the bottom
+ * and ssd1306_update_dirty only transmits the exposed pages.
+ * It requires a 64 rows high panel, since the display ram wraps around
+ * after 64 rows.
+ *
+ * @param  ssd1306_ptr a pointer to a ssd1306_t structure.
+ * @param  pages       the number of pages to scroll, up to SSD1306_NUM_PAGES.
+ * @return the outcome of the function call.
+ */
+ssd1306_status_t
+ssd1306_scroll_up(ssd1306_t *ssd1306_ptr, uint8_t pages);
+
+
+/**
+ * Starts a batch of commands. From now on, the functions having a direct
+ * effect on the display hardware (e.g. ssd1306_set_contrast) only queue
+ * their command bytes, which are sent within a single transaction by
+ * ssd1306_commit_batch. If an update is performed meanwhile, the queued
+ * commands are sent within the first transaction of the update, ahead
+ * of the data bytes. Commands can be queued even while a non-blocking
+ * update is in progress.
+ *
+ * @param  ssd1306_ptr a pointer to a ssd1306_t structure.
+ * @return the outcome of the function call.
+ */
+ssd1306_status_t
+ssd1306_begin_batch(ssd1306_t *ssd1306_ptr);
+
+
+/**
+ * Ends the batch of commands started by ssd1306_begin_batch and sends the
+ * queued command bytes within a single transaction, preceded by a single
+ * command control byte. Nothing is sent if no command is queued.
+ * Queued commands are discarded if an error occurs.
+ *
+ * @param  ssd1306_ptr a pointer to a ssd1306_t structure.
+ * @return the outcome of the function call.
+ */
+ssd1306_status_t
+ssd1306_commit_batch(ssd1306_t *ssd1306_ptr);
+
+
 /**
  * Sets the cursor to desired location expressed in pixels.
  * If the new cursor coordinates are outside the display area,
@@ -225,7 +673,62 @@ ssd1306_goto_xy(ssd1306_t *ssd1306_ptr, uint8_t x, uint8_t y);
 
 
 /**
- * Fills the entire display with desired color. This function modifies only
+ * Sets the origin of the drawing coordinates of the given display: the
+ * following drawings are translated by (x, y), cursor positions included.
+ * Since the translated coordinates are clipped, a widget may be drawn
+ * partly outside of the display.
+ *
+ * @param  ssd1306_ptr a pointer to a ssd1306_t structure.
+ * @param  x           the display column of the x coordinate 0.
+ * @param  y           the display row of the y coordinate 0.
+ * @return the outcome of the function call.
+ */
+ssd1306_status_t
+ssd1306_set_origin(ssd1306_t *ssd1306_ptr, int16_t x, int16_t y);
+
+
+/**
+ * Sets the clip rectangle of the given display: pixels outside of it are
+ * left untouched by the following drawings. The rectangle is given in
+ * display coordinates, regardless of the origin, and cropped to the display.
+ * Primitives are clipped once before being drawn, so that their pixels are
+ * not checked individually (except for circle outlines crossing its edges),
+ * and are drawn as if the rectangle did not exist, only cut by its edges.
+ *
+ * @param  ssd1306_ptr a pointer to a ssd1306_t structure.
+ * @param  x           the first column of the rectangle.
+ * @param  y           the first row of the rectangle.
+ * @param  w           the width of the rectangle, greater than 0.
+ * @param  h           the height of the rectangle, greater than 0.
+ * @return the outcome of the function call.
+ */
+ssd1306_status_t
+ssd1306_set_clip(ssd1306_t *ssd1306_ptr, uint8_t x, uint8_t y,
+        uint8_t w, uint8_t h);
+
+
+/**
+ * Restricts the following drawings to the given rectangle, which becomes
+ * their origin as well: it is equivalent to ssd1306_set_origin(x, y) followed
+ * by ssd1306_set_clip(x, y, w, h). Widgets can thus be drawn into parts of
+ * the display without knowing where they lie. The whole display is restored
+ * by ssd1306_set_viewport(0, 0, SSD1306_PXL_WIDTH, SSD1306_PXL_HEIGHT).
+ *
+ * @param  ssd1306_ptr a pointer to a ssd1306_t structure.
+ * @param  x           the first column of the viewport.
+ * @param  y           the first row of the viewport.
+ * @param  w           the width of the viewport, greater than 0.
+ * @param  h           the height of the viewport, greater than 0.
+ * @return the outcome of the function call.
+ */
+ssd1306_status_t
+ssd1306_set_viewport(ssd1306_t *ssd1306_ptr, uint8_t x, uint8_t y,
+        uint8_t w, uint8_t h);
+
+
+/**
+ * Fills the entire display with desired color, or the clip rectangle if it
+ * is smaller (see ssd1306_set_clip). This function modifies only
  * the software buffer of the given ssd1306_ptr structure. It needs to be
  * followed by an ssd1306_update function call to take effect on the display.
  *
@@ -258,15 +761,54 @@ ssd1306_draw_pixel(ssd1306_t *ssd1306_ptr, uint8_t x, uint8_t y,
 
 
 /**
- * Draws the given character to the current cursor position. This function
+ * Sets how the following characters are drawn. In opaque mode (default),
+ * the whole glyph cell is painted: glyph background takes the opposite of the
+ * text color. In transparent mode, only glyph pixels are painted, which allows
+ * to overlay text on bitmaps. In XOR mode, glyph pixels invert the underlying
+ * ones regardless of the color, so that drawing the same text twice erases it.
+ *
+ * @param  ssd1306_ptr a pointer to a ssd1306_t structure.
+ * @param  mode        the text mode. Valid modes are offered by the
+ *                     ssd1306_text_mode_t enumeration.
+ * @return the outcome of the function call.
+ */
+ssd1306_status_t
+ssd1306_set_text_mode(ssd1306_t *ssd1306_ptr, ssd1306_text_mode_t mode);
+
+
+/**
+ * Sets how the pixels drawn by the following primitives, characters and
+ * bitmaps included, are combined with the software buffer. In copy mode
+ * (default), they take their color. In the other modes, white pixels are
+ * respectively lit, turned off or inverted, while black ones leave the buffer
+ * untouched: e.g. a cursor or a selection drawn in XOR mode is erased by
+ * drawing it again, without redrawing what lies below. The background of
+ * characters and bitmaps drawn opaque is combined likewise, in the opposite
+ * color. The inversion of the display color is accounted for, so that white
+ * pixels are always the lit ones.
+ *
+ * @param  ssd1306_ptr a pointer to a ssd1306_t structure.
+ * @param  rop         the raster operation. Valid operations are offered by
+ *                     the ssd1306_rop_t enumeration.
+ * @return the outcome of the function call.
+ */
+ssd1306_status_t
+ssd1306_set_rop(ssd1306_t *ssd1306_ptr, ssd1306_rop_t rop);
+
+
+/**
+ * Draws the given character to the current cursor position, according to
+ * the text mode (see ssd1306_set_text_mode). The cursor is moved right by
+ * the width of the glyph, which varies for proportional fonts. This function
  * modifies only the software buffer of the given ssd1306_ptr structure.
  * It needs to be followed by an ssd1306_update function call to take
  * effect on the display.
  *
  * @param  ssd1306_ptr a pointer to a ssd1306_t structure.
- * @param  ch          the character to draw.
- * @param  font_name   the font to use. Valid fonts are specified by the
- *                     ssd1306_font_name_t enumeration.
+ * @param  ch          the character to draw. SSD1306_WRONG_PARAMS is returned
+ *                     if the font has no glyph for it (see ssd1306_fonts.h).
+ * @param  font_name   the font to use. It must be enabled, otherwise
+ *                     SSD1306_WRONG_PARAMS is returned.
  * @param  color       color of the drawn character. Valid colors
  *                     are offered by the ssd1306_color_t enumeration.
  * @return the outcome of the function call.
@@ -317,6 +859,23 @@ ssd1306_draw_int(ssd1306_t *ssd1306_ptr, int32_t num, uint8_t base,
         ssd1306_font_name_t font_name, ssd1306_color_t color);
 
 
+/**
+ * Converts an integer to a string in the given base, as drawn by
+ * ssd1306_draw_int: digits above 9 are capital letters and only base 10
+ * numbers are signed, the other ones being converted as absolute values.
+ * Base 10 digits are found by subtracting powers of ten and power of two
+ * bases by shifting, so that no division is needed on cores lacking it.
+ * The string is not null terminated.
+ *
+ * @param  str_buf a buffer of at least SSD1306_INT_STR_SIZE characters.
+ * @param  num     the integer to convert.
+ * @param  base    the base of the string (2 to 32 supported).
+ * @return the number of characters written, 0 if the base is not supported.
+ */
+size_t
+ssd1306_format_int(char *str_buf, int32_t num, uint8_t base);
+
+
 /**
  * Draws a segment from (x0,y0) to (x1,y1). this function takes advantage
  * of the Bresenham's algorithm. No error is returned if the segment is
@@ -338,6 +897,47 @@ ssd1306_draw_line(ssd1306_t *ssd1306_ptr, uint8_t x0, uint8_t y0,
         uint8_t x1, uint8_t y1, ssd1306_color_t color);
 
 
+/**
+ * Draws a horizontal segment of w pixels from (x,y) to the right.
+ * Contrary to ssd1306_draw_line, the buffer is written a byte at a time.
+ * The segment is clipped to the display area. This function only modifies
+ * the software buffer of the given ssd1306_ptr structure. It needs to be
+ * followed by an ssd1306_update function call to take effect on the display.
+ *
+ * @param  ssd1306_ptr a pointer to a ssd1306_t structure.
+ * @param  x           the x coordinate of the leftmost point.
+ * @param  y           the y coordinate of the segment.
+ * @param  w           the length of the segment in pixels.
+ * @param  color       color of the drawn pixels. Valid colors
+ *                     are offered by the ssd1306_color_t enumeration.
+ * @return the outcome of the function call.
+ */
+ssd1306_status_t
+ssd1306_draw_hline(ssd1306_t *ssd1306_ptr, uint8_t x, uint8_t y, uint8_t w,
+        ssd1306_color_t color);
+
+
+/**
+ * Draws a vertical segment of h pixels from (x,y) downwards.
+ * The buffer is written a byte at a time: each page holding part of the
+ * segment is modified once. The segment is clipped to the display area.
+ * This function only modifies the software buffer of the given ssd1306_ptr
+ * structure. It needs to be followed by an ssd1306_update function call
+ * to take effect on the display.
+ *
+ * @param  ssd1306_ptr a pointer to a ssd1306_t structure.
+ * @param  x           the x coordinate of the segment.
+ * @param  y           the y coordinate of the topmost point.
+ * @param  h           the length of the segment in pixels.
+ * @param  color       color of the drawn pixels. Valid colors
+ *                     are offered by the ssd1306_color_t enumeration.
+ * @return the outcome of the function call.
+ */
+ssd1306_status_t
+ssd1306_draw_vline(ssd1306_t *ssd1306_ptr, uint8_t x, uint8_t y, uint8_t h,
+        ssd1306_color_t color);
+
+
 /**
  * Draws a rectangle whose top-left vertex is at (x,y), with width w and
  * height h. This function only modifies the software buffer of the given
@@ -360,7 +960,8 @@ ssd1306_draw_rect(ssd1306_t *ssd1306_ptr, uint8_t x, uint8_t y,
 
 /**
  * Draws a filled rectangle whose top-left vertex is at (x,y), with width w
- * and height h. This function only modifies the software buffer of the given
+ * and height h. Each page holding part of the rectangle is filled once, a byte
+ * at a time. This function only modifies the software buffer of the given
  * ssd1306_ptr structure. It needs to be followed by an ssd1306_update
  * function call to take effect on the display.
  *
@@ -375,7 +976,7 @@ ssd1306_draw_rect(ssd1306_t *ssd1306_ptr, uint8_t x, uint8_t y,
  */
 ssd1306_status_t
 ssd1306_draw_filled_rect(ssd1306_t *ssd1306_ptr, uint8_t x, uint8_t y,
-        uint8_t w, uint8_t h, ssd1306_color_t color) ;
+        uint8_t w, uint8_t h, ssd1306_color_t color);
 
 
 /**
@@ -400,7 +1001,9 @@ ssd1306_draw_circle(ssd1306_t *ssd1306_ptr, uint8_t x0, uint8_t y0, uint16_t r,
 
 /**
  * Draws a filled circle whose center is at (x0,y0), with radius r.
- * This function takes advantage of the Bresenham's (midpoint circle) algorithm.
+ * This function takes advantage of the midpoint circle algorithm to fill
+ * each row of the circle by means of a single horizontal span, so that
+ * each pixel is written exactly once.
  * This function only modifies the software buffer of the given
  * ssd1306_ptr structure. It needs to be followed by an ssd1306_update
  * function call to take effect on the display.
@@ -441,7 +1044,9 @@ ssd1306_draw_triangle(ssd1306_t *ssd1306_ptr, uint8_t x1, uint8_t y1,
 
 
 /**
- * Draws a filled triangle given its three vertices.
+ * Draws a filled triangle given its three vertices. Each row of the
+ * triangle is filled by means of a single horizontal span between its
+ * edges, so that each pixel is written exactly once.
  * This function only modifies the software buffer of the given
  * ssd1306_ptr structure. It needs to be followed by an ssd1306_update
  * function call to take effect on the display.
@@ -484,11 +1089,80 @@ ssd1306_draw_bitmap(ssd1306_t *ssd1306_ptr, uint8_t x, uint8_t y,
         const unsigned char* bitmap, uint8_t w, uint8_t h, ssd1306_color_t color);
 
 
+/**
+ * Draws the given bitmap encoded in the same layout of the display ram:
+ * (h + 7) / 8 pages of w bytes each, the LSB of each byte being the top row
+ * of its page. Bytes are shifted into place rather than drawn pixel by
+ * pixel, and pages drawn opaque at a y multiple of 8 are plainly copied.
+ * Such bitmaps are generated by tools/ssd1306_bmpconv.py.
+ * This function only modifies the software buffer of the given
+ * ssd1306_ptr structure. It needs to be followed by an ssd1306_update
+ * function call to take effect on the display.
+ *
+ * @param  ssd1306_ptr a pointer to a ssd1306_t structure.
+ * @param  x           the x coordinate where to start to draw.
+ * @param  y           the y coordinate where to start to draw.
+ * @param  bitmap      a pointer to the page-major bitmap.
+ * @param  w           the width of the bitmap in pixels.
+ * @param  h           the height of the bitmap in pixels.
+ * @param  color       color of the set pixels. Valid colors
+ *                     are offered by the ssd1306_color_t enumeration.
+ * @param  mode        how the bitmap is combined with the buffer. Valid
+ *                     modes are offered by the ssd1306_text_mode_t
+ *                     enumeration, with the same meaning as for text.
+ * @return the outcome of the function call.
+ */
+ssd1306_status_t
+ssd1306_draw_page_bitmap(ssd1306_t *ssd1306_ptr, uint8_t x, uint8_t y,
+        const uint8_t *bitmap, uint8_t w, uint8_t h, ssd1306_color_t color,
+        ssd1306_text_mode_t mode);
+
+
+/**
+ * Draws a page-major bitmap (see ssd1306_draw_page_bitmap) compressed by
+ * run-length encoding. The bytes of its pages are stored as a sequence of
+ * runs, each one starting with a control byte n:
+ *  - 0x00 to 0x7F: n + 1 literal bytes follow;
+ *  - 0x80 to 0xFF: the following byte is repeated n - 126 times.
+ * Runs may span across pages. The bitmap is decoded a page at a time
+ * straight into the software buffer, without any intermediate copy of
+ * the whole image. Such bitmaps are generated by tools/ssd1306_bmpconv.py.
+ * This function only modifies the software buffer of the given
+ * ssd1306_ptr structure. It needs to be followed by an ssd1306_update
+ * function call to take effect on the display.
+ *
+ * @param  ssd1306_ptr a pointer to a ssd1306_t structure.
+ * @param  x           the x coordinate where to start to draw.
+ * @param  y           the y coordinate where to start to draw.
+ * @param  data        a pointer to the compressed bitmap.
+ * @param  data_len    the length of the compressed bitmap in bytes.
+ * @param  w           the width of the bitmap in pixels.
+ * @param  h           the height of the bitmap in pixels.
+ * @param  color       color of the set pixels. Valid colors
+ *                     are offered by the ssd1306_color_t enumeration.
+ * @param  mode        how the bitmap is combined with the buffer. Valid
+ *                     modes are offered by the ssd1306_text_mode_t
+ *                     enumeration, with the same meaning as for text.
+ * @return the outcome of the function call. SSD1306_WRONG_PARAMS is
+ *         returned if the data end before the bitmap, in which case the
+ *         pages decoded so far have been drawn.
+ */
+ssd1306_status_t
+ssd1306_draw_rle_bitmap(ssd1306_t *ssd1306_ptr, uint8_t x, uint8_t y,
+        const uint8_t *data, size_t data_len, uint8_t w, uint8_t h,
+        ssd1306_color_t color, ssd1306_text_mode_t mode);
+
+
 /**
  * The update function allows to flush the internal software buffer
  * of the given ssd1306_ptr object to the display ram. The whole GDDRAM
  * is written when this function is called. It is useful to let *_draw_*
  * functions take effect on the screen.
+ * If frame diffing is enabled, only the runs of bytes differing from
+ * the ones last transmitted are sent, each within its own address window,
+ * so that redrawing an unchanged frame from scratch costs no transmission.
+ * In page mode, the software buffer does not hold the whole display and
+ * SSD1306_WRONG_PARAMS is returned: see ssd1306_render instead.
  *
  * @param  ssd1306_ptr a pointer to a ssd1306_t structure.
  * @return the outcome of the function call.
@@ -497,6 +1171,266 @@ ssd1306_status_t
 ssd1306_update(ssd1306_t *ssd1306_ptr);
 
 
+/**
+ * Incremental version of the update function. Only the columns modified
+ * by *_draw_* functions since the last update are flushed to the display
+ * ram. For each dirty page, the column and page address window is narrowed
+ * to the modified span so that unchanged bytes are not transmitted.
+ * If frame diffing is enabled, the spans are further narrowed as for
+ * ssd1306_update. As ssd1306_update, it is not available in page mode.
+ *
+ * @param  ssd1306_ptr a pointer to a ssd1306_t structure.
+ * @return the outcome of the function call.
+ */
+ssd1306_status_t
+ssd1306_update_dirty(ssd1306_t *ssd1306_ptr);
+
+
+/**
+ * Renders the whole display by means of the given draw function, starting
+ * from a cleared software buffer, and flushes it to the display ram.
+ * In page mode, the display is rendered a band of SSD1306_BUFFER_PAGES pages
+ * at a time: the draw function is invoked once for each band, drawing
+ * functions only modify the pages of the band and each band is flushed as
+ * soon as it has been rendered. The draw function must thus draw the same
+ * content each time it is invoked: the cursor position, the text and raster
+ * modes, the origin and the clip rectangle are restored before each band.
+ * Otherwise, it is invoked only once and the whole buffer is flushed by
+ * means of ssd1306_update.
+ *
+ * @param  ssd1306_ptr a pointer to a ssd1306_t structure.
+ * @param  draw        the function drawing the display content. If NULL,
+ *                     the display is cleared.
+ * @param  ctx         the user context given to the draw function.
+ * @return the outcome of the function call.
+ */
+ssd1306_status_t
+ssd1306_render(ssd1306_t *ssd1306_ptr, ssd1306_draw_cb_t draw, void *ctx);
+
+
+/**
+ * Enables double buffering by providing a second software buffer of
+ * SSD1306_BUFFER_SIZE bytes, owned by the application. The current content
+ * is copied into it once. Then, each update submits the back buffer and
+ * exchanges it with the front buffer without copying any byte: the new back
+ * buffer holds the frame preceding the submitted one, hence each frame
+ * should be drawn entirely. Passing NULL disables double buffering.
+ * Must be called after ssd1306_init.
+ *
+ * @param  ssd1306_ptr a pointer to a ssd1306_t structure.
+ * @param  back_buffer a pointer to an array of SSD1306_BUFFER_SIZE bytes,
+ *                     or NULL.
+ * @return the outcome of the function call.
+ */
+ssd1306_status_t
+ssd1306_set_back_buffer(ssd1306_t *ssd1306_ptr, uint8_t *back_buffer);
+
+
+/**
+ * Writes the given page-major frame (see ssd1306_draw_page_bitmap) of
+ * SSD1306_FRAME_SIZE bytes straight to the display ram, bypassing the
+ * software buffer. The frame is sent as it is, e.g. from flash memory,
+ * which allows to play animations without drawing them.
+ * Since the display no longer shows the software buffer, the whole buffer
+ * is marked as modified: the next update restores it on the display.
+ *
+ * @param  ssd1306_ptr a pointer to a ssd1306_t structure.
+ * @param  frame       a pointer to the page-major frame.
+ * @return the outcome of the function call.
+ */
+ssd1306_status_t
+ssd1306_stream_frame(ssd1306_t *ssd1306_ptr, const uint8_t *frame);
+
+
+/**
+ * Streams a page-major frame produced by the given function straight to
+ * the display ram, bypassing the software buffer. The frame is requested
+ * in chunks of SSD1306_STREAM_CHUNK_SIZE bytes, which are sent as soon as
+ * they are produced: frames can be read from an external memory or
+ * generated on the fly without ever being held in ram as a whole.
+ * Since the display no longer shows the software buffer, the whole buffer
+ * is marked as modified: the next update restores it on the display.
+ *
+ * @param  ssd1306_ptr a pointer to a ssd1306_t structure.
+ * @param  producer    the function producing the frame.
+ * @param  ctx         the user context given to the producer.
+ * @return the outcome of the function call.
+ */
+ssd1306_status_t
+ssd1306_stream(ssd1306_t *ssd1306_ptr, ssd1306_producer_t producer, void *ctx);
+
+
+/**
+ * Returns whether a non-blocking update of the given display is in progress.
+ * Always returns false if SSD1306_ENABLE_ASYNC is not defined.
+ *
+ * @param  ssd1306_ptr a pointer to a ssd1306_t structure.
+ * @return true if the software buffer is being transmitted.
+ */
+bool
+ssd1306_is_busy(const ssd1306_t *ssd1306_ptr);
+
+
+/**
+ * Returns whether the software buffer of the given display has been
+ * modified since the last update, i.e. whether ssd1306_update_dirty
+ * has something to transmit.
+ *
+ * @param  ssd1306_ptr a pointer to a ssd1306_t structure.
+ * @return true if at least one page has a dirty span.
+ */
+bool
+ssd1306_is_dirty(const ssd1306_t *ssd1306_ptr);
+
+
+#ifdef SSD1306_ENABLE_ASYNC
+
+/**
+ * Non-blocking version of the update function. The transmission of the
+ * whole software buffer is started and the function returns immediately.
+ * The given callback is invoked once the GDDRAM has been written or an
+ * error occurred. The software buffer must not be modified until then
+ * (see ssd1306_is_busy). It requires the ssd1306_i2c_write_async port hook.
+ * Queued commands (see ssd1306_begin_batch) are sent along with the first
+ * span, so that no blocking transaction is ever made. Over spi, the
+ * command and data bytes of each transaction are chained non-blocking
+ * transfers as well (see ssd1306_spi.h).
+ * If there is nothing to be sent, no callback is invoked. If the update
+ * fails, the spans not transmitted are marked as dirty again by the next
+ * update, since the callback may be invoked from interrupt context.
+ *
+ * @param  ssd1306_ptr a pointer to a ssd1306_t structure.
+ * @param  callback    function called at the end of the update. May be NULL.
+ * @param  ctx         user context passed to the callback.
+ * @return the outcome of the transmission start.
+ */
+ssd1306_status_t
+ssd1306_update_async(ssd1306_t *ssd1306_ptr, ssd1306_callback_t callback,
+        void *ctx);
+
+
+/**
+ * Non-blocking version of the ssd1306_update_dirty function. Only the spans
+ * modified since the last update are transmitted. See ssd1306_update_async.
+ *
+ * @param  ssd1306_ptr a pointer to a ssd1306_t structure.
+ * @param  callback    function called at the end of the update. May be NULL.
+ * @param  ctx         user context passed to the callback.
+ * @return the outcome of the transmission start.
+ */
+ssd1306_status_t
+ssd1306_update_dirty_async(ssd1306_t *ssd1306_ptr, ssd1306_callback_t callback,
+        void *ctx);
+
+
+/**
+ * Must be called by the port layer when a transaction started by
+ * ssd1306_i2c_write_async is over, possibly from interrupt context.
+ * It starts the next transaction of the update, if any.
+ *
+ * @param ctx    the context given to ssd1306_i2c_write_async.
+ * @param status the outcome of the transaction.
+ */
+void
+ssd1306_i2c_write_async_complete(void *ctx, ssd1306_status_t status);
+
+#endif
+
+
+#ifdef SSD1306_ENABLE_STATS
+
+/**
+ * Sets the function called around each transaction and each update of
+ * the given display, e.g. to timestamp them for a logic analyzer or to
+ * forward them to telemetry. Since ssd1306_init clears it, it must be set
+ * after the initialization.
+ *
+ * @param  ssd1306_ptr a pointer to a ssd1306_t structure.
+ * @param  trace       the trace hook. NULL disables tracing.
+ * @param  ctx         user context passed to the trace hook.
+ * @return the outcome of the function call.
+ */
+ssd1306_status_t
+ssd1306_set_trace(ssd1306_t *ssd1306_ptr, ssd1306_trace_t trace, void *ctx);
+
+
+/**
+ * Resets the statistics of the given display, e.g. after sending them to
+ * telemetry. Counters wrap around if they are never reset.
+ *
+ * @param  ssd1306_ptr a pointer to a ssd1306_t structure.
+ * @return the outcome of the function call.
+ */
+ssd1306_status_t
+ssd1306_reset_stats(ssd1306_t *ssd1306_ptr);
+
+#endif
+
+
+#ifdef SSD1306_ENABLE_LOCKING
+
+/**
+ * Sets the lock guarding the software buffer of the given display, which
+ * is shared between the threads drawing into it and the one flushing it by
+ * means of ssd1306_update_snapshot. Since ssd1306_init clears it, it must
+ * be set after the initialization.
+ * Transactions are also serialized per i2c channel by the
+ * ssd1306_i2c_lock and ssd1306_i2c_unlock port hooks, which allows
+ * displays sharing a bus to be driven from different threads.
+ *
+ * @param  ssd1306_ptr a pointer to a ssd1306_t structure.
+ * @param  lock        the lock function. NULL disables locking.
+ * @param  ctx         user context passed to the lock function.
+ * @return the outcome of the function call.
+ */
+ssd1306_status_t
+ssd1306_set_lock(ssd1306_t *ssd1306_ptr, ssd1306_lock_t lock, void *ctx);
+
+
+/**
+ * Acquires the lock of the software buffer of the given display. Threads
+ * drawing into a display flushed by another one must hold it around each
+ * sequence of drawing functions, e.g. a whole frame, so that no partial
+ * frame is ever sent. It has no effect if no lock has been set.
+ *
+ * @param  ssd1306_ptr a pointer to a ssd1306_t structure.
+ */
+void
+ssd1306_lock(ssd1306_t *ssd1306_ptr);
+
+
+/**
+ * Releases the lock acquired by ssd1306_lock.
+ *
+ * @param  ssd1306_ptr a pointer to a ssd1306_t structure.
+ */
+void
+ssd1306_unlock(ssd1306_t *ssd1306_ptr);
+
+
+/**
+ * Thread-safe version of the ssd1306_update_dirty function. The dirty spans
+ * are copied into the given snapshot and marked as clean with the software
+ * buffer locked, then they are sent from the snapshot with the lock
+ * released: threads drawing the next frame only wait for the copy, never
+ * for the bus. On failure, the spans not transmitted are marked as dirty
+ * again. The buffers are not exchanged even if double buffering is enabled,
+ * since the snapshot plays the role of the front buffer.
+ * The display must be updated only by this function, from a single thread.
+ * Functions sending commands share the command queue with it, hence they
+ * must be called from the same thread. It is not available in page mode.
+ *
+ * @param  ssd1306_ptr a pointer to a ssd1306_t structure.
+ * @param  snapshot    a buffer of SSD1306_BUFFER_SIZE bytes, which may be
+ *                     shared by displays updated from the same thread.
+ * @return the outcome of the function call.
+ */
+ssd1306_status_t
+ssd1306_update_snapshot(ssd1306_t *ssd1306_ptr, uint8_t *snapshot);
+
+#endif
+
+
 /**
  * Clears the display by resetting color inversion and filling the screen
  * with black pixels.
@@ -520,7 +1454,11 @@ ssd1306_clear_buffer(ssd1306_t *ssd1306_ptr);
 
 
 /**
- * Initializes the ssd1306 i2c display.
+ * Initializes the ssd1306 i2c display. The i2c peripheral is initialized
+ * by means of the ssd1306_i2c_init port hook, while the
+ * ssd1306_i2c_max_transfer_size one tells the maximum number of bytes the
+ * port can send within a single transaction. The whole configuration of the
+ * display is sent within a single transaction, then its ram is cleared.
  *
  * @param  ssd1306_ptr a pointer to a ssd1306_t structure.
  * @param  i2c_channel the i2c peripheral identifier to route requests to
@@ -533,6 +1471,50 @@ ssd1306_status_t
 ssd1306_init(ssd1306_t *ssd1306_ptr, uint8_t i2c_channel, uint8_t i2c_addr);
 
 
+/**
+ * Initializes the ssd1306 i2c display after a restart of the microcontroller
+ * which did not power cycle the display (e.g. a watchdog reset), which thus
+ * kept its configuration and the frame it is showing. Neither the configuration
+ * nor the clear of the display ram are sent: a short sequence only disables
+ * scrolling and restores normal colors and start line 0, without blanking
+ * the display. The software buffer is cleared and marked as dirty, so that
+ * the first update (incremental or not) replaces the whole frame.
+ * The application must know that the display stayed powered (e.g. by
+ * means of the reset cause of the microcontroller): otherwise, the display
+ * remains unconfigured.
+ *
+ * @param  ssd1306_ptr a pointer to a ssd1306_t structure.
+ * @param  i2c_channel the i2c peripheral identifier.
+ * @param  i2c_addr    the i2c address of the target ssd1306 display.
+ * @return the outcome of the function call.
+ */
+ssd1306_status_t
+ssd1306_init_warm(ssd1306_t *ssd1306_ptr, uint8_t i2c_channel,
+        uint8_t i2c_addr);
+
+
+/**
+ * Initializes a display connected through the given transport instead of
+ * the i2c port hooks (e.g. ssd1306_spi_transport, see ssd1306_spi.h).
+ * Apart from the way bytes are sent, the display behaves as if it were
+ * initialized by ssd1306_init.
+ *
+ * @param  ssd1306_ptr   a pointer to a ssd1306_t structure.
+ * @param  transport     the operations of the transport, which must
+ *                       outlive the display.
+ * @param  transport_ctx the context given to each operation.
+ * @param  channel       the bus identifier. Displays sharing a channel are
+ *                       served one at a time by ssd1306_sched_t.
+ * @param  warm          if true, the display is initialized as done by
+ *                       ssd1306_init_warm, otherwise as by ssd1306_init.
+ * @return the outcome of the function call.
+ */
+ssd1306_status_t
+ssd1306_init_transport(ssd1306_t *ssd1306_ptr,
+        const ssd1306_transport_t *transport, void *transport_ctx,
+        uint8_t channel, bool warm);
+
+
 /* C++ detection */
 #ifdef __cplusplus
     }
@@ -0,0 +1,147 @@
+/**
+ * @file   ssd1306_field.h
+ * @brief  SSD1306 OLED display C library.
+ *
+ * @copyright
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  any later version.
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ *  GNU General Public License for more details.
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program. If not, see <http://www.gnu.org/licenses/>.
+ *
+ * @author Giovanni Scotti
+ */
+
+#ifndef __SSD1306_FIELD_H__
+#define __SSD1306_FIELD_H__
+
+/* C++ detection */
+#ifdef __cplusplus
+    extern "C" {
+#endif
+
+
+#include "ssd1306_driver.h"
+
+
+// A field redraws single characters, hence it needs the whole software buffer.
+#ifndef SSD1306_ENABLE_PAGE_MODE
+
+#ifndef SSD1306_FIELD_MAX_WIDTH
+#define SSD1306_FIELD_MAX_WIDTH 12 /// Max number of characters of a field.
+#endif
+#ifndef SSD1306_FIELD_OVERFLOW_CHAR
+#define SSD1306_FIELD_OVERFLOW_CHAR '#' /// Fills a field too narrow for its value.
+#endif
+
+
+/**
+ * Alignments of the value within a numeric field.
+ */
+typedef enum {
+    SSD1306_FIELD_ALIGN_LEFT  = 0, /*!< Left aligned, padded with spaces. */
+    SSD1306_FIELD_ALIGN_RIGHT = 1, /*!< Right aligned, padded with spaces. */
+    SSD1306_FIELD_ZERO_PAD    = 2  /*!< Right aligned, padded with zeros after the sign. */
+} ssd1306_field_align_t;
+
+
+/**
+ * Numeric field of a fixed number of characters, drawn at a fixed position
+ * of a display. Values are integers, shown with a fixed number of decimals
+ * as fixed-point numbers. The characters currently drawn are kept in text,
+ * so that setting a new value redraws only the characters which change.
+ */
+typedef struct {
+    ssd1306_t            *display;   /*!< The display the field draws on. */
+    ssd1306_font_name_t  font_name;  /*!< Font of the field, fixed-width. */
+    ssd1306_color_t      color;      /*!< Color of the characters. */
+    ssd1306_field_align_t align;     /*!< Alignment of the value. */
+    uint8_t x;                       /*!< Left column of the field. */
+    uint8_t y;                       /*!< Top row of the field. */
+    uint8_t width;                   /*!< Number of characters. */
+    uint8_t decimals;                /*!< Number of fractional digits. */
+    uint8_t cell_width;              /*!< Width of a character in pixels. */
+    char    text[SSD1306_FIELD_MAX_WIDTH]; /*!< Characters drawn, '\0' if none. */
+} ssd1306_field_t;
+
+
+/**
+ * Initializes a numeric field on the given display. The field is right
+ * aligned without decimals (see ssd1306_field_set_format) and nothing is
+ * drawn until its first value is set. Its position is given as for
+ * ssd1306_goto_xy, hence it is relative to the origin of the display
+ * when the field is drawn. If the initialization fails, the field is left
+ * cleared and the other field functions return SSD1306_NOINIT.
+ *
+ * @param  field_ptr   a pointer to a ssd1306_field_t structure.
+ * @param  ssd1306_ptr a pointer to an initialized ssd1306_t structure.
+ * @param  x           the left column of the field.
+ * @param  y           the top row of the field.
+ * @param  width       the number of characters, from 1 to
+ *                     SSD1306_FIELD_MAX_WIDTH.
+ * @param  font_name   the font to use. It must be enabled and fixed-width,
+ *                     and hold the digits, '-', '.', ' ' and
+ *                     SSD1306_FIELD_OVERFLOW_CHAR.
+ * @param  color       color of the characters, drawn opaque.
+ * @return the outcome of the function call.
+ */
+ssd1306_status_t
+ssd1306_field_init(ssd1306_field_t *field_ptr, ssd1306_t *ssd1306_ptr,
+        uint8_t x, uint8_t y, uint8_t width, ssd1306_font_name_t font_name,
+        ssd1306_color_t color);
+
+
+/**
+ * Sets the number of decimals and the alignment of the given field, which
+ * is entirely redrawn by the next value set.
+ *
+ * @param  field_ptr a pointer to a ssd1306_field_t structure.
+ * @param  decimals  the number of fractional digits. If not 0, at most the
+ *                   width minus 2 (integer digit and decimal point).
+ * @param  align     the alignment of the value.
+ * @return the outcome of the function call.
+ */
+ssd1306_status_t
+ssd1306_field_set_format(ssd1306_field_t *field_ptr, uint8_t decimals,
+        ssd1306_field_align_t align);
+
+
+/**
+ * Draws the given value into the software buffer, redrawing only the
+ * characters which differ from the ones already drawn. With d decimals,
+ * the value is in units of 10^-d, e.g. 1234 is shown as 12.34 with two
+ * decimals. A value which does not fit the field is shown as a row of
+ * SSD1306_FIELD_OVERFLOW_CHAR. The redrawn characters are marked as dirty:
+ * they can be transmitted by means of any update function.
+ *
+ * @param  field_ptr a pointer to a ssd1306_field_t structure.
+ * @param  value     the value to draw.
+ * @return the outcome of the function call.
+ */
+ssd1306_status_t
+ssd1306_field_set_int(ssd1306_field_t *field_ptr, int32_t value);
+
+
+/**
+ * Forgets the characters drawn by the given field, e.g. after the software
+ * buffer has been cleared, so that the next value set redraws all of them.
+ *
+ * @param  field_ptr a pointer to a ssd1306_field_t structure.
+ */
+void
+ssd1306_field_invalidate(ssd1306_field_t *field_ptr);
+
+#endif
+
+
+/* C++ detection */
+#ifdef __cplusplus
+    }
+#endif
+
+#endif // __SSD1306_FIELD_H__
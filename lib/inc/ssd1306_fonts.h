@@ -37,17 +37,47 @@ typedef enum {
     FONT_7X10  = 0,
     FONT_11X18 = 1,
     FONT_16X26 = 2,
-    FONT_COUNT = 3
+    FONT_7X10P = 3, /*!< Proportional version of FONT_7X10. */
+    FONT_COUNT = 4
 } ssd1306_font_name_t;
 
 
+#define SSD1306_FONT_FIRST_CHAR ' '  /// First character of the fonts.
+#define SSD1306_FONT_LAST_CHAR  '~'  /// Last character of the fonts.
+#define SSD1306_GLYPH_MISSING   0xFF /// Index of a glyph left out of a subset.
+
+/// Tells whether the character c belongs to the range [first, last].
+/// Helps writing glyph predicates (see ssd1306_fonts.c).
+#define SSD1306_GLYPH_RANGE(c, first, last) ((c) >= (first) && (c) <= (last))
+
+
 /**
- * Structure for storing font data.
+ * Structure for storing font data. Each glyph is available both row by row
+ * (font_map) and column by column (font_cols). The latter matches the layout
+ * of the display ram: a glyph is made of (font_height + 7) / 8 pages of
+ * font_width bytes, the LSB of each byte being the top row of the page.
+ * Column-major maps are generated by tools/ssd1306_fontconv.py.
+ *
+ * Proportional fonts provide the width of each glyph and its offset in
+ * font_cols, their font_width being the width of the widest glyph. Such
+ * fonts are only available column by column, hence font_map is NULL.
+ *
+ * Fonts may hold a subset of the characters from SSD1306_FONT_FIRST_CHAR to
+ * SSD1306_FONT_LAST_CHAR, selected at compile time. In this case, glyphs are
+ * stored densely: glyph_index gives the position of the glyph of each
+ * character, SSD1306_GLYPH_MISSING if it has been left out. Proportional
+ * fonts keep a width and an offset for each character instead, the width
+ * of missing glyphs being 0. Row-major maps always hold all the characters,
+ * but they are linked only if ENABLE_FONT_ROW_MAPS is defined.
  */
 typedef struct {
-    const uint8_t font_width;  /*!< Font width in pixels. */
-    const uint8_t font_height; /*!< Font height in pixels. */
-    const void    *font_map;   /*!< Pointer to font data array. */
+    const uint8_t  font_width;     /*!< Font width in pixels. */
+    const uint8_t  font_height;    /*!< Font height in pixels. */
+    const void     *font_map;      /*!< Pointer to font data array. */
+    const uint8_t  *font_cols;     /*!< Pointer to column-major font data array. */
+    const uint8_t  *glyph_widths;  /*!< Width of each glyph, NULL if fixed width. */
+    const uint16_t *glyph_offsets; /*!< Offset of each glyph, NULL if fixed width. */
+    const uint8_t  *glyph_index;   /*!< Index of each glyph, NULL if all glyphs are present. */
 } ssd1306_font_t;
 
 
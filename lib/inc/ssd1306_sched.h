@@ -0,0 +1,159 @@
+/**
+ * @file   ssd1306_sched.h
+ * @brief  SSD1306 OLED display C library.
+ *
+ * @copyright
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  any later version.
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ *  GNU General Public License for more details.
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program. If not, see <http://www.gnu.org/licenses/>.
+ *
+ * @author Giovanni Scotti
+ */
+
+#ifndef __SSD1306_SCHED_H__
+#define __SSD1306_SCHED_H__
+
+/* C++ detection */
+#ifdef __cplusplus
+    extern "C" {
+#endif
+
+
+#include "ssd1306_driver.h"
+
+
+#ifdef SSD1306_ENABLE_ASYNC
+
+#ifndef SSD1306_SCHED_MAX_DISPLAYS
+#define SSD1306_SCHED_MAX_DISPLAYS 8 /// Max number of displays of a scheduler.
+#endif
+
+
+struct ssd1306_sched_s;
+
+
+/**
+ * Display handled by a scheduler.
+ */
+typedef struct {
+    ssd1306_t              *display;     /*!< The display itself. */
+    struct ssd1306_sched_s *sched;       /*!< Owner of the slot. */
+    uint8_t                bus;          /*!< Index of the bus of the display. */
+    volatile bool          queued;       /*!< A frame has been submitted. */
+    ssd1306_status_t       last_status;  /*!< Outcome of the last frame. */
+} ssd1306_sched_slot_t;
+
+
+/**
+ * i2c channel shared by one or more displays of a scheduler.
+ */
+typedef struct {
+    uint8_t       channel;               /*!< i2c channel of the bus. */
+    uint8_t       cursor;                /*!< Next slot to be served. */
+    volatile bool active;                /*!< A frame is being sent. */
+} ssd1306_sched_bus_t;
+
+
+/**
+ * Multi-display scheduler. Frames submitted for different i2c channels are
+ * transmitted in parallel, while displays sharing the same channel are served
+ * back to back in round-robin order: each submission sends one frame, hence
+ * no display can starve the others of its bus. The next transfer of a bus
+ * is started straight from the completion of the previous one.
+ */
+typedef struct ssd1306_sched_s {
+    ssd1306_sched_slot_t slots[SSD1306_SCHED_MAX_DISPLAYS]; /*!< Displays. */
+    ssd1306_sched_bus_t  buses[SSD1306_SCHED_MAX_DISPLAYS]; /*!< Channels. */
+    uint8_t              num_slots;      /*!< Number of displays. */
+    uint8_t              num_buses;      /*!< Number of distinct channels. */
+    ssd1306_callback_t   callback;       /*!< Frame completion callback. */
+} ssd1306_sched_t;
+
+
+/**
+ * Initializes an empty scheduler. The given callback is invoked at the end
+ * of each submitted frame, possibly from interrupt context, with the status
+ * of the frame and the related ssd1306_t structure as context.
+ *
+ * @param  sched_ptr a pointer to a ssd1306_sched_t structure.
+ * @param  callback  frame completion callback, it can be NULL.
+ * @return the outcome of the function call.
+ */
+ssd1306_status_t
+ssd1306_sched_init(ssd1306_sched_t *sched_ptr, ssd1306_callback_t callback);
+
+
+/**
+ * Hands an initialized display over to the scheduler. From now on, its
+ * updates should only be submitted by means of the scheduler.
+ *
+ * @param  sched_ptr   a pointer to a ssd1306_sched_t structure.
+ * @param  ssd1306_ptr a pointer to an initialized ssd1306_t structure.
+ * @return the outcome of the function call. SSD1306_WRONG_PARAMS is
+ *         returned if the scheduler is full or the display already added.
+ */
+ssd1306_status_t
+ssd1306_sched_add(ssd1306_sched_t *sched_ptr, ssd1306_t *ssd1306_ptr);
+
+
+/**
+ * Submits the current frame of the given display: its dirty spans are
+ * sent as soon as its bus is free. The software buffer must not be drawn
+ * until the frame is over (see ssd1306_sched_is_pending), unless a back
+ * buffer is set and the frame has already been started.
+ *
+ * @param  sched_ptr   a pointer to a ssd1306_sched_t structure.
+ * @param  ssd1306_ptr a pointer to a display added to the scheduler.
+ * @return the outcome of the function call.
+ */
+ssd1306_status_t
+ssd1306_sched_submit(ssd1306_sched_t *sched_ptr, ssd1306_t *ssd1306_ptr);
+
+
+/**
+ * Submits the current frame of all the dirty displays of the scheduler.
+ *
+ * @param  sched_ptr a pointer to a ssd1306_sched_t structure.
+ * @return the outcome of the function call.
+ */
+ssd1306_status_t
+ssd1306_sched_submit_all(ssd1306_sched_t *sched_ptr);
+
+
+/**
+ * Returns whether a frame of the given display is queued or being sent.
+ *
+ * @param  sched_ptr   a pointer to a ssd1306_sched_t structure.
+ * @param  ssd1306_ptr a pointer to a display added to the scheduler.
+ * @return true if the frame is not over yet.
+ */
+bool
+ssd1306_sched_is_pending(const ssd1306_sched_t *sched_ptr,
+        const ssd1306_t *ssd1306_ptr);
+
+
+/**
+ * Returns whether all the submitted frames are over.
+ *
+ * @param  sched_ptr a pointer to a ssd1306_sched_t structure.
+ * @return true if no frame is queued or being sent on any bus.
+ */
+bool
+ssd1306_sched_is_idle(const ssd1306_sched_t *sched_ptr);
+
+#endif
+
+
+/* C++ detection */
+#ifdef __cplusplus
+    }
+#endif
+
+#endif // __SSD1306_SCHED_H__
@@ -0,0 +1,96 @@
+/**
+ * @file   ssd1306_spi.h
+ * @brief  SSD1306 OLED display C library.
+ *
+ * @copyright
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  any later version.
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ *  GNU General Public License for more details.
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program. If not, see <http://www.gnu.org/licenses/>.
+ *
+ * @author Giovanni Scotti
+ */
+
+#ifndef __SSD1306_SPI_H__
+#define __SSD1306_SPI_H__
+
+/* C++ detection */
+#ifdef __cplusplus
+    extern "C" {
+#endif
+
+
+#include "ssd1306_driver.h"
+
+
+#ifdef SSD1306_ENABLE_SPI
+
+/**
+ * Transport driving a display over 4-wire spi. Control bytes do not go on
+ * the wire: command bytes are sent with the D/C line low and display ram
+ * bytes with the D/C line high. Its context is the display, whose channel
+ * selects the spi peripheral (and its D/C, CS and RES lines) by means of
+ * the following port hooks, defined in ssd1306_config.c:
+ *
+ * - ssd1306_spi_init(channel), which sets up the peripheral and pulses
+ *   the RES line. It must tolerate being called more than once.
+ * - ssd1306_spi_write(channel, data, data_ptr, data_size), which sends
+ *   the bytes with the D/C line high if data is true, low otherwise,
+ *   while asserting the CS line.
+ * - ssd1306_spi_write_async(channel, data, data_ptr, data_size, ctx), its
+ *   non-blocking version, which reports the end of the transfer by calling
+ *   ssd1306_spi_write_async_complete with ctx. Only with SSD1306_ENABLE_ASYNC.
+ *
+ * During non-blocking updates, each transaction is sent as two chained
+ * transfers, the command bytes and then the data bytes, both started by
+ * ssd1306_spi_write_async: no blocking transfer is ever made.
+ */
+extern const ssd1306_transport_t ssd1306_spi_transport;
+
+
+/**
+ * Initializes a display connected over 4-wire spi by means of
+ * ssd1306_init_transport. There is no transaction size limit: a whole
+ * frame is sent within a single transfer.
+ *
+ * @param  ssd1306_ptr a pointer to a ssd1306_t structure.
+ * @param  spi_channel the spi peripheral identifier to route requests to
+ *                     the correct spi master (see ssd1306_config.c for more
+ *                     information).
+ * @param  warm        if true, the display is initialized as done by
+ *                     ssd1306_init_warm, i.e. it kept its configuration.
+ * @return the outcome of the function call.
+ */
+ssd1306_status_t
+ssd1306_init_spi(ssd1306_t *ssd1306_ptr, uint8_t spi_channel, bool warm);
+
+
+#ifdef SSD1306_ENABLE_ASYNC
+/**
+ * Must be called by the port layer when a transfer started by
+ * ssd1306_spi_write_async is over, possibly from interrupt context.
+ * It starts the data bytes of the transaction after its command bytes,
+ * or reports the end of the transaction to the driver.
+ *
+ * @param ctx    the context given to ssd1306_spi_write_async.
+ * @param status the outcome of the transfer.
+ */
+void
+ssd1306_spi_write_async_complete(void *ctx, ssd1306_status_t status);
+#endif
+
+#endif
+
+
+/* C++ detection */
+#ifdef __cplusplus
+    }
+#endif
+
+#endif // __SSD1306_SPI_H__
@@ -0,0 +1,208 @@
+/**
+ * @file   ssd1306_sprites.h
+ * @brief  SSD1306 OLED display C library.
+ *
+ * @copyright
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  any later version.
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ *  GNU General Public License for more details.
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program. If not, see <http://www.gnu.org/licenses/>.
+ *
+ * @author Giovanni Scotti
+ */
+
+#ifndef __SSD1306_SPRITES_H__
+#define __SSD1306_SPRITES_H__
+
+/* C++ detection */
+#ifdef __cplusplus
+    extern "C" {
+#endif
+
+
+#include "ssd1306_driver.h"
+
+
+// Sprites redraw parts of the display, hence they need the whole software buffer.
+#ifndef SSD1306_ENABLE_PAGE_MODE
+
+#ifndef SSD1306_SPRITES_MAX
+#define SSD1306_SPRITES_MAX 8 /// Max number of sprites of a layer.
+#endif
+
+
+/**
+ * Sprite of a layer. Its image is a page-major bitmap (see
+ * ssd1306_draw_page_bitmap) whose set pixels are white and clear pixels
+ * black. The optional mask has the same layout: only its set pixels are
+ * drawn, the other ones letting what lies below show through, and the
+ * bitmap must not set pixels outside of it.
+ *
+ * The bounds the sprite has last been drawn within, clipped to the display,
+ * are kept from (drawn_x0, drawn_y0) to (drawn_x1, drawn_y1), so that they
+ * can be restored once the sprite moves.
+ */
+typedef struct {
+    const uint8_t *bitmap;  /*!< Page-major image, NULL if the slot is unused. */
+    const uint8_t *mask;    /*!< Page-major mask, NULL if the sprite is opaque. */
+    int16_t x;              /*!< Column of the top-left corner of the sprite. */
+    int16_t y;              /*!< Row of the top-left corner of the sprite. */
+    uint8_t w;              /*!< Width of the sprite in pixels. */
+    uint8_t h;              /*!< Height of the sprite in pixels. */
+    bool    visible;        /*!< The sprite is shown. */
+    bool    changed;        /*!< The sprite must be composed again. */
+    bool    drawn;          /*!< The sprite is on the software buffer. */
+    uint8_t drawn_x0;       /*!< First column last drawn. */
+    uint8_t drawn_y0;       /*!< First row last drawn. */
+    uint8_t drawn_x1;       /*!< Last column last drawn. */
+    uint8_t drawn_y1;       /*!< Last row last drawn. */
+} ssd1306_sprite_t;
+
+
+/**
+ * Sprite layer covering a display, made of a fixed-capacity table of
+ * sprites stacked in order: each sprite is drawn above the previous ones.
+ * Once sprites have been moved, shown, hidden or changed, the compositor
+ * (see ssd1306_sprites_compose) restores the background only within their
+ * old and new bounds, by means of the background function clipped to them,
+ * then draws the sprites lying there. Only those areas of the software
+ * buffer are thus marked as dirty.
+ */
+typedef struct {
+    ssd1306_t         *display;        /*!< The display the layer draws on. */
+    ssd1306_draw_cb_t background;      /*!< Draws what lies below the sprites, NULL if black. */
+    void              *background_ctx; /*!< User context given to background. */
+    ssd1306_sprite_t  sprites[SSD1306_SPRITES_MAX]; /*!< Sprites, bottom first. */
+} ssd1306_sprites_t;
+
+
+/**
+ * Initializes a sprite layer on the given display, without any sprite.
+ * The background function is invoked with the default drawing state of
+ * a display (cursor and origin at the top-left corner, opaque text, copy
+ * raster operation) and the clip rectangle restricted to the area to be
+ * restored: it may draw the whole background, e.g. a frame by means of
+ * ssd1306_draw_page_bitmap, at the cost of the clipped area only.
+ *
+ * @param  sprites_ptr    a pointer to a ssd1306_sprites_t structure.
+ * @param  ssd1306_ptr    a pointer to an initialized ssd1306_t structure.
+ * @param  background     the function drawing the background. If NULL,
+ *                        the background is black.
+ * @param  background_ctx the user context given to the background function.
+ * @return the outcome of the function call.
+ */
+ssd1306_status_t
+ssd1306_sprites_init(ssd1306_sprites_t *sprites_ptr, ssd1306_t *ssd1306_ptr,
+        ssd1306_draw_cb_t background, void *background_ctx);
+
+
+/**
+ * Sets the image of the given sprite, which becomes visible at the given
+ * position. A NULL bitmap removes the sprite from the layer.
+ *
+ * @param  sprites_ptr a pointer to a ssd1306_sprites_t structure.
+ * @param  id          the index of the sprite, less than SSD1306_SPRITES_MAX.
+ * @param  bitmap      a pointer to the page-major image, or NULL.
+ * @param  mask        a pointer to the page-major mask, or NULL.
+ * @param  w           the width of the image, greater than 0.
+ * @param  h           the height of the image, greater than 0.
+ * @param  x           the column of the top-left corner.
+ * @param  y           the row of the top-left corner.
+ * @return the outcome of the function call.
+ */
+ssd1306_status_t
+ssd1306_sprites_set(ssd1306_sprites_t *sprites_ptr, uint8_t id,
+        const uint8_t *bitmap, const uint8_t *mask, uint8_t w, uint8_t h,
+        int16_t x, int16_t y);
+
+
+/**
+ * Moves the given sprite. Its top-left corner may lie outside of the
+ * display, in which case the sprite is drawn partly or not at all.
+ *
+ * @param  sprites_ptr a pointer to a ssd1306_sprites_t structure.
+ * @param  id          the index of the sprite.
+ * @param  x           the new column of the top-left corner.
+ * @param  y           the new row of the top-left corner.
+ * @return the outcome of the function call.
+ */
+ssd1306_status_t
+ssd1306_sprites_move(ssd1306_sprites_t *sprites_ptr, uint8_t id,
+        int16_t x, int16_t y);
+
+
+/**
+ * Shows or hides the given sprite.
+ *
+ * @param  sprites_ptr a pointer to a ssd1306_sprites_t structure.
+ * @param  id          the index of the sprite.
+ * @param  visible     true to show the sprite.
+ * @return the outcome of the function call.
+ */
+ssd1306_status_t
+ssd1306_sprites_show(ssd1306_sprites_t *sprites_ptr, uint8_t id, bool visible);
+
+
+/**
+ * Tells the layer that its current image, e.g. an animation frame, has
+ * changed in place: the given sprite is drawn again by the next composition.
+ *
+ * @param  sprites_ptr a pointer to a ssd1306_sprites_t structure.
+ * @param  id          the index of the sprite.
+ * @return the outcome of the function call.
+ */
+ssd1306_status_t
+ssd1306_sprites_touch(ssd1306_sprites_t *sprites_ptr, uint8_t id);
+
+
+/**
+ * Forgets where the sprites have been drawn, e.g. after the whole software
+ * buffer has been redrawn: the next composition draws all the visible
+ * sprites again, without restoring the bounds they were drawn within.
+ *
+ * @param  sprites_ptr a pointer to a ssd1306_sprites_t structure.
+ */
+void
+ssd1306_sprites_invalidate(ssd1306_sprites_t *sprites_ptr);
+
+
+/**
+ * Composes the sprites changed since the last composition into the
+ * software buffer. The background is restored within their old and new
+ * bounds, overlapping ones being merged, and all the sprites lying there
+ * are drawn again, in order. The drawing state of the display (origin,
+ * clip rectangle, cursor, text and raster modes) is left untouched.
+ *
+ * @param  sprites_ptr a pointer to a ssd1306_sprites_t structure.
+ * @return the outcome of the function call. On failure, the changed
+ *         sprites are composed again by the next call.
+ */
+ssd1306_status_t
+ssd1306_sprites_compose(ssd1306_sprites_t *sprites_ptr);
+
+
+/**
+ * Composes the changed sprites and flushes the areas redrawn to the display
+ * by means of ssd1306_update_dirty.
+ *
+ * @param  sprites_ptr a pointer to a ssd1306_sprites_t structure.
+ * @return the outcome of the function call.
+ */
+ssd1306_status_t
+ssd1306_sprites_flush(ssd1306_sprites_t *sprites_ptr);
+
+#endif
+
+
+/* C++ detection */
+#ifdef __cplusplus
+    }
+#endif
+
+#endif // __SSD1306_SPRITES_H__
@@ -0,0 +1,160 @@
+/**
+ * @file   ssd1306_task.h
+ * @brief  SSD1306 OLED display C library.
+ *
+ * @copyright
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  any later version.
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ *  GNU General Public License for more details.
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program. If not, see <http://www.gnu.org/licenses/>.
+ *
+ * @author Giovanni Scotti
+ */
+
+#ifndef __SSD1306_TASK_H__
+#define __SSD1306_TASK_H__
+
+/* C++ detection */
+#ifdef __cplusplus
+    extern "C" {
+#endif
+
+
+#include "ssd1306_driver.h"
+
+
+// The flush task sends snapshots of the whole software buffer.
+#if defined(SSD1306_ENABLE_LOCKING) && !defined(SSD1306_ENABLE_PAGE_MODE)
+
+#ifndef SSD1306_TASK_MAX_DISPLAYS
+#define SSD1306_TASK_MAX_DISPLAYS 8 /// Max number of displays of a flush task.
+#endif
+
+
+/**
+ * Operations of the RTOS running a flush task. Each one receives the
+ * context given to ssd1306_task_init. With FreeRTOS, for instance, wait and
+ * signal may be ulTaskNotifyTake and xTaskNotifyGive on the flush task,
+ * and sleep vTaskDelay.
+ */
+typedef struct {
+    void (*wait)(void *ctx);     /*!< Blocks until signal is called, at once if it has been meanwhile. */
+    void (*signal)(void *ctx);   /*!< Wakes wait up, from any thread. */
+    void (*sleep)(void *ctx, uint32_t period); /*!< Blocks for the given period. */
+} ssd1306_task_ops_t;
+
+
+/**
+ * Display flushed by a task.
+ */
+typedef struct {
+    ssd1306_t        *display;      /*!< The display itself. */
+    volatile bool    requested;     /*!< An update has been requested. */
+    ssd1306_status_t last_status;   /*!< Outcome of the last update. */
+} ssd1306_task_slot_t;
+
+
+/**
+ * Flush task, running in a thread of its own: producers draw into the
+ * displays from other threads and request their updates, which the task
+ * sends by means of ssd1306_update_snapshot. Requests are flags rather than
+ * queue entries, hence any number of requests made for a display before
+ * its next update is served by a single transfer. After each round of
+ * updates, the task sleeps for its frame period, so that a display is
+ * updated at most once per period however often its producers request it.
+ * Snapshots are taken one display at a time into the same buffer.
+ */
+typedef struct {
+    ssd1306_task_slot_t      slots[SSD1306_TASK_MAX_DISPLAYS]; /*!< Displays. */
+    uint8_t                  num_slots;   /*!< Number of displays. */
+    const ssd1306_task_ops_t *ops;        /*!< Operations of the RTOS. */
+    void                     *ops_ctx;    /*!< Context of the operations. */
+    uint32_t                 period;      /*!< Frame period given to sleep. */
+    ssd1306_callback_t       callback;    /*!< Update completion callback. */
+    uint8_t                  snapshot[SSD1306_BUFFER_SIZE]; /*!< Frame being sent. */
+} ssd1306_task_t;
+
+
+/**
+ * Initializes a flush task without any display. The given callback is
+ * invoked from the flush task at the end of each update, with the status
+ * of the update and the related ssd1306_t structure as context.
+ *
+ * @param  task_ptr a pointer to a ssd1306_task_t structure.
+ * @param  ops      the operations of the RTOS. sleep may be NULL if the
+ *                  period is 0.
+ * @param  ops_ctx  the context given to the operations.
+ * @param  period   the frame period, in the units of sleep. If 0, requests
+ *                  are served as soon as possible.
+ * @param  callback update completion callback, it can be NULL.
+ * @return the outcome of the function call.
+ */
+ssd1306_status_t
+ssd1306_task_init(ssd1306_task_t *task_ptr, const ssd1306_task_ops_t *ops,
+        void *ops_ctx, uint32_t period, ssd1306_callback_t callback);
+
+
+/**
+ * Hands an initialized display over to the flush task, before the task
+ * is started. From now on, the display should only be updated by means of
+ * ssd1306_task_request, and drawn with its lock held (see ssd1306_lock).
+ *
+ * @param  task_ptr    a pointer to a ssd1306_task_t structure.
+ * @param  ssd1306_ptr a pointer to an initialized ssd1306_t structure.
+ * @return the outcome of the function call. SSD1306_WRONG_PARAMS is
+ *         returned if the task is full or the display already added.
+ */
+ssd1306_status_t
+ssd1306_task_add(ssd1306_task_t *task_ptr, ssd1306_t *ssd1306_ptr);
+
+
+/**
+ * Requests an update of the given display and returns immediately: its
+ * dirty spans are sent by the flush task within the next frame period.
+ * It can be called from any thread, with or without the display locked.
+ *
+ * @param  task_ptr    a pointer to a ssd1306_task_t structure.
+ * @param  ssd1306_ptr a pointer to a display added to the task.
+ * @return the outcome of the function call.
+ */
+ssd1306_status_t
+ssd1306_task_request(ssd1306_task_t *task_ptr, ssd1306_t *ssd1306_ptr);
+
+
+/**
+ * Runs a single round of the flush task: waits for a request, updates all
+ * the requested displays, then sleeps for the frame period. Failed updates
+ * are not retried until the display is requested again, their spans being
+ * left dirty.
+ *
+ * @param  task_ptr a pointer to a ssd1306_task_t structure.
+ */
+void
+ssd1306_task_step(ssd1306_task_t *task_ptr);
+
+
+/**
+ * Body of the flush task, which runs rounds forever (see ssd1306_task_step).
+ * Its signature allows it to be given straight to the RTOS as the entry
+ * point of the thread.
+ *
+ * @param  task_ptr a pointer to a ssd1306_task_t structure.
+ */
+void
+ssd1306_task_run(void *task_ptr);
+
+#endif
+
+
+/* C++ detection */
+#ifdef __cplusplus
+    }
+#endif
+
+#endif // __SSD1306_TASK_H__
@@ -0,0 +1,342 @@
+/**
+ * @file   ssd1306_console.c
+ * @brief  SSD1306 OLED display C library.
+ *
+ * @copyright
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  any later version.
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ *  GNU General Public License for more details.
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program. If not, see <http://www.gnu.org/licenses/>.
+ *
+ * @author Giovanni Scotti
+ */
+
+
+#include <string.h> // for memmove, memset.
+#include "ssd1306_console.h"
+
+
+#ifndef SSD1306_ENABLE_PAGE_MODE
+
+#define SSD1306_CONSOLE_NO_CURSOR 0xFF /// Row of a cursor not drawn.
+
+
+///////////////////////////////////////////////////////////
+///////////////////////////////////////////////////////////
+// PRIVATE FUNCTIONS
+///////////////////////////////////////////////////////////
+///////////////////////////////////////////////////////////
+
+/**
+ * Marks the given cell as to be redrawn.
+ *
+ * @param console_ptr a pointer to a ssd1306_console_t structure.
+ * @param col         the column of the cell.
+ * @param row         the row of the cell.
+ */
+static inline void
+ssd1306_console_mark(ssd1306_console_t *console_ptr, uint8_t col, uint8_t row) {
+
+    console_ptr->dirty[row] |= (uint32_t)1 << col;
+}
+
+
+/**
+ * Stores a character in the given cell, which is marked as to be redrawn
+ * only if its character changes.
+ *
+ * @param console_ptr a pointer to a ssd1306_console_t structure.
+ * @param col         the column of the cell.
+ * @param row         the row of the cell.
+ * @param ch          the character of the cell.
+ */
+static void
+ssd1306_console_set(ssd1306_console_t *console_ptr, uint8_t col, uint8_t row,
+        char ch) {
+
+    if (console_ptr->cells[row][col] == ch) return;
+
+    console_ptr->cells[row][col] = ch;
+    ssd1306_console_mark(console_ptr, col, row);
+}
+
+
+/**
+ * Scrolls the console up by one row and clears the bottom row.
+ *
+ * @param  console_ptr a pointer to a ssd1306_console_t structure.
+ * @return the outcome of the function call.
+ */
+static ssd1306_status_t
+ssd1306_console_scroll(ssd1306_console_t *console_ptr) {
+
+    uint8_t last = console_ptr->rows - 1;
+
+    if (console_ptr->hw_scroll) {
+        // Pixels are moved by the display: cells and their dirty bits
+        // follow them, while the exposed row has already been cleared.
+        ssd1306_status_t status = ssd1306_scroll_up(console_ptr->display,
+                console_ptr->cell_height >> 3);
+        if (status != SSD1306_OK) return status;
+
+        memmove(console_ptr->cells[0], console_ptr->cells[1],
+                sizeof(console_ptr->cells[0]) * last);
+        memmove(&console_ptr->dirty[0], &console_ptr->dirty[1],
+                sizeof(console_ptr->dirty[0]) * last);
+        memset(console_ptr->cells[last], ' ', sizeof(console_ptr->cells[0]));
+        console_ptr->dirty[last] = 0;
+
+        if (console_ptr->drawn_row != SSD1306_CONSOLE_NO_CURSOR)
+            console_ptr->drawn_row = (console_ptr->drawn_row == 0) ?
+                    SSD1306_CONSOLE_NO_CURSOR : console_ptr->drawn_row - 1;
+        return SSD1306_OK;
+    }
+
+    // Each cell keeps its pixels, hence it is redrawn only if the
+    // character coming from the row below is different.
+    for (uint8_t row = 0; row < last; row++) {
+        for (uint8_t col = 0; col < console_ptr->cols; col++)
+            ssd1306_console_set(console_ptr, col, row,
+                    console_ptr->cells[row + 1][col]);
+    }
+    for (uint8_t col = 0; col < console_ptr->cols; col++)
+        ssd1306_console_set(console_ptr, col, last, ' ');
+
+    return SSD1306_OK;
+}
+
+
+/**
+ * Moves the cursor to the beginning of the next line, scrolling the
+ * console if the cursor is on the last row.
+ *
+ * @param  console_ptr a pointer to a ssd1306_console_t structure.
+ * @return the outcome of the function call.
+ */
+static ssd1306_status_t
+ssd1306_console_newline(ssd1306_console_t *console_ptr) {
+
+    console_ptr->cur_col = 0;
+
+    if (console_ptr->cur_row + 1 < console_ptr->rows) {
+        console_ptr->cur_row++;
+        return SSD1306_OK;
+    }
+
+    return ssd1306_console_scroll(console_ptr);
+}
+
+
+///////////////////////////////////////////////////////////
+///////////////////////////////////////////////////////////
+// PUBLIC API
+///////////////////////////////////////////////////////////
+///////////////////////////////////////////////////////////
+
+ssd1306_status_t
+ssd1306_console_init(ssd1306_console_t *console_ptr, ssd1306_t *ssd1306_ptr,
+        ssd1306_font_name_t font_name, bool hw_scroll) {
+
+    ssd1306_status_t status;
+    const ssd1306_font_t *font = get_font_ptr(font_name);
+
+    if (ssd1306_ptr == NULL || ssd1306_ptr->initialized == false)
+        return SSD1306_NOINIT;
+    if (font == NULL || font->font_cols == NULL || font->glyph_widths != NULL ||
+            font->glyph_index != NULL)
+        return SSD1306_WRONG_PARAMS;
+
+    memset(console_ptr, 0, sizeof(ssd1306_console_t));
+    console_ptr->display     = ssd1306_ptr;
+    console_ptr->font_name   = font_name;
+    console_ptr->cell_width  = font->font_width;
+    console_ptr->cell_height = font->font_height;
+    console_ptr->hw_scroll   = hw_scroll;
+    console_ptr->drawn_row   = SSD1306_CONSOLE_NO_CURSOR;
+
+    if (hw_scroll) {
+        // Rows must be scrolled by whole pages, all over the display ram.
+        console_ptr->cell_height = (font->font_height + 7) & ~0x7;
+        if (SSD1306_NUM_PAGES != 8 ||
+                SSD1306_PXL_HEIGHT % console_ptr->cell_height != 0)
+            return SSD1306_WRONG_PARAMS;
+    }
+
+    console_ptr->cols = SSD1306_PXL_WIDTH / console_ptr->cell_width;
+    console_ptr->rows = SSD1306_PXL_HEIGHT / console_ptr->cell_height;
+    if (console_ptr->cols > SSD1306_CONSOLE_MAX_COLS)
+        console_ptr->cols = SSD1306_CONSOLE_MAX_COLS;
+    if (console_ptr->rows > SSD1306_CONSOLE_MAX_ROWS)
+        console_ptr->rows = SSD1306_CONSOLE_MAX_ROWS;
+    if (console_ptr->cols == 0 || console_ptr->rows == 0)
+        return SSD1306_WRONG_PARAMS;
+
+    // Blank cells match the cleared buffer, hence they are not dirty.
+    memset(console_ptr->cells, ' ', sizeof(console_ptr->cells));
+
+    status = ssd1306_clear_buffer(ssd1306_ptr);
+    if (status != SSD1306_OK) return status;
+
+    return SSD1306_OK;
+}
+
+
+ssd1306_status_t
+ssd1306_console_putc(ssd1306_console_t *console_ptr, char ch) {
+
+    ssd1306_status_t status;
+
+    switch (ch) {
+        case '\n':
+            return ssd1306_console_newline(console_ptr);
+        case '\r':
+            console_ptr->cur_col = 0;
+            return SSD1306_OK;
+        case '\b':
+            if (console_ptr->cur_col > 0) console_ptr->cur_col--;
+            return SSD1306_OK;
+        default:
+            break;
+    }
+
+    // Only printable characters are available in fonts.
+    if (ch < ' ' || ch > '~') return SSD1306_OK;
+
+    // Wrapping is delayed until a character does not fit the row,
+    // so that filling the last row does not scroll the console.
+    if (console_ptr->cur_col == console_ptr->cols) {
+        status = ssd1306_console_newline(console_ptr);
+        if (status != SSD1306_OK) return status;
+    }
+
+    ssd1306_console_set(console_ptr, console_ptr->cur_col,
+            console_ptr->cur_row, ch);
+    console_ptr->cur_col++;
+    return SSD1306_OK;
+}
+
+
+ssd1306_status_t
+ssd1306_console_write(ssd1306_console_t *console_ptr, const char *str,
+        size_t str_len) {
+
+    ssd1306_status_t status;
+
+    for (size_t i = 0; i < str_len; i++) {
+        status = ssd1306_console_putc(console_ptr, str[i]);
+        if (status != SSD1306_OK) return status;
+    }
+
+    return SSD1306_OK;
+}
+
+
+ssd1306_status_t
+ssd1306_console_goto(ssd1306_console_t *console_ptr, uint8_t col, uint8_t row) {
+
+    if (col >= console_ptr->cols || row >= console_ptr->rows)
+        return SSD1306_WRONG_PARAMS;
+
+    console_ptr->cur_col = col;
+    console_ptr->cur_row = row;
+    return SSD1306_OK;
+}
+
+
+ssd1306_status_t
+ssd1306_console_clear(ssd1306_console_t *console_ptr) {
+
+    for (uint8_t row = 0; row < console_ptr->rows; row++) {
+        for (uint8_t col = 0; col < console_ptr->cols; col++)
+            ssd1306_console_set(console_ptr, col, row, ' ');
+    }
+
+    console_ptr->cur_col = 0;
+    console_ptr->cur_row = 0;
+    return SSD1306_OK;
+}
+
+
+ssd1306_status_t
+ssd1306_console_show_cursor(ssd1306_console_t *console_ptr, bool show) {
+
+    console_ptr->show_cursor = show;
+    return SSD1306_OK;
+}
+
+
+ssd1306_status_t
+ssd1306_console_render(ssd1306_console_t *console_ptr) {
+
+    ssd1306_status_t status;
+    ssd1306_t *ssd1306_ptr = console_ptr->display;
+
+    // A pending wrap shows the cursor on the last column.
+    uint8_t cursor_col = (console_ptr->cur_col < console_ptr->cols) ?
+            console_ptr->cur_col : console_ptr->cols - 1;
+    uint8_t cursor_row = console_ptr->show_cursor ?
+            console_ptr->cur_row : SSD1306_CONSOLE_NO_CURSOR;
+
+    // The cursor is redrawn wherever it was and wherever it is now.
+    if (console_ptr->drawn_row != SSD1306_CONSOLE_NO_CURSOR)
+        ssd1306_console_mark(console_ptr, console_ptr->drawn_col,
+                console_ptr->drawn_row);
+    if (cursor_row != SSD1306_CONSOLE_NO_CURSOR)
+        ssd1306_console_mark(console_ptr, cursor_col, cursor_row);
+
+    // Cells are copied opaque, without affecting the drawing state.
+    uint8_t x_pos = ssd1306_ptr->x_pos, y_pos = ssd1306_ptr->y_pos;
+    ssd1306_text_mode_t text_mode = ssd1306_ptr->text_mode;
+    ssd1306_rop_t rop = ssd1306_ptr->rop;
+    ssd1306_ptr->text_mode = SSD1306_TEXT_OPAQUE;
+    ssd1306_ptr->rop       = SSD1306_ROP_COPY;
+    status = SSD1306_OK;
+
+    for (uint8_t row = 0; row < console_ptr->rows && status == SSD1306_OK; row++) {
+        for (uint8_t col = 0; console_ptr->dirty[row] != 0; col++) {
+            uint32_t bit = (uint32_t)1 << col;
+            if (!(console_ptr->dirty[row] & bit)) continue;
+
+            bool is_cursor = (row == cursor_row && col == cursor_col);
+            ssd1306_ptr->x_pos = col * console_ptr->cell_width;
+            ssd1306_ptr->y_pos = row * console_ptr->cell_height;
+
+            status = ssd1306_draw_char(ssd1306_ptr, console_ptr->cells[row][col],
+                    console_ptr->font_name,
+                    is_cursor ? SSD1306_COLOR_BLACK : SSD1306_COLOR_WHITE);
+            if (status != SSD1306_OK) break;
+
+            console_ptr->dirty[row] &= ~bit;
+        }
+    }
+
+    ssd1306_ptr->x_pos     = x_pos;
+    ssd1306_ptr->y_pos     = y_pos;
+    ssd1306_ptr->text_mode = text_mode;
+    ssd1306_ptr->rop       = rop;
+    if (status != SSD1306_OK) return status;
+
+    console_ptr->drawn_col = cursor_col;
+    console_ptr->drawn_row = cursor_row;
+    return SSD1306_OK;
+}
+
+
+ssd1306_status_t
+ssd1306_console_flush(ssd1306_console_t *console_ptr) {
+
+    ssd1306_status_t status;
+
+    status = ssd1306_console_render(console_ptr);
+    if (status != SSD1306_OK) return status;
+
+    return ssd1306_update_dirty(console_ptr->display);
+}
+
+#endif
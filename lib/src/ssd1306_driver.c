@@ -19,7 +19,6 @@
 
 
 #include <string.h> // for memcpy, memset.
-#include <assert.h> // for assert function.
 #include "ssd1306_driver.h"
 
 
@@ -114,618 +113,2945 @@
 /// are data.
 #define SSD1306_DATA_CONTROL_BYTE                    0x40
 
-/// Buffer size in bytes used by the ssd1306_data_write.
-#define SSD1306_DATA_WRITE_BUFFER_SIZE               129
+/// A control byte with the continuation bit set informs the hardware
+/// that only one command byte follows, then another control byte.
+/// It allows to merge commands and data in the same transaction.
+#define SSD1306_CMD_SINGLE_CONTROL_BYTE              0x80
 
 #define SSD1306_DECLARE_STATUS_VARIABLE() \
     ssd1306_status_t status;
 
-#define SSD1306_DECLARE_COMMAND_WRITE(cmd)        \
-    status = ssd1306_cmd_write(ssd1306_ptr, cmd); \
-    if (status != SSD1306_OK) return status;
-
 #define SSD1306_DECLARE_COMMAND_WRITE_MULTI(cmd_list)                          \
     status = ssd1306_cmd_write_multi(ssd1306_ptr, cmd_list, sizeof(cmd_list)); \
     if (status != SSD1306_OK) return status;
 
-#define SSD1306_NUM_PAGES 8           /// Number of display pages.
+#define SSD1306_CLEAN_PAGE_START 0xFF  /// Dirty span start of a clean page.
+#define SSD1306_OUT_LEFT   0x1 /// Cohen-Sutherland outcode: left of the clip rectangle.
+#define SSD1306_OUT_RIGHT  0x2 /// Cohen-Sutherland outcode: right of the clip rectangle.
+#define SSD1306_OUT_TOP    0x4 /// Cohen-Sutherland outcode: above the clip rectangle.
+#define SSD1306_OUT_BOTTOM 0x8 /// Cohen-Sutherland outcode: below the clip rectangle.
 #define ABS(x) ((x) > 0 ? (x) : -(x)) /// Computes the absolute value of x.
+#define MIN(a, b) ((a) < (b) ? (a) : (b)) /// Computes the minimum of a and b.
+#define MAX(a, b) ((a) > (b) ? (a) : (b)) /// Computes the maximum of a and b.
+
+// Statistics and traces of ssd1306_ptr, compiled out if disabled.
+#ifdef SSD1306_ENABLE_STATS
+#define SSD1306_STATS_ADD(field, n) (ssd1306_ptr->stats.field += (n))
+#define SSD1306_STATS_PIXELS(mask, width) \
+    SSD1306_STATS_ADD(pixels, (uint32_t)ssd1306_count_bits(mask) * (width))
+#define SSD1306_STATS_WRITE_BEGIN(size) ssd1306_stats_write_begin(ssd1306_ptr, size)
+#define SSD1306_STATS_WRITE_END(status) ssd1306_stats_write_end(ssd1306_ptr, status)
+#define SSD1306_STATS_UPDATE_BEGIN()    ssd1306_stats_update_begin(ssd1306_ptr)
+#define SSD1306_STATS_UPDATE_END(status) ssd1306_stats_update_end(ssd1306_ptr, status)
+#else
+#define SSD1306_STATS_ADD(field, n)       ((void)0)
+#define SSD1306_STATS_PIXELS(mask, width) ((void)0)
+#define SSD1306_STATS_WRITE_BEGIN(size)   ((void)0)
+#define SSD1306_STATS_WRITE_END(status)   ((void)0)
+#define SSD1306_STATS_UPDATE_BEGIN()      ((void)0)
+#define SSD1306_STATS_UPDATE_END(status)  ((void)0)
+#endif
 
 
 ///////////////////////////////////////////////////////////
 // PRIVATE FUNCTIONS
 ///////////////////////////////////////////////////////////
 
-// Defined in ssd1306_config.h. Allows to communicate to the
-// display over i2c bus.
+// Defined in ssd1306_config.h. Initializes the given i2c peripheral.
+// It is called by ssd1306_init for each display, hence it must
+// tolerate being called more than once for the same channel.
 extern ssd1306_status_t
-ssd1306_i2c_write(uint8_t channel, uint8_t addr,
+ssd1306_i2c_init(uint8_t channel);
+
+// Defined in ssd1306_config.h. Returns the maximum number of bytes
+// that can be sent within a single transaction on the given channel,
+// or 0 if there is no limit. Longer writes are split by the driver.
+extern size_t
+ssd1306_i2c_max_transfer_size(uint8_t channel);
+
+// Defined in ssd1306_config.h. Writes the header bytes followed by the
+// data bytes within a single i2c transaction, so that the data bytes do
+// not need to be copied after their control byte. The header is made of
+// zero or more pairs of single command control byte and command byte,
+// followed by one control byte.
+extern ssd1306_status_t
+ssd1306_i2c_write_v(uint8_t channel, uint8_t addr,
+        const uint8_t *header_ptr, size_t header_size,
         const uint8_t *data_ptr, size_t data_size);
 
+#ifdef SSD1306_ENABLE_ASYNC
+// Defined in ssd1306_config.h. Starts a non-blocking i2c transaction
+// made of the header bytes followed by the data bytes. Both buffers
+// stay valid until the port calls ssd1306_i2c_write_async_complete
+// with the given context, which must happen after returning.
+extern ssd1306_status_t
+ssd1306_i2c_write_async(uint8_t channel, uint8_t addr,
+        const uint8_t *header_ptr, size_t header_size,
+        const uint8_t *data_ptr, size_t data_size, void *ctx);
+#endif
+
+#ifdef SSD1306_ENABLE_LOCKING
+// Defined in ssd1306_config.h. Acquire and release the lock of the given
+// i2c channel, e.g. an RTOS mutex, held by the driver around each blocking
+// transaction. Non-blocking transactions are not locked: the port has to
+// serialize them, as a scheduler does.
+extern void
+ssd1306_i2c_lock(uint8_t channel);
+
+extern void
+ssd1306_i2c_unlock(uint8_t channel);
+#endif
+
 
 /**
- * Issues the specified command to the given display.
- *
- * @param  ssd1306_ptr a pointer to a ssd1306_t structure.
- * @param  cmd         the command to execute.
- * @return the outcome of the function call.
+ * Transport operations of displays initialized by ssd1306_init, routing
+ * transactions to the i2c port hooks. Their context is the display.
  */
 static ssd1306_status_t
-ssd1306_cmd_write(ssd1306_t *ssd1306_ptr, uint8_t cmd) {
+ssd1306_i2c_transport_init(void *ctx) {
 
-    if (ssd1306_ptr->initialized == false)
-        return SSD1306_NOINIT;
+    const ssd1306_t *ssd1306_ptr = (const ssd1306_t *)ctx;
+    return ssd1306_i2c_init(ssd1306_ptr->i2c_channel);
+}
+
+
+static size_t
+ssd1306_i2c_transport_max_transfer_size(void *ctx) {
+
+    const ssd1306_t *ssd1306_ptr = (const ssd1306_t *)ctx;
+    return ssd1306_i2c_max_transfer_size(ssd1306_ptr->i2c_channel);
+}
+
+
+static ssd1306_status_t
+ssd1306_i2c_transport_write_v(void *ctx,
+        const uint8_t *header_ptr, size_t header_size,
+        const uint8_t *data_ptr, size_t data_size) {
+
+    const ssd1306_t *ssd1306_ptr = (const ssd1306_t *)ctx;
+#ifdef SSD1306_ENABLE_LOCKING
+    ssd1306_status_t status;
+
+    // Displays sharing the channel may be driven from other threads.
+    ssd1306_i2c_lock(ssd1306_ptr->i2c_channel);
+    status = ssd1306_i2c_write_v(ssd1306_ptr->i2c_channel,
+            ssd1306_ptr->i2c_addr, header_ptr, header_size, data_ptr, data_size);
+    ssd1306_i2c_unlock(ssd1306_ptr->i2c_channel);
+    return status;
+#else
+    return ssd1306_i2c_write_v(ssd1306_ptr->i2c_channel, ssd1306_ptr->i2c_addr,
+            header_ptr, header_size, data_ptr, data_size);
+#endif
+}
 
-    uint8_t cmd_list[2] = {SSD1306_CMD_CONTROL_BYTE, cmd};
 
-    return ssd1306_i2c_write(ssd1306_ptr->i2c_channel, ssd1306_ptr->i2c_addr,
-            cmd_list, sizeof(cmd_list));
+#ifdef SSD1306_ENABLE_ASYNC
+static ssd1306_status_t
+ssd1306_i2c_transport_write_async(void *ctx,
+        const uint8_t *header_ptr, size_t header_size,
+        const uint8_t *data_ptr, size_t data_size, void *complete_ctx) {
+
+    const ssd1306_t *ssd1306_ptr = (const ssd1306_t *)ctx;
+    return ssd1306_i2c_write_async(ssd1306_ptr->i2c_channel,
+            ssd1306_ptr->i2c_addr, header_ptr, header_size,
+            data_ptr, data_size, complete_ctx);
 }
+#endif
+
+
+static const ssd1306_transport_t ssd1306_i2c_transport = {
+    .init              = ssd1306_i2c_transport_init,
+    .max_transfer_size = ssd1306_i2c_transport_max_transfer_size,
+    .write_v           = ssd1306_i2c_transport_write_v,
+#ifdef SSD1306_ENABLE_ASYNC
+    .write_async       = ssd1306_i2c_transport_write_async,
+#endif
+};
 
 
 /**
- * Issues the specified list of commands to the given display.
+ * Computes how many data bytes can follow the given header within
+ * a single transaction, according to the port limits.
  *
  * @param  ssd1306_ptr a pointer to a ssd1306_t structure.
- * @param  cmd_list    a pointer to an array of command bytes. This array
- *                     must present SSD1306_CMD_CONTROL_BYTE as first element.
- * @return the outcome of the function call.
+ * @param  header_size the size of the header in bytes.
+ * @param  data_size   the number of data bytes still to be sent.
+ * @return the number of data bytes of the next transaction.
  */
-static ssd1306_status_t
-ssd1306_cmd_write_multi(ssd1306_t *ssd1306_ptr, const uint8_t *cmd_list,
-        uint8_t cmd_list_size) {
+static inline size_t
+ssd1306_chunk_size(const ssd1306_t *ssd1306_ptr, size_t header_size,
+        size_t data_size) {
 
-    if (ssd1306_ptr->initialized == false)
-        return SSD1306_NOINIT;
+    size_t max_transfer = ssd1306_ptr->i2c_max_transfer;
 
-    return ssd1306_i2c_write(ssd1306_ptr->i2c_channel, ssd1306_ptr->i2c_addr,
-            cmd_list, cmd_list_size);
+    if (max_transfer == 0 || header_size + data_size <= max_transfer)
+        return data_size;
+
+    return max_transfer - header_size;
 }
 
 
+#ifdef SSD1306_ENABLE_STATS
+
 /**
- * Writes the given data buffer to the specified display.
+ * Counts the bits set in the given byte, i.e. the rows of a page
+ * selected by a mask.
  *
- * @param  ssd1306_ptr a pointer to a ssd1306_t structure.
- * @param  data_ptr    the data buffer to be written.
- * @param  data_size   the size of the data buffer in bytes.
- * @return the outcome of the function call.
+ * @param  byte the byte.
+ * @return the number of bits set.
  */
-static ssd1306_status_t
-ssd1306_data_write(ssd1306_t *ssd1306_ptr, const uint8_t *data_ptr,
-        size_t data_size) {
+static inline uint8_t
+ssd1306_count_bits(uint8_t byte) {
 
-    if (ssd1306_ptr->initialized == false)
-        return SSD1306_NOINIT;
-    if (data_size >= SSD1306_DATA_WRITE_BUFFER_SIZE)
-        return SSD1306_WRONG_PARAMS;
+    uint8_t count = 0;
+    for (; byte != 0; byte &= byte - 1) count++;
+    return count;
+}
 
-    // The given data buffer must be prepended by 0x40 in order to signal
-    // data bytes to the display hardware. Since we do not have memory
-    // allocation here, a data buffer with 128+1 bytes is preallocated
-    // on the stack. Its size has been chosen not to saturate the stack.
-    uint8_t data_array[SSD1306_DATA_WRITE_BUFFER_SIZE] =
-            {SSD1306_DATA_CONTROL_BYTE};
 
-    memcpy(data_array + 1, data_ptr, data_size);
+/**
+ * Reports the given event to the trace hook of the display, if any.
+ *
+ * @param ssd1306_ptr a pointer to a ssd1306_t structure.
+ * @param event       the event being reported.
+ * @param size        the size of the transaction, 0 for other events.
+ * @param status      the outcome of the transaction or of the update.
+ */
+static inline void
+ssd1306_trace_event(const ssd1306_t *ssd1306_ptr, ssd1306_trace_event_t event,
+        size_t size, ssd1306_status_t status) {
 
-    return ssd1306_i2c_write(ssd1306_ptr->i2c_channel, ssd1306_ptr->i2c_addr,
-            data_array, data_size + 1);
+    if (ssd1306_ptr->trace != NULL)
+        ssd1306_ptr->trace(event, size, status, ssd1306_ptr->trace_ctx);
 }
 
 
-///////////////////////////////////////////////////////////
-///////////////////////////////////////////////////////////
-// PUBLIC API
-///////////////////////////////////////////////////////////
-///////////////////////////////////////////////////////////
+/**
+ * Accounts for a transaction about to be sent.
+ *
+ * @param ssd1306_ptr a pointer to a ssd1306_t structure.
+ * @param size        the number of bytes of the transaction.
+ */
+static void
+ssd1306_stats_write_begin(ssd1306_t *ssd1306_ptr, size_t size) {
 
-///////////////////////////////////////////////////////////
-// FUNDAMENTAL COMMANDS
-///////////////////////////////////////////////////////////
+    ssd1306_ptr->stats.transactions++;
+    ssd1306_ptr->stats.bytes += size;
+    ssd1306_trace_event(ssd1306_ptr, SSD1306_TRACE_WRITE_BEGIN, size, SSD1306_OK);
+}
 
-ssd1306_status_t
-ssd1306_display_on(ssd1306_t *ssd1306_ptr) {
 
-    SSD1306_DECLARE_STATUS_VARIABLE()
+/**
+ * Accounts for the end of a transaction.
+ *
+ * @param ssd1306_ptr a pointer to a ssd1306_t structure.
+ * @param status      the outcome of the transaction.
+ */
+static void
+ssd1306_stats_write_end(ssd1306_t *ssd1306_ptr, ssd1306_status_t status) {
 
-    const uint8_t cmd_list[] = {
-            SSD1306_CMD_CONTROL_BYTE,
-            SSD1306_CMD_CHARGE_PUMP_SETTING,
-            SSD1306_SUBCMD_ENABLE_CHARGE_PUMP,
-            SSD1306_CMD_DISPLAYON
-    };
+    if (status != SSD1306_OK)
+        ssd1306_ptr->stats.comm_errors++;
+    ssd1306_trace_event(ssd1306_ptr, SSD1306_TRACE_WRITE_END, 0, status);
+}
 
-    SSD1306_DECLARE_COMMAND_WRITE_MULTI(cmd_list)
-    return SSD1306_OK;
+
+/**
+ * Accounts for an update about to start.
+ *
+ * @param ssd1306_ptr a pointer to a ssd1306_t structure.
+ */
+static void
+ssd1306_stats_update_begin(ssd1306_t *ssd1306_ptr) {
+
+    ssd1306_trace_event(ssd1306_ptr, SSD1306_TRACE_UPDATE_BEGIN, 0, SSD1306_OK);
+    ssd1306_ptr->update_began = SSD1306_STATS_TIME();
 }
 
 
-ssd1306_status_t
-ssd1306_display_off(ssd1306_t *ssd1306_ptr) {
+/**
+ * Accounts for the end of an update and measures its duration.
+ *
+ * @param ssd1306_ptr a pointer to a ssd1306_t structure.
+ * @param status      the outcome of the update.
+ */
+static void
+ssd1306_stats_update_end(ssd1306_t *ssd1306_ptr, ssd1306_status_t status) {
+
+    uint32_t elapsed = (uint32_t)SSD1306_STATS_TIME() - ssd1306_ptr->update_began;
+
+    ssd1306_ptr->stats.updates++;
+    ssd1306_ptr->stats.update_time_last   = elapsed;
+    ssd1306_ptr->stats.update_time_total += elapsed;
+    if (elapsed > ssd1306_ptr->stats.update_time_max)
+        ssd1306_ptr->stats.update_time_max = elapsed;
+    ssd1306_trace_event(ssd1306_ptr, SSD1306_TRACE_UPDATE_END, 0, status);
+}
+
+#endif
+
+
+/**
+ * Writes the header bytes followed by the data bytes. If the port cannot
+ * send them within a single transaction, the data bytes are split into
+ * port-sized chunks. Following chunks carry only the final control byte
+ * of the header, since the display ram pointer keeps advancing within
+ * the address window.
+ *
+ * @param  ssd1306_ptr a pointer to a ssd1306_t structure.
+ * @param  header_ptr  the header bytes, ending with a control byte.
+ * @param  header_size the size of the header in bytes.
+ * @param  data_ptr    the data buffer to be written.
+ * @param  data_size   the size of the data buffer in bytes.
+ * @return the outcome of the function call.
+ */
+static ssd1306_status_t
+ssd1306_write_chunked(ssd1306_t *ssd1306_ptr, const uint8_t *header_ptr,
+        size_t header_size, const uint8_t *data_ptr, size_t data_size) {
 
     SSD1306_DECLARE_STATUS_VARIABLE()
 
-    const uint8_t cmd_list[] = {
-            SSD1306_CMD_CONTROL_BYTE,
-            SSD1306_CMD_CHARGE_PUMP_SETTING,
-            SSD1306_SUBCMD_DISABLE_CHARGE_PUMP,
-            SSD1306_CMD_DISPLAYOFF
-    };
+    do {
+        size_t chunk_size =
+                ssd1306_chunk_size(ssd1306_ptr, header_size, data_size);
+
+        SSD1306_STATS_WRITE_BEGIN(header_size + chunk_size);
+        status = ssd1306_ptr->transport->write_v(ssd1306_ptr->transport_ctx,
+                header_ptr, header_size, data_ptr, chunk_size);
+        SSD1306_STATS_WRITE_END(status);
+        if (status != SSD1306_OK) return status;
+
+        header_ptr += header_size - 1;
+        header_size = 1;
+        data_ptr   += chunk_size;
+        data_size  -= chunk_size;
+    } while (data_size != 0);
 
-    SSD1306_DECLARE_COMMAND_WRITE_MULTI(cmd_list)
     return SSD1306_OK;
 }
 
 
-ssd1306_status_t
-ssd1306_set_contrast(ssd1306_t *ssd1306_ptr, uint8_t contrast_value) {
+/**
+ * Sends the queued command bytes, preceded by a single command control
+ * byte, and empties the queue even if the transmission fails.
+ *
+ * @param  ssd1306_ptr a pointer to a ssd1306_t structure.
+ * @return the outcome of the function call.
+ */
+static ssd1306_status_t
+ssd1306_batch_send(ssd1306_t *ssd1306_ptr) {
 
-    SSD1306_DECLARE_STATUS_VARIABLE()
+    const uint8_t control = SSD1306_CMD_CONTROL_BYTE;
+    uint8_t batch_len = ssd1306_ptr->cmd_batch_len;
 
-    const uint8_t cmd_list[] = {
-            SSD1306_CMD_CONTROL_BYTE,
-            SSD1306_CMD_SETCONTRAST,
-            contrast_value
-    };
+    if (batch_len == 0)
+        return SSD1306_OK;
+    if (ssd1306_is_busy(ssd1306_ptr))
+        return SSD1306_BUSY;
 
-    SSD1306_DECLARE_COMMAND_WRITE_MULTI(cmd_list)
-    return SSD1306_OK;
+    ssd1306_ptr->cmd_batch_len = 0;
+    return ssd1306_write_chunked(ssd1306_ptr, &control, 1,
+            ssd1306_ptr->cmd_batch, batch_len);
 }
 
 
-ssd1306_status_t
-ssd1306_set_inversion(ssd1306_t *ssd1306_ptr, bool is_inverted) {
+/**
+ * Issues the specified list of commands to the given display. If a batch
+ * of commands has been started, command bytes are queued instead.
+ *
+ * @param  ssd1306_ptr a pointer to a ssd1306_t structure.
+ * @param  cmd_list    a pointer to an array of command bytes. This array
+ *                     must present SSD1306_CMD_CONTROL_BYTE as first element.
+ * @return the outcome of the function call.
+ */
+static ssd1306_status_t
+ssd1306_cmd_write_multi(ssd1306_t *ssd1306_ptr, const uint8_t *cmd_list,
+        uint8_t cmd_list_size) {
 
     SSD1306_DECLARE_STATUS_VARIABLE()
+    uint8_t cmd_size = cmd_list_size - 1;
 
-    const uint8_t cmd_list[] = {
-            SSD1306_CMD_CONTROL_BYTE,
-            (is_inverted) ?
-                    SSD1306_CMD_INVERTDISPLAY : SSD1306_CMD_NORMALDISPLAY
-    };
+    if (ssd1306_ptr->initialized == false)
+        return SSD1306_NOINIT;
 
-    SSD1306_DECLARE_COMMAND_WRITE_MULTI(cmd_list)
+    if (ssd1306_ptr->batching) {
+        // A full queue is sent to make room for the new commands.
+        if (ssd1306_ptr->cmd_batch_len + cmd_size > SSD1306_CMD_BATCH_SIZE) {
+            status = ssd1306_batch_send(ssd1306_ptr);
+            if (status != SSD1306_OK) return status;
+        }
+        if (cmd_size <= SSD1306_CMD_BATCH_SIZE) {
+            memcpy(&ssd1306_ptr->cmd_batch[ssd1306_ptr->cmd_batch_len],
+                    &cmd_list[1], cmd_size);
+            ssd1306_ptr->cmd_batch_len += cmd_size;
+            return SSD1306_OK;
+        }
+    }
 
-    ssd1306_ptr->inverted = is_inverted;
-    return SSD1306_OK;
+    if (ssd1306_is_busy(ssd1306_ptr))
+        return SSD1306_BUSY;
+
+    // Commands may be split across transactions: the display keeps
+    // collecting the parameters of a command after a stop condition.
+    return ssd1306_write_chunked(ssd1306_ptr, cmd_list, 1,
+            &cmd_list[1], cmd_size);
 }
 
 
-///////////////////////////////////////////////////////////
-// SCROLLING
-///////////////////////////////////////////////////////////
+/**
+ * Fills the given header with the commands setting the column and page
+ * address window of the display ram, each one preceded by a single command
+ * control byte, followed by the data control byte. This way, the address
+ * window and the data bytes can be sent within the same transaction.
+ * Columns are relative to the panel: the column offset is added here.
+ *
+ * @param header     an array of SSD1306_TX_HEADER_SIZE bytes.
+ * @param col_start  the first column of the window.
+ * @param col_end    the last column of the window.
+ * @param page_start the first page of the window.
+ * @param page_end   the last page of the window.
+ */
+static void
+ssd1306_window_header(uint8_t *header, uint8_t col_start, uint8_t col_end,
+        uint8_t page_start, uint8_t page_end) {
+
+    const uint8_t window_header[SSD1306_TX_HEADER_SIZE] = {
+            SSD1306_CMD_SINGLE_CONTROL_BYTE, SSD1306_CMD_SET_COLUMN_ADDRESS,
+            SSD1306_CMD_SINGLE_CONTROL_BYTE, col_start + SSD1306_COL_OFFSET,
+            SSD1306_CMD_SINGLE_CONTROL_BYTE, col_end + SSD1306_COL_OFFSET,
+            SSD1306_CMD_SINGLE_CONTROL_BYTE, SSD1306_CMD_SET_PAGE_ADDRESS,
+            SSD1306_CMD_SINGLE_CONTROL_BYTE, page_start,
+            SSD1306_CMD_SINGLE_CONTROL_BYTE, page_end,
+            SSD1306_DATA_CONTROL_BYTE
+    };
+
+    memcpy(header, window_header, SSD1306_TX_HEADER_SIZE);
+}
 
-ssd1306_status_t
-ssd1306_set_scroll_status(ssd1306_t *ssd1306_ptr, bool is_scrolling) {
 
+/**
+ * Sends the display start line on its own if it has not been applied yet,
+ * i.e. if no transaction carrying it has succeeded since ssd1306_scroll_up.
+ *
+ * @param  ssd1306_ptr a pointer to a ssd1306_t structure.
+ * @return the outcome of the function call.
+ */
+static ssd1306_status_t
+ssd1306_start_line_send(ssd1306_t *ssd1306_ptr) {
     SSD1306_DECLARE_STATUS_VARIABLE()
 
+    uint8_t line_seq = ssd1306_ptr->start_line_seq;
     const uint8_t cmd_list[] = {
             SSD1306_CMD_CONTROL_BYTE,
-            (is_scrolling) ?
-                    SSD1306_CMD_ACTIVATE_SCROLL : SSD1306_CMD_DEACTIVATE_SCROLL
+            0x40 | (ssd1306_ptr->start_page << 3) // Display start line.
     };
 
-    SSD1306_DECLARE_COMMAND_WRITE_MULTI(cmd_list)
+    if (line_seq == ssd1306_ptr->start_line_acked)
+        return SSD1306_OK;
 
-    ssd1306_ptr->scrolling = is_scrolling;
-    return SSD1306_OK;
+    status = ssd1306_write_chunked(ssd1306_ptr, cmd_list, 1, &cmd_list[1], 1);
+    if (status == SSD1306_OK)
+        ssd1306_ptr->start_line_acked = line_seq;
+    return status;
 }
 
 
-ssd1306_status_t
-ssd1306_scroll(ssd1306_t *ssd1306_ptr, ssd1306_scroll_t type,
-        ssd1306_page_t start_page, ssd1306_page_t end_page,
-        ssd1306_time_int_t interval) {
+/**
+ * Writes the given data buffer to the given address window of the display
+ * ram, within a single transaction if the port allows it. Data bytes wrap
+ * around within the window. The queued commands and the start line, if not
+ * applied yet, are sent within the same transaction.
+ * No copy of the data buffer is made: the header carrying the control bytes
+ * is handed separately to the port layer.
+ *
+ * @param  ssd1306_ptr a pointer to a ssd1306_t structure.
+ * @param  col_start   the first column of the window.
+ * @param  col_end     the last column of the window.
+ * @param  page_start  the first page of the window.
+ * @param  page_end    the last page of the window.
+ * @param  data_ptr    the data buffer to be written.
+ * @param  data_size   the size of the data buffer in bytes.
+ * @return the outcome of the function call.
+ */
+static ssd1306_status_t
+ssd1306_data_write(ssd1306_t *ssd1306_ptr, uint8_t col_start, uint8_t col_end,
+        uint8_t page_start, uint8_t page_end, const uint8_t *data_ptr,
+        size_t data_size) {
+
+    if (ssd1306_ptr->initialized == false)
+        return SSD1306_NOINIT;
+    if (ssd1306_is_busy(ssd1306_ptr))
+        return SSD1306_BUSY;
 
     SSD1306_DECLARE_STATUS_VARIABLE()
-    uint8_t scroll_cmd;
 
-    switch (type) {
-        case RIGHT_HORIZONTAL_SCROLL:
-            scroll_cmd = SSD1306_CMD_RIGHT_HORIZONTAL_SCROLL;          break;
-        case LEFT_HORIZONTAL_SCROLL:
-            scroll_cmd = SSD1306_CMD_LEFT_HORIZONTAL_SCROLL;           break;
-        case VERTICAL_RIGHT_HORIZONTAL_SCROLL:
-            scroll_cmd = SSD1306_CMD_VERTICAL_RIGHT_HORIZONTAL_SCROLL; break;
-        case VERTICAL_LEFT_HORIZONTAL_SCROLL:
-            scroll_cmd = SSD1306_CMD_VERTICAL_LEFT_HORIZONTAL_SCROLL;  break;
-        default:
-            return SSD1306_WRONG_PARAMS;
+    // Queued commands lead the header, each one preceded by a single
+    // command control byte, as long as a data byte fits in the transaction.
+    // They are followed by the start line, until it has been applied.
+    uint8_t header[SSD1306_TX_MAX_HEADER_SIZE];
+    uint8_t line_seq = ssd1306_ptr->start_line_seq;
+    uint8_t line_cmd = 0x40 | (ssd1306_ptr->start_page << 3);
+    uint8_t line     = (line_seq != ssd1306_ptr->start_line_acked) ? 1 : 0;
+    size_t header_size = 2 * ((size_t)ssd1306_ptr->cmd_batch_len + line);
+
+    if (ssd1306_ptr->i2c_max_transfer != 0 &&
+            header_size + SSD1306_TX_HEADER_SIZE >= ssd1306_ptr->i2c_max_transfer) {
+        status = ssd1306_batch_send(ssd1306_ptr);
+        if (status != SSD1306_OK) return status;
+        header_size = 2 * line;
     }
 
-    // Common commands.
-    const uint8_t cmd_list[] = {
-            SSD1306_CMD_CONTROL_BYTE,
-            scroll_cmd, // Type of scrolling.
-            0x00,       // Dummy byte.
-            start_page,
-            interval,
-            end_page
-    };
+    if (line && ssd1306_ptr->i2c_max_transfer != 0 &&
+            header_size + SSD1306_TX_HEADER_SIZE >= ssd1306_ptr->i2c_max_transfer) {
+        status = ssd1306_start_line_send(ssd1306_ptr);
+        if (status != SSD1306_OK) return status;
+        line = 0;
+        header_size = 0;
+    }
 
-    SSD1306_DECLARE_COMMAND_WRITE_MULTI(cmd_list)
+    for (uint8_t i = 0; i < ssd1306_ptr->cmd_batch_len; i++) {
+        header[2 * i]     = SSD1306_CMD_SINGLE_CONTROL_BYTE;
+        header[2 * i + 1] = ssd1306_ptr->cmd_batch[i];
+    }
+    ssd1306_ptr->cmd_batch_len = 0;
 
-    switch (type) {
-        case RIGHT_HORIZONTAL_SCROLL:
-        case LEFT_HORIZONTAL_SCROLL:
-            SSD1306_DECLARE_COMMAND_WRITE(0x00); // dummy byte.
-            SSD1306_DECLARE_COMMAND_WRITE(0xFF); // dummy byte.
-            break;
-        case VERTICAL_RIGHT_HORIZONTAL_SCROLL:
-        case VERTICAL_LEFT_HORIZONTAL_SCROLL:
-            // Fixed vertical scrolling offset (1 row).
-            SSD1306_DECLARE_COMMAND_WRITE(0x01);
-            break;
+    if (line) {
+        header[header_size - 2] = SSD1306_CMD_SINGLE_CONTROL_BYTE;
+        header[header_size - 1] = line_cmd;
     }
 
-    // Starts scrolling.
-    return ssd1306_set_scroll_status(ssd1306_ptr, true);
+    ssd1306_window_header(&header[header_size], col_start, col_end,
+            page_start, page_end);
+    header_size += SSD1306_TX_HEADER_SIZE;
+
+    status = ssd1306_write_chunked(ssd1306_ptr, header, header_size,
+            data_ptr, data_size);
+
+    // Otherwise, the start line is sent again by the next transaction.
+    if (status == SSD1306_OK && line)
+        ssd1306_ptr->start_line_acked = line_seq;
+    return status;
 }
 
 
-///////////////////////////////////////////////////////////
-// DRAWING
-///////////////////////////////////////////////////////////
+/**
+ * Forgets the content of the display ram known from the last updates,
+ * so that the next ones send all the spans marked as dirty. It has to be
+ * called whenever the display ram is changed without the shadow being
+ * updated, i.e. by streaming, by scrolling or by a failed transaction.
+ * It has no effect if frame diffing is disabled.
+ *
+ * @param ssd1306_ptr a pointer to a ssd1306_t structure.
+ */
+static inline void
+ssd1306_shadow_reset(ssd1306_t *ssd1306_ptr) {
+#ifdef SSD1306_ENABLE_FRAME_DIFF
+    ssd1306_ptr->shadow_valid = 0;
+#else
+    (void)ssd1306_ptr;
+#endif
+}
 
-ssd1306_status_t
-ssd1306_goto_xy(ssd1306_t *ssd1306_ptr, uint8_t x, uint8_t y) {
 
-    if (x >= SSD1306_PXL_WIDTH || y >= SSD1306_PXL_HEIGHT)
-        return SSD1306_WRONG_PARAMS;
+#ifndef SSD1306_ENABLE_PAGE_MODE
 
-    ssd1306_ptr->x_pos = x;
-    ssd1306_ptr->y_pos = y;
+/**
+ * Looks for the next span to be sent, starting from the given page.
+ * If the span covers the whole page, it is extended to the following pages
+ * which have to be sent entirely, since they are contiguous both in the
+ * software buffer and in the display ram.
+ *
+ * @param  span_start the first column to be sent of each page.
+ * @param  span_end   the last column to be sent of each page.
+ * @param  page_start on input, the page to start from. On output,
+ *                    the first page of the span.
+ * @param  page_end   on output, the last page of the span.
+ * @return false if there is no span left to be sent.
+ */
+static bool
+ssd1306_next_span(const uint8_t *span_start, const uint8_t *span_end,
+        uint8_t *page_start, uint8_t *page_end) {
 
-    return SSD1306_OK;
+    uint8_t p = *page_start;
+
+    // Skips pages with nothing to be sent.
+    while (p < SSD1306_NUM_PAGES && span_start[p] > span_end[p])
+        p++;
+
+    if (p == SSD1306_NUM_PAGES) return false;
+
+    *page_start = p;
+
+    if (span_start[p] == 0 && span_end[p] == SSD1306_PXL_WIDTH - 1) {
+        while (p + 1 < SSD1306_NUM_PAGES && span_start[p + 1] == 0 &&
+                span_end[p + 1] == SSD1306_PXL_WIDTH - 1)
+            p++;
+    }
+
+    *page_end = p;
+    return true;
 }
 
 
-ssd1306_status_t
-ssd1306_draw_fill(ssd1306_t *ssd1306_ptr, ssd1306_color_t color) {
-    uint8_t pxl_color;
+#ifdef SSD1306_ENABLE_FRAME_DIFF
 
-    switch (color) {
-        case SSD1306_COLOR_BLACK:
-            pxl_color = (ssd1306_ptr->inverted) ? 0xFF : 0x00; break;
-        case SSD1306_COLOR_WHITE:
-            pxl_color = (ssd1306_ptr->inverted) ? 0x00 : 0xFF; break;
-        default:
-            return SSD1306_WRONG_PARAMS;
+/**
+ * Narrows the span of the given page to the first run of bytes which differ
+ * from the shadow. Runs separated by up to SSD1306_DIFF_MERGE_GAP unchanged
+ * bytes are merged, since sending them costs less than a new address window.
+ * If the shadow of the page is not valid, the span is left untouched.
+ * If nothing has changed, the span is marked as sent.
+ *
+ * @param  ssd1306_ptr a pointer to a ssd1306_t structure.
+ * @param  data       the software buffer to be sent.
+ * @param  span_start the first column to be sent of each page.
+ * @param  span_end   the last column to be sent of each page.
+ * @param  page       the page whose span is narrowed.
+ * @param  run_end    on output, the last column of the run.
+ * @return false if there is nothing to be sent in the page.
+ */
+static bool
+ssd1306_diff_span(const ssd1306_t *ssd1306_ptr, const uint8_t *data,
+        uint8_t *span_start, uint8_t *span_end, uint8_t page,
+        uint8_t *run_end) {
+
+    const uint8_t *new_ptr = &data[SSD1306_PXL_WIDTH * page];
+    const uint8_t *old_ptr = &ssd1306_ptr->shadow[SSD1306_PXL_WIDTH * page];
+    unsigned from = span_start[page], to = span_end[page], end;
+
+    if (from > to) return false;
+
+    if ((ssd1306_ptr->shadow_valid & (1u << page)) == 0) {
+        *run_end = (uint8_t)to;
+        return true;
+    }
+
+    while (from <= to && new_ptr[from] == old_ptr[from])
+        from++;
+
+    if (from > to) {
+        span_start[page] = SSD1306_CLEAN_PAGE_START;
+        span_end[page]   = 0;
+        return false;
+    }
+
+    // The run ends at the last change not followed by a longer gap.
+    end = from;
+    for (unsigned c = from + 1; c <= to && c - end <= SSD1306_DIFF_MERGE_GAP + 1;
+            c++) {
+        if (new_ptr[c] != old_ptr[c]) end = c;
+    }
+
+    span_start[page] = (uint8_t)from;
+    *run_end = (uint8_t)end;
+    return true;
+}
+
+#endif
+
+
+/**
+ * Looks for the next address window to be sent, starting from the given
+ * page. It is the next span (see ssd1306_next_span) or, if frame diffing
+ * is enabled, the next run of changed bytes within it, the pages being
+ * merged only if they have changed entirely.
+ *
+ * @param  ssd1306_ptr a pointer to a ssd1306_t structure.
+ * @param  data       the software buffer to be sent.
+ * @param  span_start the first column to be sent of each page, narrowed
+ *                    to the window on output.
+ * @param  span_end   the last column to be sent of each page.
+ * @param  page_start on input, the page to start from. On output,
+ *                    the first page of the window.
+ * @param  page_end   on output, the last page of the window.
+ * @param  col_end    on output, the last column of the window, whose first
+ *                    one is span_start[page_start].
+ * @return false if there is no window left to be sent.
+ */
+static bool
+ssd1306_next_window(const ssd1306_t *ssd1306_ptr, const uint8_t *data,
+        uint8_t *span_start, uint8_t *span_end, uint8_t *page_start,
+        uint8_t *page_end, uint8_t *col_end) {
+#ifdef SSD1306_ENABLE_FRAME_DIFF
+    uint8_t p, last, run_end, next_end;
+
+    // Spans with nothing changed are marked as sent, hence skipped.
+    do {
+        if (!ssd1306_next_span(span_start, span_end, page_start, &last))
+            return false;
+        p = *page_start;
+    } while (!ssd1306_diff_span(ssd1306_ptr, data, span_start, span_end, p,
+            &run_end));
+
+    if (span_start[p] == 0 && run_end == SSD1306_PXL_WIDTH - 1) {
+        while (p < last && ssd1306_diff_span(ssd1306_ptr, data, span_start,
+                span_end, p + 1, &next_end) &&
+                span_start[p + 1] == 0 && next_end == SSD1306_PXL_WIDTH - 1)
+            p++;
+    }
+
+    *page_end = p;
+    *col_end  = run_end;
+    return true;
+#else
+    (void)ssd1306_ptr;
+    (void)data;
+
+    if (!ssd1306_next_span(span_start, span_end, page_start, page_end))
+        return false;
+
+    *col_end = span_end[*page_start];
+    return true;
+#endif
+}
+
+
+/**
+ * Records the transmission of an address window found by
+ * ssd1306_next_window: its columns are removed from the spans and, if frame
+ * diffing is enabled, copied into the shadow.
+ *
+ * @param ssd1306_ptr a pointer to a ssd1306_t structure.
+ * @param data        the software buffer sent.
+ * @param span_start  the first column to be sent of each page.
+ * @param span_end    the last column to be sent of each page.
+ * @param page_start  the first page of the window.
+ * @param page_end    the last page of the window.
+ * @param col_end     the last column of the window.
+ */
+static void
+ssd1306_window_sent(ssd1306_t *ssd1306_ptr, const uint8_t *data,
+        uint8_t *span_start, uint8_t *span_end, uint8_t page_start,
+        uint8_t page_end, uint8_t col_end) {
+#ifdef SSD1306_ENABLE_FRAME_DIFF
+    uint8_t col_start = span_start[page_start];
+
+    for (uint8_t p = page_start; p <= page_end; p++) {
+        memcpy(&ssd1306_ptr->shadow[SSD1306_PXL_WIDTH * p + col_start],
+                &data[SSD1306_PXL_WIDTH * p + col_start],
+                col_end - col_start + 1);
+        // Partial windows of pages whose shadow is not valid do not make it so.
+        if (col_start == 0 && col_end == SSD1306_PXL_WIDTH - 1)
+            ssd1306_ptr->shadow_valid |= (uint8_t)(1u << p);
+    }
+#else
+    (void)ssd1306_ptr;
+    (void)data;
+#endif
+
+    // Windows of more than one page cover them entirely.
+    if (page_start == page_end && col_end < span_end[page_start]) {
+        span_start[page_start] = col_end + 1;
+        return;
+    }
+
+    for (uint8_t p = page_start; p <= page_end; p++) {
+        span_start[p] = SSD1306_CLEAN_PAGE_START;
+        span_end[p]   = 0;
+    }
+}
+
+#endif
+
+
+/**
+ * Extends the dirty span of the given page so that it includes
+ * the columns from col_start to col_end.
+ *
+ * @param ssd1306_ptr a pointer to a ssd1306_t structure.
+ * @param page        the page of the software buffer containing
+ *                    the modified columns.
+ * @param col_start   the first modified column.
+ * @param col_end     the last modified column.
+ */
+static inline void
+ssd1306_mark_dirty(ssd1306_t *ssd1306_ptr, uint8_t page, uint8_t col_start,
+        uint8_t col_end) {
+
+    if (col_start < ssd1306_ptr->dirty_start[page])
+        ssd1306_ptr->dirty_start[page] = col_start;
+    if (col_end > ssd1306_ptr->dirty_end[page])
+        ssd1306_ptr->dirty_end[page] = col_end;
+}
+
+
+/**
+ * Marks the whole software buffer as modified.
+ *
+ * @param ssd1306_ptr a pointer to a ssd1306_t structure.
+ */
+static void
+ssd1306_mark_all_dirty(ssd1306_t *ssd1306_ptr) {
+
+    memset(ssd1306_ptr->dirty_start, 0, sizeof(ssd1306_ptr->dirty_start));
+    memset(ssd1306_ptr->dirty_end, SSD1306_PXL_WIDTH - 1,
+            sizeof(ssd1306_ptr->dirty_end));
+}
+
+
+/**
+ * Returns whether the software buffer being drawn is also being transmitted.
+ * This is the case while a non-blocking update is in progress, unless
+ * double buffering is enabled.
+ *
+ * @param  ssd1306_ptr a pointer to a ssd1306_t structure.
+ * @return true if the software buffer cannot be modified.
+ */
+static inline bool
+ssd1306_buffer_locked(const ssd1306_t *ssd1306_ptr) {
+
+    return ssd1306_is_busy(ssd1306_ptr) &&
+            ssd1306_ptr->buffer == ssd1306_ptr->front_buffer;
+}
+
+
+/**
+ * Exchanges the front and back buffers once the back buffer has been
+ * submitted to the display. It has no effect if double buffering
+ * is disabled since both point to the same buffer.
+ *
+ * @param ssd1306_ptr a pointer to a ssd1306_t structure.
+ */
+static inline void
+ssd1306_swap_buffers(ssd1306_t *ssd1306_ptr) {
+
+    uint8_t *tmp_buffer = ssd1306_ptr->front_buffer;
+    ssd1306_ptr->front_buffer = ssd1306_ptr->buffer;
+    ssd1306_ptr->buffer       = tmp_buffer;
+}
+
+
+/**
+ * Marks the given page of the software buffer as in sync with the display.
+ *
+ * @param ssd1306_ptr a pointer to a ssd1306_t structure.
+ * @param page        the page to be marked as clean.
+ */
+static inline void
+ssd1306_mark_clean(ssd1306_t *ssd1306_ptr, uint8_t page) {
+
+    ssd1306_ptr->dirty_start[page] = SSD1306_CLEAN_PAGE_START;
+    ssd1306_ptr->dirty_end[page]   = 0;
+}
+
+
+/**
+ * Marks the spans left by a failed non-blocking update as dirty again.
+ * Its completion only records the failure, since it may run in interrupt
+ * context while the software buffer is being drawn: the spans are marked
+ * by the next update instead, from the context starting it.
+ * It has no effect if non-blocking updates are disabled.
+ *
+ * @param ssd1306_ptr a pointer to a ssd1306_t structure.
+ */
+static inline void
+ssd1306_async_recover(ssd1306_t *ssd1306_ptr) {
+#ifdef SSD1306_ENABLE_ASYNC
+    if (!ssd1306_ptr->tx_failed) return;
+
+    for (uint8_t p = 0; p < SSD1306_NUM_PAGES; p++) {
+        if (ssd1306_ptr->tx_start[p] <= ssd1306_ptr->tx_end[p])
+            ssd1306_mark_dirty(ssd1306_ptr, p,
+                    ssd1306_ptr->tx_start[p], ssd1306_ptr->tx_end[p]);
+    }
+    ssd1306_ptr->tx_failed = false;
+#else
+    (void)ssd1306_ptr;
+#endif
+}
+
+
+/**
+ * Translates a page of the display area into the page of the software
+ * buffer holding it. The software buffer mirrors the display ram, which
+ * is shown starting from the page set by ssd1306_scroll_up.
+ *
+ * @param  ssd1306_ptr a pointer to a ssd1306_t structure.
+ * @param  page        the page index, 0 being the top of the display.
+ * @return the index of the page within the software buffer.
+ */
+static inline uint8_t
+ssd1306_buffer_page(const ssd1306_t *ssd1306_ptr, uint8_t page) {
+
+    page += ssd1306_ptr->start_page;
+    return (page < SSD1306_NUM_PAGES) ? page : page - SSD1306_NUM_PAGES;
+}
+
+
+/**
+ * Returns a pointer to the first byte of the given page
+ * of the software buffer being drawn.
+ *
+ * @param  ssd1306_ptr a pointer to a ssd1306_t structure.
+ * @param  page        the page index, 0 being the top of the display.
+ * @return a pointer to the SSD1306_PXL_WIDTH bytes of the page, NULL if
+ *         the page is not held by the software buffer (page mode only).
+ */
+static inline uint8_t *
+ssd1306_page_ptr(ssd1306_t *ssd1306_ptr, uint8_t page) {
+#ifdef SSD1306_ENABLE_PAGE_MODE
+    // The buffer holds the band being rendered, in display order.
+    if (page < ssd1306_ptr->band_page ||
+            page >= ssd1306_ptr->band_page + SSD1306_BUFFER_PAGES)
+        return NULL;
+
+    return &ssd1306_ptr->buffer[
+            (page - ssd1306_ptr->band_page) * SSD1306_PXL_WIDTH];
+#else
+    return &ssd1306_ptr->buffer[
+            ssd1306_buffer_page(ssd1306_ptr, page) * SSD1306_PXL_WIDTH];
+#endif
+}
+
+
+/**
+ * Rectangle in display coordinates, both corners included.
+ */
+typedef struct {
+    int32_t x0; /*!< First column. */
+    int32_t y0; /*!< First row. */
+    int32_t x1; /*!< Last column. */
+    int32_t y1; /*!< Last row. */
+} ssd1306_rect_t;
+
+
+/**
+ * Returns the rectangle drawings are clipped to: the clip rectangle of the
+ * display, restricted in page mode to the band being rendered. Every pixel
+ * within it is held by the software buffer, hence primitives clipped to it
+ * need no further check.
+ *
+ * @param  ssd1306_ptr a pointer to a ssd1306_t structure.
+ * @return the clip rectangle, empty if x0 > x1 or y0 > y1.
+ */
+static inline ssd1306_rect_t
+ssd1306_clip_rect(const ssd1306_t *ssd1306_ptr) {
+
+    ssd1306_rect_t clip = {
+        ssd1306_ptr->clip_x0, ssd1306_ptr->clip_y0,
+        ssd1306_ptr->clip_x1, ssd1306_ptr->clip_y1
+    };
+
+#ifdef SSD1306_ENABLE_PAGE_MODE
+    clip.y0 = MAX(clip.y0, ssd1306_ptr->band_page << 3);
+    clip.y1 = MIN(clip.y1,
+            ((ssd1306_ptr->band_page + SSD1306_BUFFER_PAGES) << 3) - 1);
+#endif
+    return clip;
+}
+
+
+/**
+ * Returns the mask of the rows of the given page lying from y0 to y1,
+ * the page being one of those holding them.
+ *
+ * @param  page the page index.
+ * @param  y0   the first row.
+ * @param  y1   the last row.
+ * @return the mask of the rows, the LSB being the top row of the page.
+ */
+static inline uint8_t
+ssd1306_page_mask(int32_t page, int32_t y0, int32_t y1) {
+
+    uint8_t mask = 0xFF;
+    if (page == (y0 >> 3)) mask &= 0xFF << (y0 & 0x7);
+    if (page == (y1 >> 3)) mask &= 0xFF >> (7 - (y1 & 0x7));
+    return mask;
+}
+
+
+/**
+ * Operations on the bits of the software buffer, to which the color and the
+ * raster operation of a primitive are resolved once before drawing it.
+ */
+typedef enum {
+    SSD1306_OP_NONE   = 0, /*!< Bits are left untouched. */
+    SSD1306_OP_SET    = 1, /*!< Bits are set. */
+    SSD1306_OP_CLEAR  = 2, /*!< Bits are cleared. */
+    SSD1306_OP_INVERT = 3  /*!< Bits are inverted. */
+} ssd1306_op_t;
+
+/// Bits cleared, then inverted, by each operation (see ssd1306_rop_word).
+static const uint32_t ssd1306_op_clear[]  = { 0, 0xFFFFFFFF, 0xFFFFFFFF, 0 };
+static const uint32_t ssd1306_op_toggle[] = { 0, 0xFFFFFFFF, 0, 0xFFFFFFFF };
+
+
+/**
+ * Resolves the given color to the operation drawing it, according to the
+ * raster operation of the display and to the inversion of its color.
+ *
+ * @param  ssd1306_ptr a pointer to a ssd1306_t structure.
+ * @param  color       the color of the pixels to draw.
+ * @return the operation to apply to their bits.
+ */
+static inline ssd1306_op_t
+ssd1306_color_op(const ssd1306_t *ssd1306_ptr, ssd1306_color_t color) {
+
+    // Operations drawing black and white pixels for each raster operation.
+    // Lit pixels are cleared bits when the display color is inverted.
+    static const uint8_t ops[2][4][2] = {
+        {
+            { SSD1306_OP_CLEAR, SSD1306_OP_SET    }, // SSD1306_ROP_COPY
+            { SSD1306_OP_NONE,  SSD1306_OP_SET    }, // SSD1306_ROP_OR
+            { SSD1306_OP_NONE,  SSD1306_OP_CLEAR  }, // SSD1306_ROP_AND_NOT
+            { SSD1306_OP_NONE,  SSD1306_OP_INVERT }  // SSD1306_ROP_XOR
+        }, {
+            { SSD1306_OP_SET,   SSD1306_OP_CLEAR  },
+            { SSD1306_OP_NONE,  SSD1306_OP_CLEAR  },
+            { SSD1306_OP_NONE,  SSD1306_OP_SET    },
+            { SSD1306_OP_NONE,  SSD1306_OP_INVERT }
+        }
+    };
+
+    return (ssd1306_op_t)ops[ssd1306_ptr->inverted][ssd1306_ptr->rop]
+            [color == SSD1306_COLOR_WHITE];
+}
+
+
+/**
+ * Combines a word of the software buffer, i.e. four adjacent columns of a
+ * page, with the given bits: the ink operation is applied to the bits set in
+ * bits, the back operation to the other bits selected by mask. Bytes are
+ * independent lanes, so that the same code serves single bytes as well, and
+ * operations are given as masks (see ssd1306_op_clear and ssd1306_op_toggle)
+ * so that no branch is needed.
+ *
+ * @param  dst  the word of the buffer.
+ * @param  bits the bits drawn by the ink, within mask.
+ * @param  mask the bits to combine.
+ * @param  ops  the bits cleared and inverted by the ink operation,
+ *              then those cleared and inverted by the back operation.
+ * @return the combined word.
+ */
+static inline uint32_t
+ssd1306_rop_word(uint32_t dst, uint32_t bits, uint32_t mask,
+        const uint32_t ops[4]) {
+
+    uint32_t back_bits = ~bits & mask;
+    uint32_t clear  = (bits & ops[0]) | (back_bits & ops[2]);
+    uint32_t toggle = (bits & ops[1]) | (back_bits & ops[3]);
+
+    return (dst & ~clear) ^ toggle;
+}
+
+
+/**
+ * Combines width bytes of a page of the software buffer with a row of source
+ * bytes, by means of ssd1306_rop_word, four columns at a time. Each source
+ * byte is shifted right by rshift, then left by lshift: bits moving across
+ * bytes are discarded by mask, which must only select bits filled by the
+ * shift of the same byte.
+ *
+ * @param dst    a pointer to the first byte of the buffer.
+ * @param src    a pointer to the first source byte, NULL to draw mask alone,
+ *               in which case back is not applied.
+ * @param width  the number of bytes.
+ * @param rshift the right shift of the source bytes.
+ * @param lshift the left shift of the source bytes.
+ * @param mask   the rows to combine.
+ * @param ink    the operation applied to the source bits.
+ * @param back   the operation applied to the other rows.
+ */
+static void
+ssd1306_rop_row(uint8_t *dst, const uint8_t *src, int32_t width,
+        uint8_t rshift, uint8_t lshift, uint8_t mask,
+        ssd1306_op_t ink, ssd1306_op_t back) {
+
+    // Masks are loaded once: stores into the buffer could alias the tables.
+    const uint32_t ops[4] = {
+        ssd1306_op_clear[ink],  ssd1306_op_toggle[ink],
+        ssd1306_op_clear[back], ssd1306_op_toggle[back]
+    };
+    uint32_t mask32 = mask * (uint32_t)0x01010101;
+    uint32_t word, src_word;
+    int32_t  i = 0;
+
+    if (src == NULL) {
+        // The drawn bits are the same for all the columns: each word is
+        // cleared and inverted by constant masks.
+        uint32_t clear  = mask32 & ops[0], toggle = mask32 & ops[1];
+
+        for (; i + 4 <= width; i += 4) {
+            memcpy(&word, &dst[i], sizeof(word));
+            word = (word & ~clear) ^ toggle;
+            memcpy(&dst[i], &word, sizeof(word));
+        }
+        for (; i < width; i++)
+            dst[i] = (uint8_t)((dst[i] & ~clear) ^ toggle);
+        return;
+    }
+
+    // Words are accessed by means of memcpy, which compiles to single loads
+    // and stores where unaligned accesses are allowed.
+    for (; i + 4 <= width; i += 4) {
+        memcpy(&src_word, &src[i], sizeof(src_word));
+        memcpy(&word, &dst[i], sizeof(word));
+        word = ssd1306_rop_word(word, ((src_word >> rshift) << lshift) & mask32,
+                mask32, ops);
+        memcpy(&dst[i], &word, sizeof(word));
+    }
+    for (; i < width; i++) {
+        uint32_t bits = ((uint32_t)(src[i] >> rshift) << lshift) & mask;
+        dst[i] = (uint8_t)ssd1306_rop_word(dst[i], bits, mask, ops);
+    }
+}
+
+
+/**
+ * Draws the given pixel of the software buffer. The pixel must lie within
+ * the rectangle returned by ssd1306_clip_rect: it is not checked.
+ *
+ * @param ssd1306_ptr a pointer to a ssd1306_t structure.
+ * @param x           the x coordinate of the pixel, in display coordinates.
+ * @param y           the y coordinate of the pixel, in display coordinates.
+ * @param op          the operation applied to the pixel.
+ */
+static inline void
+ssd1306_plot(ssd1306_t *ssd1306_ptr, int32_t x, int32_t y, ssd1306_op_t op) {
+
+    uint8_t *page_ptr = ssd1306_page_ptr(ssd1306_ptr, y >> 3);
+    uint8_t  bit      = 1 << (y & 0x7);
+
+    // Branches are taken the same way for all the pixels of a primitive.
+    switch (op) {
+        case SSD1306_OP_SET:    page_ptr[x] |= bit;  break;
+        case SSD1306_OP_CLEAR:  page_ptr[x] &= ~bit; break;
+        case SSD1306_OP_INVERT: page_ptr[x] ^= bit;  break;
+        default: break;
+    }
+
+    ssd1306_mark_dirty(ssd1306_ptr, ssd1306_buffer_page(ssd1306_ptr, y >> 3),
+            x, x);
+    SSD1306_STATS_ADD(pixels, 1);
+}
+
+
+/**
+ * Computes the Cohen-Sutherland outcode of the given point, telling on
+ * which sides of the clip rectangle it lies.
+ *
+ * @param  clip the clip rectangle.
+ * @param  x    the x coordinate of the point.
+ * @param  y    the y coordinate of the point.
+ * @return a combination of the SSD1306_OUT_* flags, 0 if within the rectangle.
+ */
+static inline uint8_t
+ssd1306_outcode(const ssd1306_rect_t *clip, int32_t x, int32_t y) {
+
+    uint8_t code = 0;
+
+    if (x < clip->x0)      code |= SSD1306_OUT_LEFT;
+    else if (x > clip->x1) code |= SSD1306_OUT_RIGHT;
+    if (y < clip->y0)      code |= SSD1306_OUT_TOP;
+    else if (y > clip->y1) code |= SSD1306_OUT_BOTTOM;
+    return code;
+}
+
+
+/**
+ * Fills the area from (x0,y0) to (x1,y1), both included and given in display
+ * coordinates, working on whole buffer words: each page is processed once,
+ * with a mask selecting the rows of the area it holds. Coordinates may lie
+ * anywhere: the area is clipped to the clip rectangle.
+ *
+ * @param  ssd1306_ptr a pointer to a ssd1306_t structure.
+ * @param  x0          the x coordinate of the top-left corner.
+ * @param  y0          the y coordinate of the top-left corner.
+ * @param  x1          the x coordinate of the bottom-right corner.
+ * @param  y1          the y coordinate of the bottom-right corner.
+ * @param  color       color of the area. Valid colors are offered by
+ *                     the ssd1306_color_t enumeration.
+ * @return the outcome of the function call.
+ */
+static ssd1306_status_t
+ssd1306_fill_area(ssd1306_t *ssd1306_ptr, int32_t x0, int32_t y0,
+        int32_t x1, int32_t y1, ssd1306_color_t color) {
+
+    if (ssd1306_buffer_locked(ssd1306_ptr))
+        return SSD1306_BUSY;
+    if (color != SSD1306_COLOR_BLACK && color != SSD1306_COLOR_WHITE)
+        return SSD1306_WRONG_PARAMS;
+
+    ssd1306_op_t   op   = ssd1306_color_op(ssd1306_ptr, color);
+    ssd1306_rect_t clip = ssd1306_clip_rect(ssd1306_ptr);
+    x0 = MAX(x0, clip.x0); y0 = MAX(y0, clip.y0);
+    x1 = MIN(x1, clip.x1); y1 = MIN(y1, clip.y1);
+    if (x0 > x1 || y0 > y1 || op == SSD1306_OP_NONE) return SSD1306_OK;
+
+    uint8_t width = x1 - x0 + 1;
+    SSD1306_STATS_ADD(primitives, 1);
+
+    for (uint8_t p = y0 >> 3; p <= (y1 >> 3); p++) {
+        // Rows of the area held by this page.
+        uint8_t mask = ssd1306_page_mask(p, y0, y1);
+
+        uint8_t *byte_ptr = ssd1306_page_ptr(ssd1306_ptr, p);
+        if (byte_ptr == NULL) continue;
+        byte_ptr += x0;
+        SSD1306_STATS_PIXELS(mask, width);
+
+        if (mask == 0xFF && op != SSD1306_OP_INVERT)
+            memset(byte_ptr, (op == SSD1306_OP_SET) ? 0xFF : 0x00, width);
+        else
+            ssd1306_rop_row(byte_ptr, NULL, width, 0, 0, mask, op, SSD1306_OP_NONE);
+
+        ssd1306_mark_dirty(ssd1306_ptr, ssd1306_buffer_page(ssd1306_ptr, p),
+                x0, x1);
+    }
+
+    return SSD1306_OK;
+}
+
+
+/**
+ * Fills the horizontal span from x0 to x1 of row y, both ends included,
+ * given in any order and in display coordinates, by means of
+ * ssd1306_fill_area, which clips it.
+ *
+ * @param  ssd1306_ptr a pointer to a ssd1306_t structure.
+ * @param  x0          the x coordinate of one end of the span.
+ * @param  x1          the x coordinate of the other end of the span.
+ * @param  y           the y coordinate of the span.
+ * @param  color       color of the span. Valid colors are offered by
+ *                     the ssd1306_color_t enumeration.
+ * @return the outcome of the function call.
+ */
+static ssd1306_status_t
+ssd1306_fill_span(ssd1306_t *ssd1306_ptr, int32_t x0, int32_t x1, int32_t y,
+        ssd1306_color_t color) {
+
+    if (x0 > x1) { int32_t tmp = x0; x0 = x1; x1 = tmp; }
+
+    return ssd1306_fill_area(ssd1306_ptr, x0, y, x1, y, color);
+}
+
+
+/**
+ * Draws a bitmap encoded in the same layout of the software buffer:
+ * (h + 7) / 8 pages of w bytes, the LSB of each byte being the top row
+ * of the page. Each source byte is shifted and masked into the one or two
+ * buffer bytes it overlaps, four columns at a time, so that no per-pixel work
+ * is needed. The bitmap is clipped to the clip rectangle.
+ *
+ * @param  ssd1306_ptr a pointer to a ssd1306_t structure.
+ * @param  x           the x coordinate of the top-left corner, in display
+ *                     coordinates.
+ * @param  y           the y coordinate of the top-left corner, in display
+ *                     coordinates.
+ * @param  src         a pointer to the page-major bitmap.
+ * @param  w           the width of the bitmap in pixels.
+ * @param  h           the height of the bitmap in pixels.
+ * @param  color       color of the set pixels. Valid colors are offered
+ *                     by the ssd1306_color_t enumeration.
+ * @param  mode        how set and unset pixels are combined with the buffer.
+ *                     Valid modes are offered by the ssd1306_text_mode_t
+ *                     enumeration.
+ * @return the outcome of the function call.
+ */
+static ssd1306_status_t
+ssd1306_blit(ssd1306_t *ssd1306_ptr, int32_t x, int32_t y, const uint8_t *src,
+        uint8_t w, uint8_t h, ssd1306_color_t color, ssd1306_text_mode_t mode) {
+
+    if (ssd1306_buffer_locked(ssd1306_ptr))
+        return SSD1306_BUSY;
+    if (color != SSD1306_COLOR_BLACK && color != SSD1306_COLOR_WHITE)
+        return SSD1306_WRONG_PARAMS;
+    if (mode != SSD1306_TEXT_OPAQUE && mode != SSD1306_TEXT_TRANSPARENT &&
+            mode != SSD1306_TEXT_XOR)
+        return SSD1306_WRONG_PARAMS;
+
+    // Clips columns, while rows are clipped by the mask of each page.
+    ssd1306_rect_t clip = ssd1306_clip_rect(ssd1306_ptr);
+    int32_t col_start = MAX(clip.x0 - x, 0);
+    int32_t col_end   = MIN(clip.x1 + 1 - x, w);
+    if (col_start >= col_end || y > clip.y1 || y + h <= clip.y0)
+        return SSD1306_OK;
+
+    // Set pixels are drawn in the color, unset ones in the opposite color
+    // if opaque. XOR inverts set pixels whatever the color.
+    ssd1306_op_t ink  = (mode == SSD1306_TEXT_XOR) ? SSD1306_OP_INVERT :
+            ssd1306_color_op(ssd1306_ptr, color);
+    ssd1306_op_t back = (mode != SSD1306_TEXT_OPAQUE) ? SSD1306_OP_NONE :
+            ssd1306_color_op(ssd1306_ptr, (color == SSD1306_COLOR_WHITE) ?
+                    SSD1306_COLOR_BLACK : SSD1306_COLOR_WHITE);
+    if (ink == SSD1306_OP_NONE && back == SSD1306_OP_NONE) return SSD1306_OK;
+
+    uint8_t shift     = y & 0x7;
+    int32_t dst_page  = y >> 3; // Arithmetic shift: rounds towards -inf.
+    uint8_t src_pages = (h + 7) >> 3;
+    int32_t width     = col_end - col_start;
+    SSD1306_STATS_ADD(primitives, 1);
+
+    for (uint8_t k = 0; k < src_pages; k++, dst_page++, src += w) {
+        // Rows of the bitmap held by this source page.
+        uint8_t valid = ((k == src_pages - 1) && (h & 0x7)) ?
+                0xFF >> (8 - (h & 0x7)) : 0xFF;
+
+        // Each source page overlaps two buffer pages, unless aligned.
+        for (uint8_t half = 0; half < ((shift) ? 2 : 1); half++) {
+            int32_t page = dst_page + half;
+            if (page < (clip.y0 >> 3) || page > (clip.y1 >> 3)) continue;
+
+            uint8_t rshift = (half) ? 8 - shift : 0;
+            uint8_t lshift = (half) ? 0 : shift;
+            uint8_t mask   = (uint8_t)((valid >> rshift) << lshift) &
+                    ssd1306_page_mask(page, clip.y0, clip.y1);
+            if (mask == 0) continue;
+
+            uint8_t *byte_ptr = ssd1306_page_ptr(ssd1306_ptr, page);
+            if (byte_ptr == NULL) continue;
+            byte_ptr += x + col_start;
+            const uint8_t *src_ptr = src + col_start;
+            SSD1306_STATS_PIXELS(mask, width);
+
+            // Whole aligned pages drawn opaque are copied as they are.
+            if (mask == 0xFF && shift == 0 &&
+                    ink == SSD1306_OP_SET && back == SSD1306_OP_CLEAR)
+                memcpy(byte_ptr, src_ptr, width);
+            else
+                ssd1306_rop_row(byte_ptr, src_ptr, width, rshift, lshift, mask,
+                        ink, back);
+
+            ssd1306_mark_dirty(ssd1306_ptr, ssd1306_buffer_page(ssd1306_ptr, page),
+                    x + col_start, x + col_end - 1);
+        }
+    }
+
+    return SSD1306_OK;
+}
+
+
+/**
+ * Draws the segment from (x0,y0) to (x1,y1), both ends included and given
+ * in display coordinates. Horizontal and vertical segments are drawn by
+ * means of ssd1306_fill_area. The other ones are drawn with Bresenham's
+ * algorithm, which steps the major axis at each pixel: pixel i is offset
+ * along the minor axis by floor((2 * i * minor + major) / (2 * major)).
+ * Segments entirely outside of the clip rectangle are rejected by their
+ * Cohen-Sutherland outcodes, while the pixels of the other ones lying within
+ * the rectangle are found once, as a range of steps. Clipping thus neither
+ * checks single pixels nor moves them, so that a segment drawn across the
+ * bands of page mode or across viewports stays the same.
+ *
+ * @param  ssd1306_ptr a pointer to a ssd1306_t structure.
+ * @param  x0          the x coordinate of the first end.
+ * @param  y0          the y coordinate of the first end.
+ * @param  x1          the x coordinate of the second end.
+ * @param  y1          the y coordinate of the second end.
+ * @param  color       color of the segment. Valid colors are offered by
+ *                     the ssd1306_color_t enumeration.
+ * @param  last        false to leave out the second end, so that joined
+ *                     segments draw their common ends once (e.g. in XOR mode).
+ * @return the outcome of the function call.
+ */
+static ssd1306_status_t
+ssd1306_line(ssd1306_t *ssd1306_ptr, int32_t x0, int32_t y0,
+        int32_t x1, int32_t y1, ssd1306_color_t color, bool last) {
+
+    if (!last && x0 == x1 && y0 == y1) return SSD1306_OK;
+
+    // Horizontal and vertical segments are drawn a byte at a time,
+    // their second end being moved one pixel back if left out.
+    if (x0 == x1 || y0 == y1) {
+        if (!last) {
+            x1 -= (x1 > x0) - (x1 < x0);
+            y1 -= (y1 > y0) - (y1 < y0);
+        }
+        return ssd1306_fill_area(ssd1306_ptr, MIN(x0, x1), MIN(y0, y1),
+                MAX(x0, x1), MAX(y0, y1), color);
+    }
+
+    if (ssd1306_buffer_locked(ssd1306_ptr))
+        return SSD1306_BUSY;
+    if (color != SSD1306_COLOR_BLACK && color != SSD1306_COLOR_WHITE)
+        return SSD1306_WRONG_PARAMS;
+
+    ssd1306_rect_t clip = ssd1306_clip_rect(ssd1306_ptr);
+    uint8_t code0 = ssd1306_outcode(&clip, x0, y0);
+    uint8_t code1 = ssd1306_outcode(&clip, x1, y1);
+
+    // Both ends beyond the same edge: the segment is entirely outside.
+    if (code0 & code1) return SSD1306_OK;
+
+    // Major (u) and minor (v) axes, with their direction and clip range.
+    bool    x_major = ABS(x1 - x0) >= ABS(y1 - y0);
+    int32_t u0 = (x_major) ? x0 : y0, u1 = (x_major) ? x1 : y1;
+    int32_t v0 = (x_major) ? y0 : x0, v1 = (x_major) ? y1 : x1;
+    int32_t u_min = (x_major) ? clip.x0 : clip.y0;
+    int32_t u_max = (x_major) ? clip.x1 : clip.y1;
+    int32_t v_min = (x_major) ? clip.y0 : clip.x0;
+    int32_t v_max = (x_major) ? clip.y1 : clip.x1;
+    int32_t major = ABS(u1 - u0), minor = ABS(v1 - v0);
+    int32_t su = (u0 < u1) ? 1 : -1, sv = (v0 < v1) ? 1 : -1;
+    int32_t i_start = 0, i_end = (last) ? major : major - 1;
+
+    if (code0 | code1) {
+        // Steps keeping the major axis within the clip range.
+        i_start = MAX(i_start, (su > 0) ? u_min - u0 : u0 - u_max);
+        i_end   = MIN(i_end,   (su > 0) ? u_max - u0 : u0 - u_min);
+
+        // Steps keeping the minor offset from m_lo to m_hi, the offset
+        // being a non-decreasing function of the step.
+        int64_t m_lo = (sv > 0) ? v_min - v0 : v0 - v_max;
+        int64_t m_hi = (sv > 0) ? v_max - v0 : v0 - v_min;
+        if (m_hi < 0) return SSD1306_OK;
+        if (m_lo > 0)
+            i_start = MAX(i_start, (int32_t)(((2 * m_lo - 1) * major +
+                    2 * minor - 1) / (2 * minor)));
+        i_end = MIN(i_end, (int32_t)(((2 * m_hi + 1) * major - 1) /
+                (2 * minor)));
+
+        if (i_start > i_end) return SSD1306_OK;
+    }
+
+    ssd1306_op_t op = ssd1306_color_op(ssd1306_ptr, color);
+    if (op == SSD1306_OP_NONE) return SSD1306_OK;
+    SSD1306_STATS_ADD(primitives, 1);
+
+    // Bresenham's algorithm, starting from the first visible step:
+    // the minor offset is incremented whenever the remainder overflows.
+    int64_t num = 2 * (int64_t)i_start * minor + major;
+    int32_t m   = (int32_t)(num / (2 * major));
+    int32_t rem = (int32_t)(num % (2 * major));
+
+    for (int32_t i = i_start; i <= i_end; i++) {
+        int32_t u = u0 + su * i, v = v0 + sv * m;
+
+        if (x_major)
+            ssd1306_plot(ssd1306_ptr, u, v, op);
+        else
+            ssd1306_plot(ssd1306_ptr, v, u, op);
+
+        rem += 2 * minor;
+        if (rem >= 2 * major) { rem -= 2 * major; m++; }
+    }
+
+    return SSD1306_OK;
+}
+
+
+///////////////////////////////////////////////////////////
+///////////////////////////////////////////////////////////
+// PUBLIC API
+///////////////////////////////////////////////////////////
+///////////////////////////////////////////////////////////
+
+///////////////////////////////////////////////////////////
+// FUNDAMENTAL COMMANDS
+///////////////////////////////////////////////////////////
+
+ssd1306_status_t
+ssd1306_display_on(ssd1306_t *ssd1306_ptr) {
+
+    SSD1306_DECLARE_STATUS_VARIABLE()
+
+    const uint8_t cmd_list[] = {
+            SSD1306_CMD_CONTROL_BYTE,
+            SSD1306_CMD_CHARGE_PUMP_SETTING,
+            SSD1306_SUBCMD_ENABLE_CHARGE_PUMP,
+            SSD1306_CMD_DISPLAYON
+    };
+
+    SSD1306_DECLARE_COMMAND_WRITE_MULTI(cmd_list)
+    return SSD1306_OK;
+}
+
+
+ssd1306_status_t
+ssd1306_display_off(ssd1306_t *ssd1306_ptr) {
+
+    SSD1306_DECLARE_STATUS_VARIABLE()
+
+    const uint8_t cmd_list[] = {
+            SSD1306_CMD_CONTROL_BYTE,
+            SSD1306_CMD_CHARGE_PUMP_SETTING,
+            SSD1306_SUBCMD_DISABLE_CHARGE_PUMP,
+            SSD1306_CMD_DISPLAYOFF
+    };
+
+    SSD1306_DECLARE_COMMAND_WRITE_MULTI(cmd_list)
+    return SSD1306_OK;
+}
+
+
+ssd1306_status_t
+ssd1306_set_contrast(ssd1306_t *ssd1306_ptr, uint8_t contrast_value) {
+
+    SSD1306_DECLARE_STATUS_VARIABLE()
+
+    const uint8_t cmd_list[] = {
+            SSD1306_CMD_CONTROL_BYTE,
+            SSD1306_CMD_SETCONTRAST,
+            contrast_value
+    };
+
+    SSD1306_DECLARE_COMMAND_WRITE_MULTI(cmd_list)
+    return SSD1306_OK;
+}
+
+
+ssd1306_status_t
+ssd1306_set_inversion(ssd1306_t *ssd1306_ptr, bool is_inverted) {
+
+    SSD1306_DECLARE_STATUS_VARIABLE()
+
+    const uint8_t cmd_list[] = {
+            SSD1306_CMD_CONTROL_BYTE,
+            (is_inverted) ?
+                    SSD1306_CMD_INVERTDISPLAY : SSD1306_CMD_NORMALDISPLAY
+    };
+
+    SSD1306_DECLARE_COMMAND_WRITE_MULTI(cmd_list)
+
+    ssd1306_ptr->inverted = is_inverted;
+    return SSD1306_OK;
+}
+
+
+///////////////////////////////////////////////////////////
+// COMMAND BATCHING
+///////////////////////////////////////////////////////////
+
+ssd1306_status_t
+ssd1306_begin_batch(ssd1306_t *ssd1306_ptr) {
+
+    if (ssd1306_ptr->initialized == false)
+        return SSD1306_NOINIT;
+
+    ssd1306_ptr->batching = true;
+    return SSD1306_OK;
+}
+
+
+ssd1306_status_t
+ssd1306_commit_batch(ssd1306_t *ssd1306_ptr) {
+
+    if (ssd1306_ptr->initialized == false)
+        return SSD1306_NOINIT;
+
+    ssd1306_ptr->batching = false;
+    return ssd1306_batch_send(ssd1306_ptr);
+}
+
+
+///////////////////////////////////////////////////////////
+// SCROLLING
+///////////////////////////////////////////////////////////
+
+ssd1306_status_t
+ssd1306_set_scroll_status(ssd1306_t *ssd1306_ptr, bool is_scrolling) {
+
+    SSD1306_DECLARE_STATUS_VARIABLE()
+
+    const uint8_t cmd_list[] = {
+            SSD1306_CMD_CONTROL_BYTE,
+            (is_scrolling) ?
+                    SSD1306_CMD_ACTIVATE_SCROLL : SSD1306_CMD_DEACTIVATE_SCROLL
+    };
+
+    SSD1306_DECLARE_COMMAND_WRITE_MULTI(cmd_list)
+
+    // Scrolling moves the content of the display ram.
+    ssd1306_ptr->scrolling = is_scrolling;
+    ssd1306_shadow_reset(ssd1306_ptr);
+    return SSD1306_OK;
+}
+
+
+ssd1306_status_t
+ssd1306_scroll(ssd1306_t *ssd1306_ptr, ssd1306_scroll_t type,
+        ssd1306_page_t start_page, ssd1306_page_t end_page,
+        ssd1306_time_int_t interval) {
+
+    SSD1306_DECLARE_STATUS_VARIABLE()
+    uint8_t scroll_cmd;
+
+    switch (type) {
+        case RIGHT_HORIZONTAL_SCROLL:
+            scroll_cmd = SSD1306_CMD_RIGHT_HORIZONTAL_SCROLL;          break;
+        case LEFT_HORIZONTAL_SCROLL:
+            scroll_cmd = SSD1306_CMD_LEFT_HORIZONTAL_SCROLL;           break;
+        case VERTICAL_RIGHT_HORIZONTAL_SCROLL:
+            scroll_cmd = SSD1306_CMD_VERTICAL_RIGHT_HORIZONTAL_SCROLL; break;
+        case VERTICAL_LEFT_HORIZONTAL_SCROLL:
+            scroll_cmd = SSD1306_CMD_VERTICAL_LEFT_HORIZONTAL_SCROLL;  break;
+        default:
+            return SSD1306_WRONG_PARAMS;
+    }
+
+    // Scrolling setup and activation, within the same transaction.
+    uint8_t cmd_list[] = {
+            SSD1306_CMD_CONTROL_BYTE,
+            scroll_cmd, // Type of scrolling.
+            0x00,       // Dummy byte.
+            start_page,
+            interval,
+            end_page,
+            0x00,       // Dummy byte, or fixed vertical scrolling offset.
+            0xFF,       // Dummy byte.
+            SSD1306_CMD_ACTIVATE_SCROLL
+    };
+    uint8_t cmd_list_size = sizeof(cmd_list);
+
+    if (type == VERTICAL_RIGHT_HORIZONTAL_SCROLL ||
+            type == VERTICAL_LEFT_HORIZONTAL_SCROLL) {
+        // Fixed vertical scrolling offset (1 row), no trailing dummy byte.
+        cmd_list[6] = 0x01;
+        cmd_list[7] = SSD1306_CMD_ACTIVATE_SCROLL;
+        cmd_list_size--;
+    }
+
+    status = ssd1306_cmd_write_multi(ssd1306_ptr, cmd_list, cmd_list_size);
+    if (status != SSD1306_OK) return status;
+
+    ssd1306_ptr->scrolling = true;
+    return SSD1306_OK;
+}
+
+
+ssd1306_status_t
+ssd1306_scroll_up(ssd1306_t *ssd1306_ptr, uint8_t pages) {
+
+    if (ssd1306_ptr->initialized == false)
+        return SSD1306_NOINIT;
+    if (ssd1306_buffer_locked(ssd1306_ptr))
+        return SSD1306_BUSY;
+    // The display ram wraps around after 64 rows, hence the whole
+    // ram must be shown for the software buffer to act as a ring.
+    if (SSD1306_NUM_PAGES != 8 || pages > SSD1306_NUM_PAGES)
+        return SSD1306_WRONG_PARAMS;
+
+    uint8_t start_page = ssd1306_buffer_page(ssd1306_ptr, pages % SSD1306_NUM_PAGES);
+
+#ifndef SSD1306_ENABLE_PAGE_MODE
+    // The pages scrolled out at the top are exposed at the bottom.
+    // In page mode, they are cleared by the next rendering instead.
+    for (uint8_t p = 0; p < pages; p++) {
+        uint8_t page = ssd1306_buffer_page(ssd1306_ptr, p);
+        memset(&ssd1306_ptr->buffer[page * SSD1306_PXL_WIDTH], 0,
+                SSD1306_PXL_WIDTH);
+        ssd1306_mark_dirty(ssd1306_ptr, page, 0, SSD1306_PXL_WIDTH - 1);
+    }
+#endif
+
+    // The start line is moved by the next update, within the same
+    // transaction as its first span, and sent again until it succeeds.
+    ssd1306_ptr->start_page = start_page;
+    ssd1306_ptr->start_line_seq++;
+    return SSD1306_OK;
+}
+
+
+///////////////////////////////////////////////////////////
+// DRAWING
+///////////////////////////////////////////////////////////
+
+ssd1306_status_t
+ssd1306_goto_xy(ssd1306_t *ssd1306_ptr, uint8_t x, uint8_t y) {
+
+    if (x >= SSD1306_PXL_WIDTH || y >= SSD1306_PXL_HEIGHT)
+        return SSD1306_WRONG_PARAMS;
+
+    ssd1306_ptr->x_pos = x;
+    ssd1306_ptr->y_pos = y;
+
+    return SSD1306_OK;
+}
+
+
+ssd1306_status_t
+ssd1306_set_origin(ssd1306_t *ssd1306_ptr, int16_t x, int16_t y) {
+
+    ssd1306_ptr->origin_x = x;
+    ssd1306_ptr->origin_y = y;
+
+    return SSD1306_OK;
+}
+
+
+ssd1306_status_t
+ssd1306_set_clip(ssd1306_t *ssd1306_ptr, uint8_t x, uint8_t y,
+        uint8_t w, uint8_t h) {
+
+    if (w == 0 || h == 0)
+        return SSD1306_WRONG_PARAMS;
+
+    // A rectangle outside of the display leaves clip_x0 > clip_x1 or
+    // clip_y0 > clip_y1, i.e. an empty clip rectangle.
+    ssd1306_ptr->clip_x0 = x;
+    ssd1306_ptr->clip_y0 = y;
+    ssd1306_ptr->clip_x1 = MIN(x + w - 1, SSD1306_PXL_WIDTH - 1);
+    ssd1306_ptr->clip_y1 = MIN(y + h - 1, SSD1306_PXL_HEIGHT - 1);
+
+    return SSD1306_OK;
+}
+
+
+ssd1306_status_t
+ssd1306_set_viewport(ssd1306_t *ssd1306_ptr, uint8_t x, uint8_t y,
+        uint8_t w, uint8_t h) {
+
+    SSD1306_DECLARE_STATUS_VARIABLE()
+
+    status = ssd1306_set_clip(ssd1306_ptr, x, y, w, h);
+    if (status != SSD1306_OK) return status;
+
+    return ssd1306_set_origin(ssd1306_ptr, x, y);
+}
+
+
+ssd1306_status_t
+ssd1306_draw_fill(ssd1306_t *ssd1306_ptr, ssd1306_color_t color) {
+    ssd1306_op_t op;
+
+    if (ssd1306_buffer_locked(ssd1306_ptr))
+        return SSD1306_BUSY;
+    if (color != SSD1306_COLOR_BLACK && color != SSD1306_COLOR_WHITE)
+        return SSD1306_WRONG_PARAMS;
+
+    // A clip rectangle smaller than the display is filled as an area.
+    if (ssd1306_ptr->clip_x0 != 0 || ssd1306_ptr->clip_y0 != 0 ||
+            ssd1306_ptr->clip_x1 != SSD1306_PXL_WIDTH - 1 ||
+            ssd1306_ptr->clip_y1 != SSD1306_PXL_HEIGHT - 1)
+        return ssd1306_fill_area(ssd1306_ptr, ssd1306_ptr->clip_x0,
+                ssd1306_ptr->clip_y0, ssd1306_ptr->clip_x1,
+                ssd1306_ptr->clip_y1, color);
+
+    op = ssd1306_color_op(ssd1306_ptr, color);
+    if (op == SSD1306_OP_NONE) return SSD1306_OK;
+
+    // The pages of the buffer are contiguous, hence combined as a single row.
+    if (op == SSD1306_OP_INVERT)
+        ssd1306_rop_row(ssd1306_ptr->buffer, NULL, SSD1306_BUFFER_SIZE, 0, 0,
+                0xFF, op, SSD1306_OP_NONE);
+    else
+        memset(ssd1306_ptr->buffer, (op == SSD1306_OP_SET) ? 0xFF : 0x00,
+                SSD1306_BUFFER_SIZE);
+    ssd1306_mark_all_dirty(ssd1306_ptr);
+    SSD1306_STATS_ADD(primitives, 1);
+    SSD1306_STATS_ADD(pixels, (uint32_t)SSD1306_BUFFER_SIZE * 8);
+    return SSD1306_OK;
+}
+
+
+ssd1306_status_t
+ssd1306_draw_pixel(ssd1306_t *ssd1306_ptr, uint8_t x, uint8_t y,
+        ssd1306_color_t color) {
+
+    if (ssd1306_buffer_locked(ssd1306_ptr))
+        return SSD1306_BUSY;
+
+    int32_t xd = x + ssd1306_ptr->origin_x;
+    int32_t yd = y + ssd1306_ptr->origin_y;
+    ssd1306_rect_t clip = ssd1306_clip_rect(ssd1306_ptr);
+    if (xd < clip.x0 || xd > clip.x1 || yd < clip.y0 || yd > clip.y1)
+        return SSD1306_OK;
+    if (color != SSD1306_COLOR_BLACK && color != SSD1306_COLOR_WHITE)
+        return SSD1306_WRONG_PARAMS;
+
+    ssd1306_op_t op = ssd1306_color_op(ssd1306_ptr, color);
+    if (op == SSD1306_OP_NONE) return SSD1306_OK;
+
+    ssd1306_plot(ssd1306_ptr, xd, yd, op);
+    SSD1306_STATS_ADD(primitives, 1);
+    return SSD1306_OK;
+}
+
+
+ssd1306_status_t
+ssd1306_set_text_mode(ssd1306_t *ssd1306_ptr, ssd1306_text_mode_t mode) {
+
+    switch (mode) {
+        case SSD1306_TEXT_OPAQUE:
+        case SSD1306_TEXT_TRANSPARENT:
+        case SSD1306_TEXT_XOR:
+            ssd1306_ptr->text_mode = mode;
+            return SSD1306_OK;
+        default:
+            return SSD1306_WRONG_PARAMS;
+    }
+}
+
+
+ssd1306_status_t
+ssd1306_set_rop(ssd1306_t *ssd1306_ptr, ssd1306_rop_t rop) {
+
+    switch (rop) {
+        case SSD1306_ROP_COPY:
+        case SSD1306_ROP_OR:
+        case SSD1306_ROP_AND_NOT:
+        case SSD1306_ROP_XOR:
+            ssd1306_ptr->rop = rop;
+            return SSD1306_OK;
+        default:
+            return SSD1306_WRONG_PARAMS;
+    }
+}
+
+
+ssd1306_status_t
+ssd1306_draw_char(ssd1306_t *ssd1306_ptr, const char ch,
+        ssd1306_font_name_t font_name, ssd1306_color_t color) {
+
+    SSD1306_DECLARE_STATUS_VARIABLE()
+    const ssd1306_font_t *font = get_font_ptr(font_name);
+
+    // Disabled fonts and characters without a glyph are rejected.
+    if (font == NULL || font->font_cols == NULL)
+        return SSD1306_WRONG_PARAMS;
+    if ((uint8_t)ch < SSD1306_FONT_FIRST_CHAR ||
+            (uint8_t)ch > SSD1306_FONT_LAST_CHAR)
+        return SSD1306_WRONG_PARAMS;
+
+    // Since the first available character of the ASCII table is 'space'
+    // (32d), subtracts it from the given char to compute the font array
+    // index. Glyphs are stored column by column in the same layout of the
+    // software buffer, hence they are blitted a byte at a time.
+    uint8_t glyph_idx = (uint8_t)ch - SSD1306_FONT_FIRST_CHAR;
+    uint8_t glyph_width;
+    const uint8_t *glyph_ptr;
+
+    if (font->glyph_widths != NULL) {
+        // Proportional font.
+        glyph_width = font->glyph_widths[glyph_idx];
+        glyph_ptr   = &font->font_cols[font->glyph_offsets[glyph_idx]];
+        if (glyph_width == 0) return SSD1306_WRONG_PARAMS;
+    } else {
+        // Subsets store their glyphs densely.
+        if (font->glyph_index != NULL) {
+            glyph_idx = font->glyph_index[glyph_idx];
+            if (glyph_idx == SSD1306_GLYPH_MISSING) return SSD1306_WRONG_PARAMS;
+        }
+        glyph_width = font->font_width;
+        glyph_ptr   = &font->font_cols[glyph_idx * glyph_width *
+                ((font->font_height + 7) >> 3)];
+    }
+
+    status = ssd1306_blit(ssd1306_ptr,
+            ssd1306_ptr->x_pos + ssd1306_ptr->origin_x,
+            ssd1306_ptr->y_pos + ssd1306_ptr->origin_y,
+            glyph_ptr, glyph_width, font->font_height, color,
+            ssd1306_ptr->text_mode);
+    if (status != SSD1306_OK) return status;
+
+    ssd1306_ptr->x_pos += glyph_width;
+    return SSD1306_OK;
+}
+
+
+ssd1306_status_t
+ssd1306_draw_str(ssd1306_t *ssd1306_ptr, const char *str, size_t str_len,
+        ssd1306_font_name_t font_name, ssd1306_color_t color) {
+
+    SSD1306_DECLARE_STATUS_VARIABLE()
+
+    for (size_t i = 0; i < str_len; i++) {
+        // Writes string character by character for the given length.
+        status = ssd1306_draw_char(ssd1306_ptr, str[i], font_name, color);
+        if (status != SSD1306_OK) return status;
+    }
+
+    return SSD1306_OK;
+}
+
+
+ssd1306_status_t
+ssd1306_draw_int(ssd1306_t *ssd1306_ptr, int32_t num, uint8_t base,
+        ssd1306_font_name_t font_name, ssd1306_color_t color) {
+
+    char str_buf[SSD1306_INT_STR_SIZE];
+    size_t str_len = ssd1306_format_int(str_buf, num, base);
+
+    // Unsupported base.
+    if (str_len == 0) return SSD1306_WRONG_PARAMS;
+
+    // Prints the string carrying the given number converted to the given base.
+    return ssd1306_draw_str(
+            ssd1306_ptr,
+            str_buf,
+            str_len,
+            font_name,
+            color);
+}
+
+
+/// Powers of ten subtracted to find the decimal digits of an integer.
+static const uint32_t ssd1306_pow10[] = {
+    1000000000, 100000000, 10000000, 1000000, 100000, 10000, 1000, 100, 10
+};
+
+
+size_t
+ssd1306_format_int(char *str_buf, int32_t num, uint8_t base) {
+
+    // The magnitude of INT32_MIN only fits an unsigned integer.
+    uint32_t value = (num < 0) ? 0 - (uint32_t)num : (uint32_t)num;
+    size_t len = 0;
+
+    // Unsupported base.
+    if (base < 2 || base > 32) return 0;
+
+    if (base == 10) {
+        uint8_t i = 0;
+
+        if (num < 0) str_buf[len++] = '-';
+
+        // Each digit is the number of times its power of ten can be
+        // subtracted, at most 9: leading zeros are skipped.
+        while (i < sizeof(ssd1306_pow10) / sizeof(ssd1306_pow10[0]) &&
+                value < ssd1306_pow10[i])
+            i++;
+        for (; i < sizeof(ssd1306_pow10) / sizeof(ssd1306_pow10[0]); i++) {
+            char digit = '0';
+            while (value >= ssd1306_pow10[i]) {
+                value -= ssd1306_pow10[i];
+                digit++;
+            }
+            str_buf[len++] = digit;
+        }
+        str_buf[len++] = (char)('0' + value);
+        return len;
+    }
+
+    // Digits are produced from the least significant one, hence written
+    // from the end of the buffer and then moved to its beginning.
+    char digits[SSD1306_INT_STR_SIZE];
+    size_t pos = sizeof(digits);
+    uint8_t shift = 0;
+
+    while ((1u << shift) < base)
+        shift++;
+
+    do {
+        uint32_t rem;
+        if ((1u << shift) == base) {
+            rem = value & (base - 1);
+            value >>= shift;
+        } else {
+            rem = value % base;
+            value /= base;
+        }
+        digits[--pos] = (char)((rem > 9) ? (rem - 10) + 'A' : rem + '0');
+    } while (value != 0);
+
+    len = sizeof(digits) - pos;
+    memcpy(str_buf, &digits[pos], len);
+    return len;
+}
+
+
+ssd1306_status_t
+ssd1306_draw_line(ssd1306_t *ssd1306_ptr, uint8_t x0, uint8_t y0,
+        uint8_t x1, uint8_t y1, ssd1306_color_t color) {
+
+    int32_t ox = ssd1306_ptr->origin_x, oy = ssd1306_ptr->origin_y;
+
+    return ssd1306_line(ssd1306_ptr, x0 + ox, y0 + oy, x1 + ox, y1 + oy, color,
+            true);
+}
+
+
+ssd1306_status_t
+ssd1306_draw_hline(ssd1306_t *ssd1306_ptr, uint8_t x, uint8_t y, uint8_t w,
+        ssd1306_color_t color) {
+
+    int32_t xd = x + ssd1306_ptr->origin_x, yd = y + ssd1306_ptr->origin_y;
+
+    return ssd1306_fill_area(ssd1306_ptr, xd, yd, xd + w - 1, yd, color);
+}
+
+
+ssd1306_status_t
+ssd1306_draw_vline(ssd1306_t *ssd1306_ptr, uint8_t x, uint8_t y, uint8_t h,
+        ssd1306_color_t color) {
+
+    int32_t xd = x + ssd1306_ptr->origin_x, yd = y + ssd1306_ptr->origin_y;
+
+    return ssd1306_fill_area(ssd1306_ptr, xd, yd, xd, yd + h - 1, color);
+}
+
+
+ssd1306_status_t
+ssd1306_draw_rect(ssd1306_t *ssd1306_ptr, uint8_t x, uint8_t y,
+        uint8_t w, uint8_t h, ssd1306_color_t color) {
+
+    SSD1306_DECLARE_STATUS_VARIABLE()
+    int32_t x0 = x + ssd1306_ptr->origin_x, y0 = y + ssd1306_ptr->origin_y;
+    int32_t x1 = x0 + w, y1 = y0 + h;
+
+    // A flat rectangle is a single line.
+    if (w == 0 || h == 0)
+        return ssd1306_line(ssd1306_ptr, x0, y0, x1, y1, color, true);
+
+    // Lines are drawn clockwise, each one leaving out its last corner,
+    // so that every pixel is drawn once.
+    // Top line.
+    status = ssd1306_line(ssd1306_ptr, x0, y0, x1, y0, color, false);
+    if (status != SSD1306_OK) return status;
+
+    // Right line.
+    status = ssd1306_line(ssd1306_ptr, x1, y0, x1, y1, color, false);
+    if (status != SSD1306_OK) return status;
+
+    // Bottom line.
+    status = ssd1306_line(ssd1306_ptr, x1, y1, x0, y1, color, false);
+    if (status != SSD1306_OK) return status;
+
+    // Left line.
+    status = ssd1306_line(ssd1306_ptr, x0, y1, x0, y0, color, false);
+    if (status != SSD1306_OK) return status;
+
+    return SSD1306_OK;
+}
+
+
+ssd1306_status_t
+ssd1306_draw_filled_rect(ssd1306_t *ssd1306_ptr, uint8_t x, uint8_t y,
+        uint8_t w, uint8_t h, ssd1306_color_t color) {
+
+    int32_t xd = x + ssd1306_ptr->origin_x, yd = y + ssd1306_ptr->origin_y;
+
+    return ssd1306_fill_area(ssd1306_ptr, xd, yd, xd + w, yd + h, color);
+}
+
+
+ssd1306_status_t
+ssd1306_draw_circle(ssd1306_t *ssd1306_ptr, uint8_t x0, uint8_t y0, uint16_t r,
+        ssd1306_color_t color) {
+
+    int32_t xc = x0 + ssd1306_ptr->origin_x, yc = y0 + ssd1306_ptr->origin_y;
+    int32_t rc = r;
+    int32_t x = -rc, y = 0, err = 2-2*rc;
+
+    if (ssd1306_buffer_locked(ssd1306_ptr))
+        return SSD1306_BUSY;
+    if (color != SSD1306_COLOR_BLACK && color != SSD1306_COLOR_WHITE)
+        return SSD1306_WRONG_PARAMS;
+
+    // The bounding box is clipped once: a circle entirely within the clip
+    // rectangle is drawn without checking its pixels.
+    ssd1306_rect_t clip = ssd1306_clip_rect(ssd1306_ptr);
+    if (xc + rc < clip.x0 || xc - rc > clip.x1 ||
+            yc + rc < clip.y0 || yc - rc > clip.y1)
+        return SSD1306_OK;
+
+    bool inside = (xc - rc >= clip.x0 && xc + rc <= clip.x1 &&
+            yc - rc >= clip.y0 && yc + rc <= clip.y1);
+    ssd1306_op_t op = ssd1306_color_op(ssd1306_ptr, color);
+    if (op == SSD1306_OP_NONE) return SSD1306_OK;
+    SSD1306_STATS_ADD(primitives, 1);
+
+    // The quadrants hold distinct pixels, except for a null radius.
+    uint8_t quadrants = (r == 0) ? 1 : 4;
+
+    // Bresenham's algorithm.
+    do {
+        const int32_t px[4] = { xc-x, xc-y, xc+x, xc+y };
+        const int32_t py[4] = { yc+y, yc-x, yc-y, yc+x };
+
+        for (uint8_t i = 0; i < quadrants; i++) {
+            if (inside || ssd1306_outcode(&clip, px[i], py[i]) == 0)
+                ssd1306_plot(ssd1306_ptr, px[i], py[i], op);
+        }
+
+        rc = err;
+        if (rc >  x) err += ++x*2+1;
+        if (rc <= y) err += ++y*2+1;
+    } while (x < 0);
+
+    return SSD1306_OK;
+}
+
+
+ssd1306_status_t
+ssd1306_draw_filled_circle(ssd1306_t *ssd1306_ptr, uint8_t x0, uint8_t y0,
+        uint16_t r, ssd1306_color_t color) {
+
+    SSD1306_DECLARE_STATUS_VARIABLE()
+    int32_t x = r, y = 0, err = 1 - (int32_t)r;
+    int32_t xc = x0 + ssd1306_ptr->origin_x, yc = y0 + ssd1306_ptr->origin_y;
+
+    // Midpoint algorithm: each row of the circle is filled by a single span.
+    // Rows y0 +/- y are filled from the first octant, each one as soon as
+    // it is reached. Rows y0 +/- x are filled from the second octant, each
+    // one with its widest span, i.e. right before x is decremented.
+    while (x >= y) {
+        status = ssd1306_fill_span(ssd1306_ptr, xc - x, xc + x, yc + y, color);
+        if (status != SSD1306_OK) return status;
+        if (y != 0) {
+            status = ssd1306_fill_span(ssd1306_ptr, xc - x, xc + x, yc - y, color);
+            if (status != SSD1306_OK) return status;
+        }
+
+        if (err >= 0 && x != y) {
+            status = ssd1306_fill_span(ssd1306_ptr, xc - y, xc + y, yc + x, color);
+            if (status != SSD1306_OK) return status;
+            status = ssd1306_fill_span(ssd1306_ptr, xc - y, xc + y, yc - x, color);
+            if (status != SSD1306_OK) return status;
+        }
+
+        y++;
+        if (err < 0) {
+            err += 2 * y + 1;
+        } else {
+            x--;
+            err += 2 * (y - x) + 1;
+        }
+    }
+
+    return SSD1306_OK;
+}
+
+
+ssd1306_status_t
+ssd1306_draw_triangle(ssd1306_t *ssd1306_ptr, uint8_t x1, uint8_t y1,
+        uint8_t x2, uint8_t y2, uint8_t x3, uint8_t y3, ssd1306_color_t color) {
+
+    SSD1306_DECLARE_STATUS_VARIABLE()
+    int32_t ox = ssd1306_ptr->origin_x, oy = ssd1306_ptr->origin_y;
+
+    // Each edge leaves out its last vertex, drawn by the next edge,
+    // unless the triangle is a single point.
+    bool last = (x1 == x2 && x2 == x3 && y1 == y2 && y2 == y3);
+
+    status = ssd1306_line(ssd1306_ptr, x1 + ox, y1 + oy, x2 + ox, y2 + oy,
+            color, last);
+    if (status != SSD1306_OK) return status;
+    if (last) return SSD1306_OK;
+    status = ssd1306_line(ssd1306_ptr, x2 + ox, y2 + oy, x3 + ox, y3 + oy,
+            color, false);
+    if (status != SSD1306_OK) return status;
+    status = ssd1306_line(ssd1306_ptr, x3 + ox, y3 + oy, x1 + ox, y1 + oy,
+            color, false);
+    if (status != SSD1306_OK) return status;
+
+    return SSD1306_OK;
+}
+
+
+ssd1306_status_t
+ssd1306_draw_filled_triangle(ssd1306_t *ssd1306_ptr, uint8_t x1, uint8_t y1,
+        uint8_t x2, uint8_t y2, uint8_t x3, uint8_t y3, ssd1306_color_t color) {
+
+    SSD1306_DECLARE_STATUS_VARIABLE()
+    int32_t ox = ssd1306_ptr->origin_x, oy = ssd1306_ptr->origin_y;
+    int32_t xa = x1 + ox, ya = y1 + oy, xb = x2 + ox, yb = y2 + oy;
+    int32_t xc = x3 + ox, yc = y3 + oy, tmp;
+
+    // Sorts the vertices by y coordinate: ya <= yb <= yc.
+    if (ya > yb) { tmp = xa; xa = xb; xb = tmp; tmp = ya; ya = yb; yb = tmp; }
+    if (yb > yc) { tmp = xb; xb = xc; xc = tmp; tmp = yb; yb = yc; yc = tmp; }
+    if (ya > yb) { tmp = xa; xa = xb; xb = tmp; tmp = ya; ya = yb; yb = tmp; }
+
+    // Flat triangle: a single span.
+    if (ya == yc) {
+        int32_t left  = MIN(xa, MIN(xb, xc));
+        int32_t right = MAX(xa, MAX(xb, xc));
+        return ssd1306_fill_span(ssd1306_ptr, left, right, ya, color);
+    }
+
+    // Each row is filled by a single span between the long edge (a to c)
+    // and one of the short edges (a to b above yb, b to c below it).
+    // The row of b belongs to the upper part, unless the lower edge is flat.
+    int32_t last = (yb == yc) ? yb : yb - 1;
+    int32_t y;
+
+    for (y = ya; y <= last; y++) {
+        int32_t left  = xa + (xb - xa) * (y - ya) / (yb - ya);
+        int32_t right = xa + (xc - xa) * (y - ya) / (yc - ya);
+        status = ssd1306_fill_span(ssd1306_ptr, left, right, y, color);
+        if (status != SSD1306_OK) return status;
+    }
+
+    for (; y <= yc; y++) {
+        int32_t left  = xb + (xc - xb) * (y - yb) / (yc - yb);
+        int32_t right = xa + (xc - xa) * (y - ya) / (yc - ya);
+        status = ssd1306_fill_span(ssd1306_ptr, left, right, y, color);
+        if (status != SSD1306_OK) return status;
+    }
+
+    return SSD1306_OK;
+}
+
+
+ssd1306_status_t
+ssd1306_draw_bitmap(ssd1306_t *ssd1306_ptr, uint8_t x, uint8_t y,
+        const unsigned char* bitmap, uint8_t w, uint8_t h,
+        ssd1306_color_t color) {
+
+    uint16_t byte_width = (w + 7) >> 3; // Bitmap scanline pad = whole byte.
+    int32_t  xd = x + ssd1306_ptr->origin_x, yd = y + ssd1306_ptr->origin_y;
+
+    if (ssd1306_buffer_locked(ssd1306_ptr))
+        return SSD1306_BUSY;
+    if (color != SSD1306_COLOR_BLACK && color != SSD1306_COLOR_WHITE)
+        return SSD1306_WRONG_PARAMS;
+
+    // Only the rows and columns within the clip rectangle are scanned.
+    ssd1306_rect_t clip = ssd1306_clip_rect(ssd1306_ptr);
+    int32_t i_start = MAX(clip.x0 - xd, 0), i_end = MIN(clip.x1 + 1 - xd, w);
+    int32_t j_start = MAX(clip.y0 - yd, 0), j_end = MIN(clip.y1 + 1 - yd, h);
+    ssd1306_op_t op = ssd1306_color_op(ssd1306_ptr, color);
+
+    if (i_start >= i_end || j_start >= j_end || op == SSD1306_OP_NONE)
+        return SSD1306_OK;
+    SSD1306_STATS_ADD(primitives, 1);
+
+    for (int32_t j = j_start; j < j_end; j++) {
+        const unsigned char *row = &bitmap[j * byte_width];
+        for (int32_t i = i_start; i < i_end; i++) {
+            if (row[i >> 3] & (0x80 >> (i & 7)))
+                ssd1306_plot(ssd1306_ptr, xd + i, yd + j, op);
+        }
+    }
+
+    return SSD1306_OK;
+}
+
+
+ssd1306_status_t
+ssd1306_draw_page_bitmap(ssd1306_t *ssd1306_ptr, uint8_t x, uint8_t y,
+        const uint8_t *bitmap, uint8_t w, uint8_t h, ssd1306_color_t color,
+        ssd1306_text_mode_t mode) {
+
+    return ssd1306_blit(ssd1306_ptr, x + ssd1306_ptr->origin_x,
+            y + ssd1306_ptr->origin_y, bitmap, w, h, color, mode);
+}
+
+
+ssd1306_status_t
+ssd1306_draw_rle_bitmap(ssd1306_t *ssd1306_ptr, uint8_t x, uint8_t y,
+        const uint8_t *data, size_t data_len, uint8_t w, uint8_t h,
+        ssd1306_color_t color, ssd1306_text_mode_t mode) {
+
+    SSD1306_DECLARE_STATUS_VARIABLE()
+
+    if (ssd1306_buffer_locked(ssd1306_ptr))
+        return SSD1306_BUSY;
+
+    // Only the columns within the clip rectangle are kept, so that a page
+    // of the display is enough whatever the width of the bitmap.
+    uint8_t page[SSD1306_PXL_WIDTH];
+    ssd1306_rect_t clip = ssd1306_clip_rect(ssd1306_ptr);
+    int32_t xd      = x + ssd1306_ptr->origin_x, yd = y + ssd1306_ptr->origin_y;
+    int32_t first   = MAX(clip.x0 - xd, 0);
+    int32_t last    = MIN(clip.x1 + 1 - xd, w);
+    uint8_t pages   = (h + 7) >> 3;
+    size_t  pos     = 0;
+    uint8_t run     = 0, value = 0;
+    bool    literal = false;
+
+    for (uint8_t k = 0; k < pages; k++) {
+        int32_t page_y = yd + (k << 3);
+        if (page_y > clip.y1) break;
+
+        // Runs may span across pages.
+        for (uint8_t col = 0; col < w; col++) {
+            if (run == 0) {
+                if (pos >= data_len) return SSD1306_WRONG_PARAMS;
+                uint8_t n = data[pos++];
+                literal = (n < 0x80);
+                run = (literal) ? n + 1 : n - 126;
+                if (!literal) {
+                    if (pos >= data_len) return SSD1306_WRONG_PARAMS;
+                    value = data[pos++];
+                }
+            }
+            if (literal) {
+                if (pos >= data_len) return SSD1306_WRONG_PARAMS;
+                value = data[pos++];
+            }
+            run--;
+
+            if (col >= first && col < last) page[col - first] = value;
+        }
+
+        if (first >= last) continue;
+
+        uint8_t rows = ((k == pages - 1) && (h & 0x7)) ? h & 0x7 : 8;
+        status = ssd1306_blit(ssd1306_ptr, xd + first, page_y, page,
+                last - first, rows, color, mode);
+        if (status != SSD1306_OK) return status;
+    }
+
+    return SSD1306_OK;
+}
+
+
+#ifndef SSD1306_ENABLE_PAGE_MODE
+
+/**
+ * Sends the given spans of the given software buffer to the display ram,
+ * removing them from the spans as they are transmitted: on failure, the
+ * spans left are the ones not transmitted.
+ *
+ * @param  ssd1306_ptr a pointer to a ssd1306_t structure.
+ * @param  data        the software buffer to be sent.
+ * @param  span_start  the first column to be sent of each page.
+ * @param  span_end    the last column to be sent of each page.
+ * @return the outcome of the function call.
+ */
+static ssd1306_status_t
+ssd1306_flush_spans(ssd1306_t *ssd1306_ptr, const uint8_t *data,
+        uint8_t *span_start, uint8_t *span_end) {
+
+    ssd1306_status_t status = SSD1306_OK;
+    uint8_t page_start = 0, page_end, col_end;
+
+    // The address window is narrowed to each span so that the display ram
+    // pointer lands on its first column and wraps back on it at its last
+    // column. Each window is sent within a single transaction.
+    while (ssd1306_next_window(ssd1306_ptr, data, span_start, span_end,
+            &page_start, &page_end, &col_end)) {
+        uint8_t col_start = span_start[page_start];
+
+        status = ssd1306_data_write(ssd1306_ptr, col_start, col_end,
+                page_start, page_end,
+                &data[SSD1306_PXL_WIDTH * page_start + col_start],
+                (size_t)(page_end - page_start) * SSD1306_PXL_WIDTH +
+                        col_end - col_start + 1);
+        if (status != SSD1306_OK) break;
+
+        ssd1306_window_sent(ssd1306_ptr, data, span_start, span_end,
+                page_start, page_end, col_end);
+    }
+
+    // No transaction may have carried the start line, e.g. if the exposed
+    // pages already matched the display ram.
+    if (status == SSD1306_OK)
+        status = ssd1306_start_line_send(ssd1306_ptr);
+
+    // The display ram of the failed window is unknown.
+    if (status != SSD1306_OK)
+        ssd1306_shadow_reset(ssd1306_ptr);
+
+    return status;
+}
+
+
+/**
+ * Flushes the spans of the software buffer marked as dirty to the display
+ * ram, then submits the back buffer.
+ *
+ * @param  ssd1306_ptr a pointer to a ssd1306_t structure.
+ * @return the outcome of the function call.
+ */
+static ssd1306_status_t
+ssd1306_flush(ssd1306_t *ssd1306_ptr) {
+    SSD1306_DECLARE_STATUS_VARIABLE()
+
+    if (ssd1306_ptr->initialized == false)
+        return SSD1306_NOINIT;
+    if (ssd1306_is_busy(ssd1306_ptr))
+        return SSD1306_BUSY;
+
+    ssd1306_async_recover(ssd1306_ptr);
+    SSD1306_STATS_UPDATE_BEGIN();
+
+    status = ssd1306_flush_spans(ssd1306_ptr, ssd1306_ptr->buffer,
+            ssd1306_ptr->dirty_start, ssd1306_ptr->dirty_end);
+    if (status == SSD1306_OK)
+        ssd1306_swap_buffers(ssd1306_ptr);
+
+    SSD1306_STATS_UPDATE_END(status);
+    return status;
+}
+
+
+#else
+
+/**
+ * Flushes the band of the software buffer to the display ram pages holding
+ * it, at most two since the display ram may wrap around (see
+ * ssd1306_scroll_up).
+ *
+ * @param  ssd1306_ptr a pointer to a ssd1306_t structure.
+ * @param  pages       the number of pages of the band.
+ * @return the outcome of the function call.
+ */
+static ssd1306_status_t
+ssd1306_flush_band(ssd1306_t *ssd1306_ptr, uint8_t pages) {
+    SSD1306_DECLARE_STATUS_VARIABLE()
+
+    for (uint8_t p = 0; p < pages; ) {
+        uint8_t ram_page = ssd1306_buffer_page(ssd1306_ptr,
+                ssd1306_ptr->band_page + p);
+        uint8_t run = pages - p;
+        if (run > SSD1306_NUM_PAGES - ram_page)
+            run = SSD1306_NUM_PAGES - ram_page;
+
+        status = ssd1306_data_write(ssd1306_ptr, 0, SSD1306_PXL_WIDTH - 1,
+                ram_page, ram_page + run - 1,
+                &ssd1306_ptr->buffer[p * SSD1306_PXL_WIDTH],
+                (size_t)run * SSD1306_PXL_WIDTH);
+        if (status != SSD1306_OK) return status;
+
+        p += run;
+    }
+
+    return SSD1306_OK;
+}
+
+#endif
+
+
+ssd1306_status_t
+ssd1306_update(ssd1306_t *ssd1306_ptr) {
+#ifdef SSD1306_ENABLE_PAGE_MODE
+    (void)ssd1306_ptr;
+    return SSD1306_WRONG_PARAMS;
+#else
+    if (ssd1306_is_busy(ssd1306_ptr))
+        return SSD1306_BUSY;
+
+    // The GDDRAM is written entirely within a single transaction.
+    ssd1306_mark_all_dirty(ssd1306_ptr);
+    return ssd1306_flush(ssd1306_ptr);
+#endif
+}
+
+
+ssd1306_status_t
+ssd1306_update_dirty(ssd1306_t *ssd1306_ptr) {
+#ifdef SSD1306_ENABLE_PAGE_MODE
+    (void)ssd1306_ptr;
+    return SSD1306_WRONG_PARAMS;
+#else
+    return ssd1306_flush(ssd1306_ptr);
+#endif
+}
+
+
+ssd1306_status_t
+ssd1306_render(ssd1306_t *ssd1306_ptr, ssd1306_draw_cb_t draw, void *ctx) {
+    SSD1306_DECLARE_STATUS_VARIABLE()
+
+    if (ssd1306_ptr->initialized == false)
+        return SSD1306_NOINIT;
+
+#ifdef SSD1306_ENABLE_PAGE_MODE
+    // Each band is drawn starting from the same drawing state.
+    uint8_t x_pos = ssd1306_ptr->x_pos, y_pos = ssd1306_ptr->y_pos;
+    ssd1306_text_mode_t text_mode = ssd1306_ptr->text_mode;
+    ssd1306_rop_t rop = ssd1306_ptr->rop;
+    int16_t origin_x = ssd1306_ptr->origin_x, origin_y = ssd1306_ptr->origin_y;
+    uint8_t clip[4] = {
+        ssd1306_ptr->clip_x0, ssd1306_ptr->clip_y0,
+        ssd1306_ptr->clip_x1, ssd1306_ptr->clip_y1
+    };
+    status = SSD1306_OK;
+    SSD1306_STATS_UPDATE_BEGIN();
+
+    for (uint8_t band = 0; band < SSD1306_NUM_PAGES; band += SSD1306_BUFFER_PAGES) {
+        uint8_t pages = SSD1306_NUM_PAGES - band;
+        if (pages > SSD1306_BUFFER_PAGES) pages = SSD1306_BUFFER_PAGES;
+
+        ssd1306_ptr->band_page = band;
+        ssd1306_ptr->x_pos     = x_pos;
+        ssd1306_ptr->y_pos     = y_pos;
+        ssd1306_ptr->text_mode = text_mode;
+        ssd1306_ptr->rop       = rop;
+        ssd1306_ptr->origin_x  = origin_x;
+        ssd1306_ptr->origin_y  = origin_y;
+        ssd1306_ptr->clip_x0   = clip[0];
+        ssd1306_ptr->clip_y0   = clip[1];
+        ssd1306_ptr->clip_x1   = clip[2];
+        ssd1306_ptr->clip_y1   = clip[3];
+        memset(ssd1306_ptr->buffer, 0, SSD1306_BUFFER_SIZE);
+
+        status = (draw != NULL) ? draw(ssd1306_ptr, ctx) : SSD1306_OK;
+        if (status == SSD1306_OK)
+            status = ssd1306_flush_band(ssd1306_ptr, pages);
+        if (status != SSD1306_OK) break;
+    }
+
+    // Drawing outside of ssd1306_render affects the first band.
+    ssd1306_ptr->band_page = 0;
+    SSD1306_STATS_UPDATE_END(status);
+    return status;
+#else
+    status = ssd1306_clear_buffer(ssd1306_ptr);
+    if (status != SSD1306_OK) return status;
+
+    if (draw != NULL) {
+        status = draw(ssd1306_ptr, ctx);
+        if (status != SSD1306_OK) return status;
     }
 
-    memset(ssd1306_ptr->buffer, pxl_color, sizeof(ssd1306_ptr->buffer));
-    return SSD1306_OK;
+    return ssd1306_update(ssd1306_ptr);
+#endif
 }
 
 
 ssd1306_status_t
-ssd1306_draw_pixel(ssd1306_t *ssd1306_ptr, uint8_t x, uint8_t y,
-        ssd1306_color_t color) {
+ssd1306_set_back_buffer(ssd1306_t *ssd1306_ptr, uint8_t *back_buffer) {
 
-    if (x >= SSD1306_PXL_WIDTH || y >= SSD1306_PXL_HEIGHT)
-        return SSD1306_OK;
+    if (ssd1306_is_busy(ssd1306_ptr))
+        return SSD1306_BUSY;
 
-    ssd1306_color_t pxl_color = (ssd1306_ptr->inverted) ? !color : color;
+    // The content being drawn is preserved in the default buffer.
+    if (ssd1306_ptr->buffer != ssd1306_ptr->frame)
+        memcpy(ssd1306_ptr->frame, ssd1306_ptr->buffer, SSD1306_BUFFER_SIZE);
 
-    switch (pxl_color) {
-        case SSD1306_COLOR_WHITE:
-            ssd1306_ptr->buffer[x + (y >> 3) * SSD1306_PXL_WIDTH] |= 1 << (y & 0x7);
-            break;
-        case SSD1306_COLOR_BLACK:
-            ssd1306_ptr->buffer[x + (y >> 3) * SSD1306_PXL_WIDTH] &= ~(1 << (y & 0x7));
-            break;
-        default:
-            return SSD1306_WRONG_PARAMS;
+    ssd1306_ptr->buffer       = ssd1306_ptr->frame;
+    ssd1306_ptr->front_buffer = ssd1306_ptr->frame;
+
+    if (back_buffer != NULL) {
+        memcpy(back_buffer, ssd1306_ptr->frame, SSD1306_BUFFER_SIZE);
+        ssd1306_ptr->buffer = back_buffer;
     }
 
     return SSD1306_OK;
 }
 
 
-ssd1306_status_t
-ssd1306_draw_char(ssd1306_t *ssd1306_ptr, const char ch,
-        ssd1306_font_name_t font_name, ssd1306_color_t color) {
+/**
+ * Streams the given pages of a frame produced by the given function to
+ * the display ram holding them. The address window is set along with
+ * the first chunk, then each chunk only carries the data control byte.
+ *
+ * @param  ssd1306_ptr a pointer to a ssd1306_t structure.
+ * @param  page        the first page of the display area to be sent.
+ * @param  pages       the number of pages to be sent.
+ * @param  producer    the function producing the frame.
+ * @param  ctx         the user context given to the producer.
+ * @return the outcome of the function call.
+ */
+static ssd1306_status_t
+ssd1306_stream_pages(ssd1306_t *ssd1306_ptr, uint8_t page, uint8_t pages,
+        ssd1306_producer_t producer, void *ctx) {
 
     SSD1306_DECLARE_STATUS_VARIABLE()
-    const ssd1306_font_t *font = get_font_ptr(font_name);
 
-    for (uint8_t i = 0; i < font->font_height; i++) {
-        // There are fonts encoded in array of bytes and fonts encoded
-        // in array of half-words (16-bits). The sdd1306_font_t carries
-        // a void pointer in order to be used with both kinds of fonts.
-        // This is why a little manipulation is required here.
-        //
-        // Since the first available character of the ASCII table is 'space'
-        // (32d), subtracts it from the given char to compute the font array
-        // index to extract char pixels encoding.
-        uint16_t char_line;
-        if (font->font_width <= 8) {
-            // Font is encoded as uint8_t array.
-            uint8_t *font_map_ptr = (uint8_t *)font->font_map;
-            char_line = font_map_ptr[(ch - 32) * font->font_height + i] << 8;
-        } else {
-            // Font is encoded as uint16_t array.
-            uint16_t *font_map_ptr = (uint16_t *)font->font_map;
-            char_line = font_map_ptr[(ch - 32) * font->font_height + i];
-        }
+    const uint8_t control = SSD1306_DATA_CONTROL_BYTE;
+    uint8_t chunk[SSD1306_STREAM_CHUNK_SIZE];
+    uint8_t ram_page = ssd1306_buffer_page(ssd1306_ptr, page);
+    size_t  offset   = (size_t)page * SSD1306_PXL_WIDTH;
+    size_t  end      = offset + (size_t)pages * SSD1306_PXL_WIDTH;
+
+    for (bool first = true; offset < end; first = false) {
+        // Chunks following the first one fit a transaction of the port
+        // together with their control byte.
+        size_t chunk_size = (first) ? end - offset :
+                ssd1306_chunk_size(ssd1306_ptr, 1, end - offset);
+        if (chunk_size > SSD1306_STREAM_CHUNK_SIZE)
+            chunk_size = SSD1306_STREAM_CHUNK_SIZE;
+
+        status = producer(chunk, offset, chunk_size, ctx);
+        if (status != SSD1306_OK) return status;
 
-        for (uint8_t j = 0; j < font->font_width; j++) {
-            ssd1306_color_t pixel_color = ((char_line << j) & 0x8000) ?
-                    color : !color;
+        if (first)
+            status = ssd1306_data_write(ssd1306_ptr, 0, SSD1306_PXL_WIDTH - 1,
+                    ram_page, ram_page + pages - 1, chunk, chunk_size);
+        else
+            status = ssd1306_write_chunked(ssd1306_ptr, &control, 1,
+                    chunk, chunk_size);
+        if (status != SSD1306_OK) return status;
 
-            status = ssd1306_draw_pixel(
-                    ssd1306_ptr,
-                    ssd1306_ptr->x_pos + j,
-                    ssd1306_ptr->y_pos + i,
-                    pixel_color);
-            if (status != SSD1306_OK) return status;
-        }
+        offset += chunk_size;
     }
 
-    ssd1306_ptr->x_pos += font->font_width;
     return SSD1306_OK;
 }
 
 
 ssd1306_status_t
-ssd1306_draw_str(ssd1306_t *ssd1306_ptr, const char *str, size_t str_len,
-        ssd1306_font_name_t font_name, ssd1306_color_t color) {
+ssd1306_stream_frame(ssd1306_t *ssd1306_ptr, const uint8_t *frame) {
 
     SSD1306_DECLARE_STATUS_VARIABLE()
 
-    for (size_t i = 0; i < str_len; i++) {
-        // Writes string character by character for the given length.
-        status = ssd1306_draw_char(ssd1306_ptr, str[i], font_name, color);
-        if (status != SSD1306_OK) return status;
-    }
+    if (ssd1306_ptr->initialized == false)
+        return SSD1306_NOINIT;
+    if (ssd1306_is_busy(ssd1306_ptr))
+        return SSD1306_BUSY;
+    if (frame == NULL)
+        return SSD1306_WRONG_PARAMS;
 
-    return SSD1306_OK;
+    // The top of the display area is held by the page set by
+    // ssd1306_scroll_up, hence the frame may wrap around the display ram.
+    uint8_t split = SSD1306_NUM_PAGES - ssd1306_ptr->start_page;
+
+    status = ssd1306_data_write(ssd1306_ptr, 0, SSD1306_PXL_WIDTH - 1,
+            ssd1306_ptr->start_page, SSD1306_NUM_PAGES - 1,
+            frame, (size_t)split * SSD1306_PXL_WIDTH);
+    if (status == SSD1306_OK && split < SSD1306_NUM_PAGES)
+        status = ssd1306_data_write(ssd1306_ptr, 0, SSD1306_PXL_WIDTH - 1,
+                0, ssd1306_ptr->start_page - 1,
+                &frame[split * SSD1306_PXL_WIDTH],
+                (size_t)ssd1306_ptr->start_page * SSD1306_PXL_WIDTH);
+
+    ssd1306_mark_all_dirty(ssd1306_ptr);
+    ssd1306_shadow_reset(ssd1306_ptr);
+    return status;
 }
 
 
 ssd1306_status_t
-ssd1306_draw_int(ssd1306_t *ssd1306_ptr, int32_t num, uint8_t base,
-        ssd1306_font_name_t font_name, ssd1306_color_t color) {
+ssd1306_stream(ssd1306_t *ssd1306_ptr, ssd1306_producer_t producer, void *ctx) {
 
-    char str_buf[32] = "0";
+    SSD1306_DECLARE_STATUS_VARIABLE()
 
-    // Unsupported base.
-    if (base < 2 || base > 32) return SSD1306_WRONG_PARAMS;
+    if (ssd1306_ptr->initialized == false)
+        return SSD1306_NOINIT;
+    if (ssd1306_is_busy(ssd1306_ptr))
+        return SSD1306_BUSY;
+    if (producer == NULL)
+        return SSD1306_WRONG_PARAMS;
 
-    if (num != 0) {
-        int32_t i = 0;
-        int32_t num_abs = ABS(num);
-        bool is_negative = false;
+    // As for ssd1306_stream_frame, the frame may wrap around the display ram.
+    uint8_t split = SSD1306_NUM_PAGES - ssd1306_ptr->start_page;
 
-        if (num < 0 && base == 10) is_negative = true;
+    status = ssd1306_stream_pages(ssd1306_ptr, 0, split, producer, ctx);
+    if (status == SSD1306_OK && split < SSD1306_NUM_PAGES)
+        status = ssd1306_stream_pages(ssd1306_ptr, split,
+                SSD1306_NUM_PAGES - split, producer, ctx);
 
-        // Processes individual digits.
-        while (num_abs) {
-            int32_t rem = num_abs % base;
-            str_buf[i++] = (rem > 9) ? (rem - 10) + 'A' : rem + '0';
-            num_abs /= base;
-        }
+    ssd1306_mark_all_dirty(ssd1306_ptr);
+    ssd1306_shadow_reset(ssd1306_ptr);
+    return status;
+}
 
-        if (is_negative) str_buf[i++] = '-';
-        str_buf[i] = '\0';
 
-        // Inverts the buffer by swapping characters.
-        uint8_t start_idx = 0;
-        uint8_t end_idx = i - 1;
-        while (start_idx < end_idx) {
-            char c_tmp = str_buf[start_idx];
-            str_buf[start_idx] = str_buf[end_idx];
-            str_buf[end_idx] = c_tmp;
+bool
+ssd1306_is_busy(const ssd1306_t *ssd1306_ptr) {
+#ifdef SSD1306_ENABLE_ASYNC
+    return ssd1306_ptr->busy;
+#else
+    (void)ssd1306_ptr;
+    return false;
+#endif
+}
 
-            start_idx++;
-            end_idx--;
-        }
-    }
 
-    // Prints the string carrying the given number converted to the given base.
-    return ssd1306_draw_str(
-            ssd1306_ptr,
-            str_buf,
-            strlen(str_buf),
-            font_name,
-            color);
-}
+bool
+ssd1306_is_dirty(const ssd1306_t *ssd1306_ptr) {
 
+#ifdef SSD1306_ENABLE_ASYNC
+    // The spans of a failed non-blocking update are still to be sent.
+    if (ssd1306_ptr->tx_failed)
+        return true;
+#endif
 
-ssd1306_status_t
-ssd1306_draw_line(ssd1306_t *ssd1306_ptr, uint8_t x0, uint8_t y0,
-        uint8_t x1, uint8_t y1, ssd1306_color_t color) {
+    for (uint8_t p = 0; p < SSD1306_NUM_PAGES; p++) {
+        if (ssd1306_ptr->dirty_start[p] <= ssd1306_ptr->dirty_end[p])
+            return true;
+    }
 
-    SSD1306_DECLARE_STATUS_VARIABLE()
+    return false;
+}
 
-    // Bresenham's algorithm.
-    int32_t dx  = ABS(x1 - x0);
-    int32_t sx  = (x0 < x1) ? 1 : -1;
-    int32_t dy  = -ABS(y1 - y0);
-    int32_t sy  = (y0 < y1) ? 1 : -1;
-    int32_t err = dx + dy;
-
-    while (true) {
-        status = ssd1306_draw_pixel(ssd1306_ptr, x0, y0, color);
-        if (status != SSD1306_OK) return status;
 
-        if (x0 == x1 && y0 == y1) break;
+#ifdef SSD1306_ENABLE_STATS
 
-        int32_t e2 = err << 1; // err * 2.
-        if (e2 >= dy) { err += dy; x0 += sx; }
-        if (e2 <= dx) { err += dx; y0 += sy; }
-    }
+ssd1306_status_t
+ssd1306_set_trace(ssd1306_t *ssd1306_ptr, ssd1306_trace_t trace, void *ctx) {
+
+    if (ssd1306_ptr->initialized == false)
+        return SSD1306_NOINIT;
 
+    ssd1306_ptr->trace     = trace;
+    ssd1306_ptr->trace_ctx = ctx;
     return SSD1306_OK;
 }
 
 
 ssd1306_status_t
-ssd1306_draw_rect(ssd1306_t *ssd1306_ptr, uint8_t x, uint8_t y,
-        uint8_t w, uint8_t h, ssd1306_color_t color) {
+ssd1306_reset_stats(ssd1306_t *ssd1306_ptr) {
 
-    SSD1306_DECLARE_STATUS_VARIABLE()
+    memset(&ssd1306_ptr->stats, 0, sizeof(ssd1306_ptr->stats));
+    return SSD1306_OK;
+}
 
-    // Top line.
-    status = ssd1306_draw_line(ssd1306_ptr, x, y, x + w, y, color);
-    if (status != SSD1306_OK) return status;
+#endif
 
-    // Bottom line.
-    status = ssd1306_draw_line(ssd1306_ptr, x, y + h, x + w, y + h, color);
-    if (status != SSD1306_OK) return status;
 
-    // Left line.
-    status = ssd1306_draw_line(ssd1306_ptr, x, y, x, y + h, color);
-    if (status != SSD1306_OK) return status;
+#ifdef SSD1306_ENABLE_LOCKING
 
-    // Right line.
-    status = ssd1306_draw_line(ssd1306_ptr, x + w, y, x + w, y + h, color);
-    if (status != SSD1306_OK) return status;
+ssd1306_status_t
+ssd1306_set_lock(ssd1306_t *ssd1306_ptr, ssd1306_lock_t lock, void *ctx) {
 
+    if (ssd1306_ptr->initialized == false)
+        return SSD1306_NOINIT;
+
+    ssd1306_ptr->lock     = lock;
+    ssd1306_ptr->lock_ctx = ctx;
     return SSD1306_OK;
 }
 
 
-ssd1306_status_t
-ssd1306_draw_filled_rect(ssd1306_t *ssd1306_ptr, uint8_t x, uint8_t y,
-        uint8_t w, uint8_t h, ssd1306_color_t color) {
+void
+ssd1306_lock(ssd1306_t *ssd1306_ptr) {
 
-    SSD1306_DECLARE_STATUS_VARIABLE()
+    if (ssd1306_ptr->lock != NULL)
+        ssd1306_ptr->lock(true, ssd1306_ptr->lock_ctx);
+}
 
-    for (uint8_t i = 0; i <= h; i++) {
-        status = ssd1306_draw_line(ssd1306_ptr, x, y + i, x + w, y + i, color);
-        if (status != SSD1306_OK) return status;
-    }
 
-    return SSD1306_OK;
+void
+ssd1306_unlock(ssd1306_t *ssd1306_ptr) {
+
+    if (ssd1306_ptr->lock != NULL)
+        ssd1306_ptr->lock(false, ssd1306_ptr->lock_ctx);
 }
 
 
 ssd1306_status_t
-ssd1306_draw_circle(ssd1306_t *ssd1306_ptr, uint8_t x0, uint8_t y0, uint16_t r,
-        ssd1306_color_t color) {
-
+ssd1306_update_snapshot(ssd1306_t *ssd1306_ptr, uint8_t *snapshot) {
+#ifdef SSD1306_ENABLE_PAGE_MODE
+    (void)ssd1306_ptr;
+    (void)snapshot;
+    return SSD1306_WRONG_PARAMS;
+#else
     SSD1306_DECLARE_STATUS_VARIABLE()
-    int32_t xc = x0, yc = y0, rc = r;
-    int32_t x = -rc, y = 0, err = 2-2*rc;
 
-    // Bresenham's algorithm.
-    do {
-        status = ssd1306_draw_pixel(ssd1306_ptr, xc-x, yc+y, color);
-        if (status != SSD1306_OK) return status;
-        status = ssd1306_draw_pixel(ssd1306_ptr, xc-y, yc-x, color);
-        if (status != SSD1306_OK) return status;
-        status = ssd1306_draw_pixel(ssd1306_ptr, xc+x, yc-y, color);
-        if (status != SSD1306_OK) return status;
-        status = ssd1306_draw_pixel(ssd1306_ptr, xc+y, yc+x, color);
-        if (status != SSD1306_OK) return status;
+    uint8_t span_start[SSD1306_NUM_PAGES];
+    uint8_t span_end[SSD1306_NUM_PAGES];
 
-        rc = err;
-        if (rc >  x) err += ++x*2+1;
-        if (rc <= y) err += ++y*2+1;
-    } while (x < 0);
+    if (ssd1306_ptr->initialized == false)
+        return SSD1306_NOINIT;
+    if (ssd1306_is_busy(ssd1306_ptr))
+        return SSD1306_BUSY;
 
-    return SSD1306_OK;
+    // Only the dirty spans are copied: the snapshot is read within them.
+    ssd1306_lock(ssd1306_ptr);
+    ssd1306_async_recover(ssd1306_ptr);
+    for (uint8_t p = 0; p < SSD1306_NUM_PAGES; p++) {
+        span_start[p] = ssd1306_ptr->dirty_start[p];
+        span_end[p]   = ssd1306_ptr->dirty_end[p];
+        if (span_start[p] > span_end[p]) continue;
+
+        memcpy(&snapshot[SSD1306_PXL_WIDTH * p + span_start[p]],
+                &ssd1306_ptr->buffer[SSD1306_PXL_WIDTH * p + span_start[p]],
+                span_end[p] - span_start[p] + 1);
+        ssd1306_mark_clean(ssd1306_ptr, p);
+    }
+    ssd1306_unlock(ssd1306_ptr);
+
+    SSD1306_STATS_UPDATE_BEGIN();
+
+    status = ssd1306_flush_spans(ssd1306_ptr, snapshot, span_start, span_end);
+
+    // The spans not transmitted are merged with the ones drawn meanwhile.
+    if (status != SSD1306_OK) {
+        ssd1306_lock(ssd1306_ptr);
+        for (uint8_t p = 0; p < SSD1306_NUM_PAGES; p++) {
+            if (span_start[p] <= span_end[p])
+                ssd1306_mark_dirty(ssd1306_ptr, p, span_start[p], span_end[p]);
+        }
+        ssd1306_unlock(ssd1306_ptr);
+    }
+
+    SSD1306_STATS_UPDATE_END(status);
+    return status;
+#endif
 }
 
+#endif
 
-ssd1306_status_t
-ssd1306_draw_filled_circle(ssd1306_t *ssd1306_ptr, uint8_t x0, uint8_t y0,
-        uint16_t r, ssd1306_color_t color) {
 
-    SSD1306_DECLARE_STATUS_VARIABLE()
-    int32_t xc = x0, yc = y0, rc = r;
-    int32_t x = -rc, y = 0, err = 2-2*rc;
+#ifdef SSD1306_ENABLE_ASYNC
 
-    // Bresenham's algorithm.
-    // FIXME: does not generate a perfectly filled circle.
-    do {
-        status = ssd1306_draw_line(ssd1306_ptr, xc-x, yc+y, xc+x, yc-y, color);
-        if (status != SSD1306_OK) return status;
-        status = ssd1306_draw_line(ssd1306_ptr, xc-y, yc-x, xc+y, yc+x, color);
-        if (status != SSD1306_OK) return status;
-        status = ssd1306_draw_line(ssd1306_ptr, xc+x, yc-y, xc-x, yc+y, color);
-        if (status != SSD1306_OK) return status;
-        status = ssd1306_draw_line(ssd1306_ptr, xc+y, yc+x, xc-y, yc-x, color);
-        if (status != SSD1306_OK) return status;
+/**
+ * Ends the ongoing non-blocking update of the given display. If the update
+ * failed, the spans that have not been transmitted are left in tx_start and
+ * tx_end, to be marked as dirty again by the next update (see
+ * ssd1306_async_recover).
+ *
+ * @param ssd1306_ptr a pointer to a ssd1306_t structure.
+ * @param status      the outcome of the update.
+ */
+static void
+ssd1306_async_end(ssd1306_t *ssd1306_ptr, ssd1306_status_t status) {
 
-        rc = err;
-        if (rc >  x) err += ++x*2+1;
-        if (rc <= y) err += ++y*2+1;
-    } while (x < 0);
+    if (status != SSD1306_OK) {
+        ssd1306_ptr->tx_failed = true;
+        ssd1306_shadow_reset(ssd1306_ptr);
+    } else {
+        ssd1306_ptr->start_line_acked = ssd1306_ptr->tx_line_seq;
+    }
 
-    return SSD1306_OK;
+    ssd1306_ptr->busy = false;
+    SSD1306_STATS_UPDATE_END(status);
 }
 
 
-ssd1306_status_t
-ssd1306_draw_triangle(ssd1306_t *ssd1306_ptr, uint8_t x1, uint8_t y1,
-        uint8_t x2, uint8_t y2, uint8_t x3, uint8_t y3, ssd1306_color_t color) {
+/**
+ * Starts the transaction carrying the next chunk of the span being sent.
+ *
+ * @param  ssd1306_ptr a pointer to a ssd1306_t structure.
+ * @param  header_ptr  the header bytes, which must outlive the transaction.
+ * @param  header_size the size of the header in bytes.
+ * @return the outcome of the transaction start.
+ */
+static ssd1306_status_t
+ssd1306_async_chunk(ssd1306_t *ssd1306_ptr, const uint8_t *header_ptr,
+        size_t header_size) {
 
-    SSD1306_DECLARE_STATUS_VARIABLE()
+    const uint8_t *data_ptr = ssd1306_ptr->tx_data_ptr;
+    size_t chunk_size = ssd1306_chunk_size(ssd1306_ptr, header_size,
+            ssd1306_ptr->tx_data_size);
 
-    status = ssd1306_draw_line(ssd1306_ptr, x1, y1, x2, y2, color);
-    if (status != SSD1306_OK) return status;
-    status = ssd1306_draw_line(ssd1306_ptr, x2, y2, x3, y3, color);
-    if (status != SSD1306_OK) return status;
-    status = ssd1306_draw_line(ssd1306_ptr, x3, y3, x1, y1, color);
-    if (status != SSD1306_OK) return status;
+    ssd1306_ptr->tx_data_ptr  += chunk_size;
+    ssd1306_ptr->tx_data_size -= chunk_size;
 
-    return SSD1306_OK;
+    SSD1306_STATS_WRITE_BEGIN(header_size + chunk_size);
+    ssd1306_status_t status = ssd1306_ptr->transport->write_async(
+            ssd1306_ptr->transport_ctx, header_ptr, header_size,
+            data_ptr, chunk_size, ssd1306_ptr);
+
+    // A transaction not started is over, without completion.
+    if (status != SSD1306_OK) SSD1306_STATS_WRITE_END(status);
+    return status;
 }
 
 
-ssd1306_status_t
-ssd1306_draw_filled_triangle(ssd1306_t *ssd1306_ptr, uint8_t x1, uint8_t y1,
-        uint8_t x2, uint8_t y2, uint8_t x3, uint8_t y3, ssd1306_color_t color) {
+/**
+ * Starts the transaction carrying the queued commands of the ongoing
+ * non-blocking update on their own, preceded by a command control byte.
+ *
+ * @param  ssd1306_ptr a pointer to a ssd1306_t structure.
+ * @return the outcome of the transaction start.
+ */
+static ssd1306_status_t
+ssd1306_async_commands(ssd1306_t *ssd1306_ptr) {
 
-    int16_t deltax = 0, deltay = 0, x = 0, y = 0, xinc1 = 0, xinc2 = 0;
-    int16_t yinc1 = 0, yinc2 = 0, den = 0, num = 0, numadd = 0;
-    int16_t numpixels = 0, curpixel = 0;
+    ssd1306_ptr->tx_header[0]   = SSD1306_CMD_CONTROL_BYTE;
+    ssd1306_ptr->tx_header_size = 1;
+    ssd1306_ptr->tx_data_ptr    = ssd1306_ptr->tx_cmd;
+    ssd1306_ptr->tx_data_size   = ssd1306_ptr->tx_cmd_len;
+    ssd1306_ptr->tx_cmd_len     = 0;
+    ssd1306_ptr->tx_cmd_only    = true;
+
+    return ssd1306_async_chunk(ssd1306_ptr, ssd1306_ptr->tx_header, 1);
+}
 
-    deltax = ABS(x2 - x1);
-    deltay = ABS(y2 - y1);
-    x = x1;
-    y = y1;
 
-    if (x2 >= x1) { xinc1 = 1;  xinc2 = 1;  }
-    else          { xinc1 = -1; xinc2 = -1; }
+/**
+ * Starts the next transaction of the ongoing non-blocking update.
+ * Each transaction narrows the address window to the span being sent
+ * by means of single command control bytes, followed by the data bytes.
+ * Consecutive pages to be sent entirely are merged in one transaction
+ * because they are contiguous in the software buffer.
+ * The queued commands lead the header of the first transaction, as for
+ * ssd1306_data_write, unless they do not fit in it or there is no span to
+ * be sent: in that case, they are sent by a transaction of their own.
+ *
+ * @param  ssd1306_ptr a pointer to a ssd1306_t structure.
+ * @param  done        set to true if there is nothing left to be sent.
+ * @return the outcome of the transaction start.
+ */
+static ssd1306_status_t
+ssd1306_async_next(ssd1306_t *ssd1306_ptr, bool *done) {
+
+    uint8_t page_start = ssd1306_ptr->tx_page, page_end, col_end;
+    size_t header_size = 2 * (size_t)ssd1306_ptr->tx_cmd_len;
+    bool found;
+
+    // Looking for the window has no side effect on the spans but narrowing
+    // them, hence it can be looked for again after the commands are sent.
+    found = ssd1306_next_window(ssd1306_ptr, ssd1306_ptr->front_buffer,
+            ssd1306_ptr->tx_start, ssd1306_ptr->tx_end,
+            &page_start, &page_end, &col_end);
+
+    *done = false;
+    if (header_size != 0 && (!found || (ssd1306_ptr->i2c_max_transfer != 0 &&
+            header_size + SSD1306_TX_HEADER_SIZE >= ssd1306_ptr->i2c_max_transfer)))
+        return ssd1306_async_commands(ssd1306_ptr);
+
+    *done = !found;
+    if (*done) {
+        ssd1306_ptr->tx_page = SSD1306_NUM_PAGES;
+        return SSD1306_OK;
+    }
 
-    if (y2 >= y1) { yinc1 = 1;  yinc2 = 1;  }
-    else          { yinc1 = -1; yinc2 = -1; }
+    uint8_t col_start = ssd1306_ptr->tx_start[page_start];
 
-    if (deltax >= deltay) {
-        xinc1     = 0;
-        yinc2     = 0;
-        den       = deltax;
-        num       = deltax / 2;
-        numadd    = deltay;
-        numpixels = deltax;
-    } else {
-        xinc2     = 0;
-        yinc1     = 0;
-        den       = deltay;
-        num       = deltay / 2;
-        numadd    = deltax;
-        numpixels = deltay;
+    // The header must outlive this function call.
+    for (uint8_t i = 0; i < ssd1306_ptr->tx_cmd_len; i++) {
+        ssd1306_ptr->tx_header[2 * i]     = SSD1306_CMD_SINGLE_CONTROL_BYTE;
+        ssd1306_ptr->tx_header[2 * i + 1] = ssd1306_ptr->tx_cmd[i];
     }
+    ssd1306_ptr->tx_cmd_len = 0;
+
+    ssd1306_window_header(&ssd1306_ptr->tx_header[header_size], col_start,
+            col_end, page_start, page_end);
+    ssd1306_ptr->tx_header_size = header_size + SSD1306_TX_HEADER_SIZE;
+    ssd1306_ptr->tx_page      = page_start;
+    ssd1306_ptr->tx_page_end  = page_end;
+    ssd1306_ptr->tx_col_end   = col_end;
+    ssd1306_ptr->tx_data_ptr  =
+            &ssd1306_ptr->front_buffer[SSD1306_PXL_WIDTH * page_start + col_start];
+    ssd1306_ptr->tx_data_size =
+            (size_t)(page_end - page_start) * SSD1306_PXL_WIDTH +
+                    col_end - col_start + 1;
+
+    return ssd1306_async_chunk(ssd1306_ptr, ssd1306_ptr->tx_header,
+            ssd1306_ptr->tx_header_size);
+}
 
-    for (curpixel = 0; curpixel <= numpixels; curpixel++) {
-        SSD1306_DECLARE_STATUS_VARIABLE()
 
-        status = ssd1306_draw_line(ssd1306_ptr, x, y, x3, y3, color);
-        if (status != SSD1306_OK) return status;
+/**
+ * Starts a non-blocking update of the spans currently marked as dirty.
+ *
+ * @param  ssd1306_ptr a pointer to a ssd1306_t structure.
+ * @param  callback    function called at the end of the update.
+ * @param  ctx         user context passed to the callback.
+ * @return the outcome of the transmission start.
+ */
+static ssd1306_status_t
+ssd1306_async_start(ssd1306_t *ssd1306_ptr, ssd1306_callback_t callback,
+        void *ctx) {
 
-        num += numadd;
-        if (num >= den) {
-            num -= den;
-            x += xinc1;
-            y += yinc1;
-        }
-        x += xinc2;
-        y += yinc2;
+    SSD1306_DECLARE_STATUS_VARIABLE()
+    bool done;
+
+    if (ssd1306_ptr->initialized == false)
+        return SSD1306_NOINIT;
+    if (ssd1306_ptr->busy)
+        return SSD1306_BUSY;
+
+    ssd1306_async_recover(ssd1306_ptr);
+    SSD1306_STATS_UPDATE_BEGIN();
+
+    // The dirty spans are moved to the transmission state, so that the
+    // next drawings are tracked independently from the ongoing update.
+    memcpy(ssd1306_ptr->tx_start, ssd1306_ptr->dirty_start,
+            sizeof(ssd1306_ptr->tx_start));
+    memcpy(ssd1306_ptr->tx_end, ssd1306_ptr->dirty_end,
+            sizeof(ssd1306_ptr->tx_end));
+    for (uint8_t p = 0; p < SSD1306_NUM_PAGES; p++)
+        ssd1306_mark_clean(ssd1306_ptr, p);
+
+    // The queued commands are moved as well, so that the ones queued
+    // meanwhile are sent by the next update. No blocking transaction is
+    // needed: they are sent along with the spans (see ssd1306_async_next).
+    memcpy(ssd1306_ptr->tx_cmd, ssd1306_ptr->cmd_batch,
+            ssd1306_ptr->cmd_batch_len);
+    ssd1306_ptr->tx_cmd_len    = ssd1306_ptr->cmd_batch_len;
+    ssd1306_ptr->tx_cmd_only   = false;
+    ssd1306_ptr->cmd_batch_len = 0;
+
+    // So is the start line, which is applied once the update succeeds.
+    ssd1306_ptr->tx_line_seq = ssd1306_ptr->start_line_seq;
+    if (ssd1306_ptr->tx_line_seq != ssd1306_ptr->start_line_acked)
+        ssd1306_ptr->tx_cmd[ssd1306_ptr->tx_cmd_len++] =
+                0x40 | (ssd1306_ptr->start_page << 3);
+
+    ssd1306_ptr->tx_page     = 0;
+    ssd1306_ptr->tx_callback = callback;
+    ssd1306_ptr->tx_ctx      = ctx;
+    ssd1306_ptr->busy        = true;
+
+    // The submitted buffer becomes the front buffer. If double buffering
+    // is enabled, the next frame can be drawn in the other one meanwhile.
+    ssd1306_swap_buffers(ssd1306_ptr);
+
+    status = ssd1306_async_next(ssd1306_ptr, &done);
+    if (status != SSD1306_OK || done) {
+        // Nothing has been started: the user is notified by the return value.
+        ssd1306_async_end(ssd1306_ptr, status);
+        ssd1306_async_recover(ssd1306_ptr);
+        return status;
     }
 
     return SSD1306_OK;
@@ -733,51 +3059,59 @@ ssd1306_draw_filled_triangle(ssd1306_t *ssd1306_ptr, uint8_t x1, uint8_t y1,
 
 
 ssd1306_status_t
-ssd1306_draw_bitmap(ssd1306_t *ssd1306_ptr, uint8_t x, uint8_t y,
-        const unsigned char* bitmap, uint8_t w, uint8_t h,
-        ssd1306_color_t color) {
-
-    uint16_t byte_width = (w + 7) >> 3; // Bitmap scanline pad = whole byte.
-    uint8_t  byte = 0;
-
-    for (uint8_t j = 0; j < h; j++, y++) {
-        for (uint8_t i = 0; i < w; i++) {
-            if (i & 7)
-                byte <<= 1;
-            else
-                byte = bitmap[j * byte_width + (i >> 3)];
+ssd1306_update_async(ssd1306_t *ssd1306_ptr, ssd1306_callback_t callback,
+        void *ctx) {
 
-            if (byte & 0x80) {
-                SSD1306_DECLARE_STATUS_VARIABLE()
-                status = ssd1306_draw_pixel(ssd1306_ptr, x + i, y, color);
-                if (status != SSD1306_OK) return status;
-            }
-        }
-    }
+    if (ssd1306_is_busy(ssd1306_ptr))
+        return SSD1306_BUSY;
 
-    return SSD1306_OK;
+    ssd1306_mark_all_dirty(ssd1306_ptr);
+    return ssd1306_async_start(ssd1306_ptr, callback, ctx);
 }
 
 
 ssd1306_status_t
-ssd1306_update(ssd1306_t *ssd1306_ptr) {
-    SSD1306_DECLARE_STATUS_VARIABLE()
+ssd1306_update_dirty_async(ssd1306_t *ssd1306_ptr, ssd1306_callback_t callback,
+        void *ctx) {
+
+    return ssd1306_async_start(ssd1306_ptr, callback, ctx);
+}
 
-    assert(SSD1306_PXL_WIDTH < SSD1306_DATA_WRITE_BUFFER_SIZE);
 
-    // The software buffer is flushed to the display ram.
-    // The GDDRAM is written entirely when this function is called.
-    // Exploiting horizontal addressing mode allows to get rid of setting
-    // the right page and column address because it is automatic.
-    for (uint8_t p = 0; p < SSD1306_NUM_PAGES; p++) {
-        status = ssd1306_data_write(ssd1306_ptr,
-            &ssd1306_ptr->buffer[SSD1306_PXL_WIDTH * p], SSD1306_PXL_WIDTH);
-        if (status != SSD1306_OK) return status;
+void
+ssd1306_i2c_write_async_complete(void *ctx, ssd1306_status_t status) {
+
+    ssd1306_t *ssd1306_ptr = (ssd1306_t *)ctx;
+    bool done = false;
+
+    SSD1306_STATS_WRITE_END(status);
+
+    if (status == SSD1306_OK && ssd1306_ptr->tx_data_size != 0) {
+        // The span is not over: the next chunk only needs the control
+        // byte which ends the header.
+        status = ssd1306_async_chunk(ssd1306_ptr,
+                &ssd1306_ptr->tx_header[ssd1306_ptr->tx_header_size - 1], 1);
+    } else if (status == SSD1306_OK) {
+        // Removes the window sent by the completed transaction, if any.
+        if (ssd1306_ptr->tx_cmd_only)
+            ssd1306_ptr->tx_cmd_only = false;
+        else
+            ssd1306_window_sent(ssd1306_ptr, ssd1306_ptr->front_buffer,
+                    ssd1306_ptr->tx_start, ssd1306_ptr->tx_end,
+                    ssd1306_ptr->tx_page, ssd1306_ptr->tx_page_end,
+                    ssd1306_ptr->tx_col_end);
+        status = ssd1306_async_next(ssd1306_ptr, &done);
     }
 
-    return SSD1306_OK;
+    if (status != SSD1306_OK || done) {
+        ssd1306_async_end(ssd1306_ptr, status);
+        if (ssd1306_ptr->tx_callback != NULL)
+            ssd1306_ptr->tx_callback(status, ssd1306_ptr->tx_ctx);
+    }
 }
 
+#endif
+
 
 ///////////////////////////////////////////////////////////
 // INITIALIZATION FUNCTIONS
@@ -790,10 +3124,8 @@ ssd1306_clear_display(ssd1306_t *ssd1306_ptr) {
     status = ssd1306_set_inversion(ssd1306_ptr, false);
     if (status != SSD1306_OK) return status;
 
-    status = ssd1306_draw_fill(ssd1306_ptr, SSD1306_COLOR_BLACK);
-    if (status != SSD1306_OK) return status;
-
-    status = ssd1306_update(ssd1306_ptr);
+    // Rendering nothing clears each band in page mode.
+    status = ssd1306_render(ssd1306_ptr, NULL, NULL);
     if (status != SSD1306_OK) return status;
 
     return SSD1306_OK;
@@ -803,75 +3135,172 @@ ssd1306_clear_display(ssd1306_t *ssd1306_ptr) {
 ssd1306_status_t
 ssd1306_clear_buffer(ssd1306_t *ssd1306_ptr) {
 
-    memset(ssd1306_ptr->buffer, 0, sizeof(ssd1306_ptr->buffer));
+    if (ssd1306_buffer_locked(ssd1306_ptr))
+        return SSD1306_BUSY;
+
+    memset(ssd1306_ptr->buffer, 0, SSD1306_BUFFER_SIZE);
+    ssd1306_mark_all_dirty(ssd1306_ptr);
     return SSD1306_OK;
 }
 
 
-ssd1306_status_t
-ssd1306_init(ssd1306_t *ssd1306_ptr, uint8_t i2c_channel, uint8_t i2c_addr) {
+/**
+ * Init sequence of the display, sent within a single transaction. It also
+ * sets the state a reset ssd1306_t structure expects: normal colors,
+ * scrolling disabled and start line 0.
+ */
+static const uint8_t ssd1306_init_sequence[] = {
+        SSD1306_CMD_CONTROL_BYTE,
+        // Fundamental commands.
+        SSD1306_CMD_CHARGE_PUMP_SETTING,
+        SSD1306_SUBCMD_DISABLE_CHARGE_PUMP,
+        SSD1306_CMD_DISPLAYOFF,
+        SSD1306_CMD_NORMALDISPLAY,
+        SSD1306_CMD_SETCONTRAST,
+        0xFF,                // Max contrast.
+        SSD1306_CMD_DEACTIVATE_SCROLL,
+        SSD1306_CMD_RESUMETORAM,
+        // Addressing settings (default is HAM).
+        SSD1306_CMD_SET_MEMORY_ADDRESSING_MODE,
+        SSD1306_SUBCMD_MEM_ADDR_MODE_HAM,
+        SSD1306_CMD_SET_COLUMN_ADDRESS,
+        SSD1306_COL_OFFSET,  // First column of the panel.
+        SSD1306_COL_OFFSET + SSD1306_PXL_WIDTH - 1, // Last column.
+        SSD1306_CMD_SET_PAGE_ADDRESS,
+        0x00,                // Page start address is 0.
+        SSD1306_NUM_PAGES - 1, // Last page of the panel.
+        // Hardware configuration.
+        0x40,                // Display start line.
+        SSD1306_CMD_SEGMENT_REMAP_COL127_SEG0,
+        SSD1306_CMD_SET_MULTIPLEX_RATIO,
+        SSD1306_PXL_HEIGHT - 1, // Value of multiplex ratio.
+        SSD1306_CMD_COM_SCAN_DIRECTION_REMAPPED,
+        SSD1306_CMD_SET_DISPLAY_OFFSET,
+        0x00,                // No display offset.
+        SSD1306_CMD_SET_COM_PINS_HW_CONFIG,
+        SSD1306_COM_PINS_CONFIG, // Disables COM left/right remap.
+        // Timing and driving scheme.
+        SSD1306_CMD_SET_DIS_CLK_OSC_FREQ,
+        0x80,
+        SSD1306_CMD_SET_PRECHARGE_PERIOD,
+        0x22,                // Pre-charge period.
+        SSD1306_CMD_SET_VCOMH_DESELECT_LEVEL,
+        0x20,                // 0.77 x Vcc.
+        // Turns the display on.
+        SSD1306_CMD_CHARGE_PUMP_SETTING,
+        SSD1306_SUBCMD_ENABLE_CHARGE_PUMP,
+        SSD1306_CMD_DISPLAYON
+};
+
+
+/**
+ * Sequence sent instead of the init sequence when the display has kept
+ * its configuration: it only brings back the state tracked by the driver,
+ * which a previous run may have changed.
+ */
+static const uint8_t ssd1306_warm_init_sequence[] = {
+        SSD1306_CMD_CONTROL_BYTE,
+        SSD1306_CMD_DEACTIVATE_SCROLL,
+        SSD1306_CMD_NORMALDISPLAY,
+        0x40,                // Display start line.
+        SSD1306_CMD_CHARGE_PUMP_SETTING,
+        SSD1306_SUBCMD_ENABLE_CHARGE_PUMP,
+        SSD1306_CMD_DISPLAYON
+};
+
+
+/**
+ * Resets the display structure, initializes the transport and sends
+ * the init sequence to the display.
+ *
+ * @param  ssd1306_ptr   a pointer to a ssd1306_t structure.
+ * @param  transport     the operations of the transport.
+ * @param  transport_ctx the context of the transport operations.
+ * @param  channel       the bus identifier.
+ * @param  i2c_addr      the i2c address of the display, if any.
+ * @param  warm          true if the display kept its configuration and
+ *                       its ram content.
+ * @return the outcome of the function call.
+ */
+static ssd1306_status_t
+ssd1306_init_common(ssd1306_t *ssd1306_ptr,
+        const ssd1306_transport_t *transport, void *transport_ctx,
+        uint8_t channel, uint8_t i2c_addr, bool warm) {
     // Resets the display structure.
     memset(ssd1306_ptr, 0, sizeof(ssd1306_t));
 
-    ssd1306_ptr->i2c_channel = i2c_channel;
-    ssd1306_ptr->i2c_addr    = i2c_addr;
-    ssd1306_ptr->initialized = 1;
+    ssd1306_ptr->i2c_channel   = channel;
+    ssd1306_ptr->i2c_addr      = i2c_addr;
+    ssd1306_ptr->transport     = transport;
+    ssd1306_ptr->transport_ctx = transport_ctx;
+    ssd1306_ptr->initialized   = 1;
+    ssd1306_ptr->buffer        = ssd1306_ptr->frame;
+    ssd1306_ptr->front_buffer  = ssd1306_ptr->frame;
+    ssd1306_ptr->clip_x1       = SSD1306_PXL_WIDTH - 1;
+    ssd1306_ptr->clip_y1       = SSD1306_PXL_HEIGHT - 1;
 
-    // Soft-resets the display hardware.
     SSD1306_DECLARE_STATUS_VARIABLE()
 
-    // Fundamental commands.
-    status = ssd1306_display_off(ssd1306_ptr);
+    status = transport->init(ssd1306_ptr->transport_ctx);
     if (status != SSD1306_OK) return status;
 
-    status = ssd1306_set_inversion(ssd1306_ptr, false);
-    if (status != SSD1306_OK) return status;
-
-    status = ssd1306_set_contrast(ssd1306_ptr, 0xFF); // Max contrast.
-    if (status != SSD1306_OK) return status;
+    ssd1306_ptr->i2c_max_transfer =
+            transport->max_transfer_size(ssd1306_ptr->transport_ctx);
 
-    // Disables scrolling.
-    status = ssd1306_set_scroll_status(ssd1306_ptr, false);
-    if (status != SSD1306_OK) return status;
+    // The header of a transaction must leave room for at least one data byte.
+    if (ssd1306_ptr->i2c_max_transfer != 0 &&
+            ssd1306_ptr->i2c_max_transfer <= SSD1306_TX_HEADER_SIZE)
+        return SSD1306_WRONG_PARAMS;
 
-    const uint8_t cmd_list[] = {
-            SSD1306_CMD_CONTROL_BYTE,
-            SSD1306_CMD_RESUMETORAM,
-            // Addressing settings (default is HAM).
-            SSD1306_CMD_SET_MEMORY_ADDRESSING_MODE,
-            SSD1306_SUBCMD_MEM_ADDR_MODE_HAM,
-            SSD1306_CMD_SET_COLUMN_ADDRESS,
-            0x00,                // Column start address is 0.
-            0x7F,                // Column end address is 127.
-            SSD1306_CMD_SET_PAGE_ADDRESS,
-            0x00,                // Page start address is 0.
-            0x07,                // Page end address is 7.
-            // Hardware configuration.
-            0x40,                // Display start line.
-            SSD1306_CMD_SEGMENT_REMAP_COL127_SEG0,
-            SSD1306_CMD_SET_MULTIPLEX_RATIO,
-            0x3F,                // Value of multiplex ratio.
-            SSD1306_CMD_COM_SCAN_DIRECTION_REMAPPED,
-            SSD1306_CMD_SET_DISPLAY_OFFSET,
-            0x00,                // No display offset.
-            SSD1306_CMD_SET_COM_PINS_HW_CONFIG,
-            0x12,                // Alt. config., disables COM left/right remap.
-            // Timing and driving scheme.
-            SSD1306_CMD_SET_DIS_CLK_OSC_FREQ,
-            0x80,
-            SSD1306_CMD_SET_PRECHARGE_PERIOD,
-            0x22,                // Pre-charge period.
-            SSD1306_CMD_SET_VCOMH_DESELECT_LEVEL,
-            0x20                 // 0.77 x Vcc.
-    };
+    if (warm) {
+        SSD1306_DECLARE_COMMAND_WRITE_MULTI(ssd1306_warm_init_sequence)
 
-    SSD1306_DECLARE_COMMAND_WRITE_MULTI(cmd_list)
+        // The display ram keeps the previous frame: the first update,
+        // even an incremental one, replaces all of it.
+        ssd1306_mark_all_dirty(ssd1306_ptr);
+        return SSD1306_OK;
+    }
 
-    status = ssd1306_display_on(ssd1306_ptr);
-    if (status != SSD1306_OK) return status;
+    SSD1306_DECLARE_COMMAND_WRITE_MULTI(ssd1306_init_sequence)
 
-    status = ssd1306_clear_display(ssd1306_ptr);
+    // Colors are already normal: rendering nothing clears the display ram.
+    status = ssd1306_render(ssd1306_ptr, NULL, NULL);
     if (status != SSD1306_OK) return status;
 
     return SSD1306_OK;
 }
+
+
+ssd1306_status_t
+ssd1306_init(ssd1306_t *ssd1306_ptr, uint8_t i2c_channel, uint8_t i2c_addr) {
+
+    return ssd1306_init_common(ssd1306_ptr, &ssd1306_i2c_transport,
+            ssd1306_ptr, i2c_channel, i2c_addr, false);
+}
+
+
+ssd1306_status_t
+ssd1306_init_warm(ssd1306_t *ssd1306_ptr, uint8_t i2c_channel,
+        uint8_t i2c_addr) {
+
+    return ssd1306_init_common(ssd1306_ptr, &ssd1306_i2c_transport,
+            ssd1306_ptr, i2c_channel, i2c_addr, true);
+}
+
+
+ssd1306_status_t
+ssd1306_init_transport(ssd1306_t *ssd1306_ptr,
+        const ssd1306_transport_t *transport, void *transport_ctx,
+        uint8_t channel, bool warm) {
+
+    if (transport == NULL || transport->init == NULL ||
+            transport->max_transfer_size == NULL || transport->write_v == NULL)
+        return SSD1306_WRONG_PARAMS;
+#ifdef SSD1306_ENABLE_ASYNC
+    if (transport->write_async == NULL)
+        return SSD1306_WRONG_PARAMS;
+#endif
+
+    return ssd1306_init_common(ssd1306_ptr, transport, transport_ctx,
+            channel, 0, warm);
+}
@@ -0,0 +1,207 @@
+/**
+ * @file   ssd1306_field.c
+ * @brief  SSD1306 OLED display C library.
+ *
+ * @copyright
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  any later version.
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ *  GNU General Public License for more details.
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program. If not, see <http://www.gnu.org/licenses/>.
+ *
+ * @author Giovanni Scotti
+ */
+
+
+#include <string.h> // for memset.
+#include "ssd1306_field.h"
+
+
+#ifndef SSD1306_ENABLE_PAGE_MODE
+
+
+///////////////////////////////////////////////////////////
+///////////////////////////////////////////////////////////
+// PRIVATE FUNCTIONS
+///////////////////////////////////////////////////////////
+///////////////////////////////////////////////////////////
+
+/**
+ * Tells whether the given field has been initialized on a display which is
+ * still initialized. A field whose initialization failed has no display.
+ *
+ * @param  field_ptr a pointer to a ssd1306_field_t structure.
+ * @return true if the field can be drawn.
+ */
+static inline bool
+ssd1306_field_ready(const ssd1306_field_t *field_ptr) {
+
+    return field_ptr->display != NULL && field_ptr->display->initialized;
+}
+
+
+/**
+ * Formats the given value as shown by the given field: exactly width
+ * characters, padded according to the alignment of the field.
+ *
+ * @param field_ptr a pointer to a ssd1306_field_t structure.
+ * @param value     the value, in units of 10^-decimals.
+ * @param text      on output, the width characters of the field.
+ */
+static void
+ssd1306_field_format(const ssd1306_field_t *field_ptr, int32_t value,
+        char *text) {
+
+    char digits[SSD1306_INT_STR_SIZE];
+    uint8_t len      = (uint8_t)ssd1306_format_int(digits, value, 10);
+    uint8_t sign     = (value < 0) ? 1 : 0;
+    uint8_t decimals = field_ptr->decimals;
+    uint8_t width    = field_ptr->width;
+
+    // The integer part has at least one digit, e.g. 5 is shown as 0.05
+    // with two decimals: the missing digits are leading zeros.
+    uint8_t num_digits = len - sign;
+    uint8_t int_digits = (num_digits > decimals) ? num_digits - decimals : 1;
+    uint8_t zeros      = int_digits + decimals - num_digits;
+    uint8_t total      = sign + int_digits + ((decimals != 0) ? decimals + 1 : 0);
+    uint8_t pos = 0;
+
+    if (total > width) {
+        memset(text, SSD1306_FIELD_OVERFLOW_CHAR, width);
+        return;
+    }
+
+    uint8_t pad = width - total;
+
+    if (field_ptr->align == SSD1306_FIELD_ALIGN_RIGHT) {
+        memset(text, ' ', pad);
+        pos = pad;
+    }
+    if (sign) text[pos++] = '-';
+    if (field_ptr->align == SSD1306_FIELD_ZERO_PAD) {
+        memset(&text[pos], '0', pad);
+        pos += pad;
+    }
+
+    for (uint8_t i = 0; i < int_digits + decimals; i++) {
+        if (i == int_digits) text[pos++] = '.';
+        text[pos++] = (i < zeros) ? '0' : digits[sign + i - zeros];
+    }
+
+    if (field_ptr->align == SSD1306_FIELD_ALIGN_LEFT)
+        memset(&text[pos], ' ', pad);
+}
+
+
+///////////////////////////////////////////////////////////
+///////////////////////////////////////////////////////////
+// PUBLIC API
+///////////////////////////////////////////////////////////
+///////////////////////////////////////////////////////////
+
+ssd1306_status_t
+ssd1306_field_init(ssd1306_field_t *field_ptr, ssd1306_t *ssd1306_ptr,
+        uint8_t x, uint8_t y, uint8_t width, ssd1306_font_name_t font_name,
+        ssd1306_color_t color) {
+
+    const ssd1306_font_t *font = get_font_ptr(font_name);
+
+    // On failure, the field is left without display (see ssd1306_field_ready).
+    memset(field_ptr, 0, sizeof(ssd1306_field_t));
+
+    if (ssd1306_ptr == NULL || ssd1306_ptr->initialized == false)
+        return SSD1306_NOINIT;
+    if (font == NULL || font->font_cols == NULL || font->glyph_widths != NULL)
+        return SSD1306_WRONG_PARAMS;
+    if (width == 0 || width > SSD1306_FIELD_MAX_WIDTH ||
+            x + width * font->font_width > SSD1306_PXL_WIDTH)
+        return SSD1306_WRONG_PARAMS;
+    if (color != SSD1306_COLOR_BLACK && color != SSD1306_COLOR_WHITE)
+        return SSD1306_WRONG_PARAMS;
+
+    field_ptr->display    = ssd1306_ptr;
+    field_ptr->font_name  = font_name;
+    field_ptr->color      = color;
+    field_ptr->align      = SSD1306_FIELD_ALIGN_RIGHT;
+    field_ptr->x          = x;
+    field_ptr->y          = y;
+    field_ptr->width      = width;
+    field_ptr->cell_width = font->font_width;
+
+    return SSD1306_OK;
+}
+
+
+ssd1306_status_t
+ssd1306_field_set_format(ssd1306_field_t *field_ptr, uint8_t decimals,
+        ssd1306_field_align_t align) {
+
+    if (!ssd1306_field_ready(field_ptr))
+        return SSD1306_NOINIT;
+    // Fractional digits need room for an integer digit and the point.
+    if (decimals != 0 && decimals + 2 > field_ptr->width)
+        return SSD1306_WRONG_PARAMS;
+    if (align != SSD1306_FIELD_ALIGN_LEFT &&
+            align != SSD1306_FIELD_ALIGN_RIGHT &&
+            align != SSD1306_FIELD_ZERO_PAD)
+        return SSD1306_WRONG_PARAMS;
+
+    field_ptr->decimals = decimals;
+    field_ptr->align    = align;
+    ssd1306_field_invalidate(field_ptr);
+    return SSD1306_OK;
+}
+
+
+ssd1306_status_t
+ssd1306_field_set_int(ssd1306_field_t *field_ptr, int32_t value) {
+
+    ssd1306_status_t status = SSD1306_OK;
+    ssd1306_t *ssd1306_ptr = field_ptr->display;
+    char text[SSD1306_FIELD_MAX_WIDTH];
+
+    if (!ssd1306_field_ready(field_ptr))
+        return SSD1306_NOINIT;
+
+    ssd1306_field_format(field_ptr, value, text);
+
+    // Characters are drawn opaque, without affecting the drawing state.
+    uint8_t x_pos = ssd1306_ptr->x_pos, y_pos = ssd1306_ptr->y_pos;
+    ssd1306_text_mode_t text_mode = ssd1306_ptr->text_mode;
+    ssd1306_rop_t rop = ssd1306_ptr->rop;
+    ssd1306_ptr->text_mode = SSD1306_TEXT_OPAQUE;
+    ssd1306_ptr->rop       = SSD1306_ROP_COPY;
+
+    for (uint8_t i = 0; i < field_ptr->width; i++) {
+        if (text[i] == field_ptr->text[i]) continue;
+
+        ssd1306_ptr->x_pos = field_ptr->x + i * field_ptr->cell_width;
+        ssd1306_ptr->y_pos = field_ptr->y;
+
+        status = ssd1306_draw_char(ssd1306_ptr, text[i], field_ptr->font_name,
+                field_ptr->color);
+        if (status != SSD1306_OK) break;
+
+        field_ptr->text[i] = text[i];
+    }
+
+    ssd1306_ptr->x_pos     = x_pos;
+    ssd1306_ptr->y_pos     = y_pos;
+    ssd1306_ptr->text_mode = text_mode;
+    ssd1306_ptr->rop       = rop;
+    return status;
+}
+
+
+void
+ssd1306_field_invalidate(ssd1306_field_t *field_ptr) {
+
+    memset(field_ptr->text, '\0', sizeof(field_ptr->text));
+}
+
+#endif
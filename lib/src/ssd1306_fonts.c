@@ -25,12 +25,37 @@
 // Macros to shrink the library.
 //#define ENABLE_FONT_11X18 /// Uncomment to enable 11x18 font.
 //#define ENABLE_FONT_16X26 /// Uncomment to enable 16x26 font.
+//#define ENABLE_FONT_7X10P /// Uncomment to enable proportional 7x10 font.
+//#define ENABLE_FONT_ROW_MAPS /// Uncomment to link the row-major font maps.
+
+// Glyph subsets. Each font holds the characters from ' ' to '~' unless its
+// glyph predicate is defined, in which case only the glyphs it accepts are
+// linked. For instance, large readouts may only need digits, sign and point:
+//#define SSD1306_FONT_16X26_GLYPHS(c) (SSD1306_GLYPH_RANGE(c, '0', '9') || (c) == '-' || (c) == '.')
+
+
+// Helpers of the generated glyph tables. The dense index of a glyph within
+// a subset is the one of the previous character, plus one if the latter is
+// part of the subset. The same goes for the offsets of proportional glyphs.
+#define FONT_HAS(font, c) (!!SSD1306_FONT_##font##_GLYPHS(c))
+#define FONT_RANK_AFTER(font, c, prev) \
+    FONT_##font##_RANK_##c = FONT_##font##_RANK_##prev + FONT_HAS(font, prev)
+#define FONT_RANK(font, c) \
+    (FONT_HAS(font, c) ? FONT_##font##_RANK_##c : SSD1306_GLYPH_MISSING)
+#define FONT_OFFSET_AFTER(font, c, prev, size) \
+    FONT_##font##_OFFSET_##c = FONT_##font##_OFFSET_##prev + \
+            FONT_HAS(font, prev) * (size)
+#define FONT_WIDTH(font, c, width) (FONT_HAS(font, c) ? (width) : 0)
 
 
 // Fonts are supposed to be considered as singletons.
 // They are encapsulated as static const objects and get accessed
 // by the get_font_ptr function.
 
+// Row-major maps are the source of the generated column-major ones. They are
+// not needed to draw characters, hence they are not linked by default.
+#ifdef ENABLE_FONT_ROW_MAPS
+
 /**
  * Encoding for 7x10 font.
  */
@@ -132,6 +157,8 @@ static const uint8_t fontmap_7x10 [] = {
 0x00, 0x00, 0x00, 0x74, 0x4C, 0x00, 0x00, 0x00, 0x00, 0x00,  // ~
 };
 
+#define FONT_7X10_MAP fontmap_7x10
+
 
 #ifdef ENABLE_FONT_11X18
 
@@ -236,6 +263,8 @@ static const uint16_t fontmap_11x18 [] = {
 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x3880, 0x7F80, 0x4700, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // ~
 };
 
+#define FONT_11X18_MAP fontmap_11x18
+
 #endif
 
 
@@ -342,8 +371,1486 @@ static const uint16_t fontmap_16x26 [] = {
 0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x3F07,0x7FC7,0x73E7,0xF1FF,0xF07E,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000, // Ascii = [~]
 };
 
+#define FONT_16X26_MAP fontmap_16x26
+
+#endif
+
+#else
+#define FONT_7X10_MAP  NULL
+#define FONT_11X18_MAP NULL
+#define FONT_16X26_MAP NULL
+#endif
+
+
+// BEGIN OF GENERATED FONTS (tools/ssd1306_fontconv.py)
+
+#ifdef SSD1306_FONT_7X10_GLYPHS
+
+enum {
+FONT_7X10_RANK_32 = 0,
+FONT_RANK_AFTER(7X10, 33, 32), FONT_RANK_AFTER(7X10, 34, 33), FONT_RANK_AFTER(7X10, 35, 34),
+FONT_RANK_AFTER(7X10, 36, 35), FONT_RANK_AFTER(7X10, 37, 36), FONT_RANK_AFTER(7X10, 38, 37),
+FONT_RANK_AFTER(7X10, 39, 38), FONT_RANK_AFTER(7X10, 40, 39), FONT_RANK_AFTER(7X10, 41, 40),
+FONT_RANK_AFTER(7X10, 42, 41), FONT_RANK_AFTER(7X10, 43, 42), FONT_RANK_AFTER(7X10, 44, 43),
+FONT_RANK_AFTER(7X10, 45, 44), FONT_RANK_AFTER(7X10, 46, 45), FONT_RANK_AFTER(7X10, 47, 46),
+FONT_RANK_AFTER(7X10, 48, 47), FONT_RANK_AFTER(7X10, 49, 48), FONT_RANK_AFTER(7X10, 50, 49),
+FONT_RANK_AFTER(7X10, 51, 50), FONT_RANK_AFTER(7X10, 52, 51), FONT_RANK_AFTER(7X10, 53, 52),
+FONT_RANK_AFTER(7X10, 54, 53), FONT_RANK_AFTER(7X10, 55, 54), FONT_RANK_AFTER(7X10, 56, 55),
+FONT_RANK_AFTER(7X10, 57, 56), FONT_RANK_AFTER(7X10, 58, 57), FONT_RANK_AFTER(7X10, 59, 58),
+FONT_RANK_AFTER(7X10, 60, 59), FONT_RANK_AFTER(7X10, 61, 60), FONT_RANK_AFTER(7X10, 62, 61),
+FONT_RANK_AFTER(7X10, 63, 62), FONT_RANK_AFTER(7X10, 64, 63), FONT_RANK_AFTER(7X10, 65, 64),
+FONT_RANK_AFTER(7X10, 66, 65), FONT_RANK_AFTER(7X10, 67, 66), FONT_RANK_AFTER(7X10, 68, 67),
+FONT_RANK_AFTER(7X10, 69, 68), FONT_RANK_AFTER(7X10, 70, 69), FONT_RANK_AFTER(7X10, 71, 70),
+FONT_RANK_AFTER(7X10, 72, 71), FONT_RANK_AFTER(7X10, 73, 72), FONT_RANK_AFTER(7X10, 74, 73),
+FONT_RANK_AFTER(7X10, 75, 74), FONT_RANK_AFTER(7X10, 76, 75), FONT_RANK_AFTER(7X10, 77, 76),
+FONT_RANK_AFTER(7X10, 78, 77), FONT_RANK_AFTER(7X10, 79, 78), FONT_RANK_AFTER(7X10, 80, 79),
+FONT_RANK_AFTER(7X10, 81, 80), FONT_RANK_AFTER(7X10, 82, 81), FONT_RANK_AFTER(7X10, 83, 82),
+FONT_RANK_AFTER(7X10, 84, 83), FONT_RANK_AFTER(7X10, 85, 84), FONT_RANK_AFTER(7X10, 86, 85),
+FONT_RANK_AFTER(7X10, 87, 86), FONT_RANK_AFTER(7X10, 88, 87), FONT_RANK_AFTER(7X10, 89, 88),
+FONT_RANK_AFTER(7X10, 90, 89), FONT_RANK_AFTER(7X10, 91, 90), FONT_RANK_AFTER(7X10, 92, 91),
+FONT_RANK_AFTER(7X10, 93, 92), FONT_RANK_AFTER(7X10, 94, 93), FONT_RANK_AFTER(7X10, 95, 94),
+FONT_RANK_AFTER(7X10, 96, 95), FONT_RANK_AFTER(7X10, 97, 96), FONT_RANK_AFTER(7X10, 98, 97),
+FONT_RANK_AFTER(7X10, 99, 98), FONT_RANK_AFTER(7X10, 100, 99), FONT_RANK_AFTER(7X10, 101, 100),
+FONT_RANK_AFTER(7X10, 102, 101), FONT_RANK_AFTER(7X10, 103, 102), FONT_RANK_AFTER(7X10, 104, 103),
+FONT_RANK_AFTER(7X10, 105, 104), FONT_RANK_AFTER(7X10, 106, 105), FONT_RANK_AFTER(7X10, 107, 106),
+FONT_RANK_AFTER(7X10, 108, 107), FONT_RANK_AFTER(7X10, 109, 108), FONT_RANK_AFTER(7X10, 110, 109),
+FONT_RANK_AFTER(7X10, 111, 110), FONT_RANK_AFTER(7X10, 112, 111), FONT_RANK_AFTER(7X10, 113, 112),
+FONT_RANK_AFTER(7X10, 114, 113), FONT_RANK_AFTER(7X10, 115, 114), FONT_RANK_AFTER(7X10, 116, 115),
+FONT_RANK_AFTER(7X10, 117, 116), FONT_RANK_AFTER(7X10, 118, 117), FONT_RANK_AFTER(7X10, 119, 118),
+FONT_RANK_AFTER(7X10, 120, 119), FONT_RANK_AFTER(7X10, 121, 120), FONT_RANK_AFTER(7X10, 122, 121),
+FONT_RANK_AFTER(7X10, 123, 122), FONT_RANK_AFTER(7X10, 124, 123), FONT_RANK_AFTER(7X10, 125, 124),
+FONT_RANK_AFTER(7X10, 126, 125),
+};
+
+/**
+ * Index of each glyph of 7x10 font in fontcols_7x10.
+ */
+static const uint8_t fontindex_7x10 [] = {
+FONT_RANK(7X10, 32), FONT_RANK(7X10, 33), FONT_RANK(7X10, 34), FONT_RANK(7X10, 35), FONT_RANK(7X10, 36), FONT_RANK(7X10, 37),
+FONT_RANK(7X10, 38), FONT_RANK(7X10, 39), FONT_RANK(7X10, 40), FONT_RANK(7X10, 41), FONT_RANK(7X10, 42), FONT_RANK(7X10, 43),
+FONT_RANK(7X10, 44), FONT_RANK(7X10, 45), FONT_RANK(7X10, 46), FONT_RANK(7X10, 47), FONT_RANK(7X10, 48), FONT_RANK(7X10, 49),
+FONT_RANK(7X10, 50), FONT_RANK(7X10, 51), FONT_RANK(7X10, 52), FONT_RANK(7X10, 53), FONT_RANK(7X10, 54), FONT_RANK(7X10, 55),
+FONT_RANK(7X10, 56), FONT_RANK(7X10, 57), FONT_RANK(7X10, 58), FONT_RANK(7X10, 59), FONT_RANK(7X10, 60), FONT_RANK(7X10, 61),
+FONT_RANK(7X10, 62), FONT_RANK(7X10, 63), FONT_RANK(7X10, 64), FONT_RANK(7X10, 65), FONT_RANK(7X10, 66), FONT_RANK(7X10, 67),
+FONT_RANK(7X10, 68), FONT_RANK(7X10, 69), FONT_RANK(7X10, 70), FONT_RANK(7X10, 71), FONT_RANK(7X10, 72), FONT_RANK(7X10, 73),
+FONT_RANK(7X10, 74), FONT_RANK(7X10, 75), FONT_RANK(7X10, 76), FONT_RANK(7X10, 77), FONT_RANK(7X10, 78), FONT_RANK(7X10, 79),
+FONT_RANK(7X10, 80), FONT_RANK(7X10, 81), FONT_RANK(7X10, 82), FONT_RANK(7X10, 83), FONT_RANK(7X10, 84), FONT_RANK(7X10, 85),
+FONT_RANK(7X10, 86), FONT_RANK(7X10, 87), FONT_RANK(7X10, 88), FONT_RANK(7X10, 89), FONT_RANK(7X10, 90), FONT_RANK(7X10, 91),
+FONT_RANK(7X10, 92), FONT_RANK(7X10, 93), FONT_RANK(7X10, 94), FONT_RANK(7X10, 95), FONT_RANK(7X10, 96), FONT_RANK(7X10, 97),
+FONT_RANK(7X10, 98), FONT_RANK(7X10, 99), FONT_RANK(7X10, 100), FONT_RANK(7X10, 101), FONT_RANK(7X10, 102), FONT_RANK(7X10, 103),
+FONT_RANK(7X10, 104), FONT_RANK(7X10, 105), FONT_RANK(7X10, 106), FONT_RANK(7X10, 107), FONT_RANK(7X10, 108), FONT_RANK(7X10, 109),
+FONT_RANK(7X10, 110), FONT_RANK(7X10, 111), FONT_RANK(7X10, 112), FONT_RANK(7X10, 113), FONT_RANK(7X10, 114), FONT_RANK(7X10, 115),
+FONT_RANK(7X10, 116), FONT_RANK(7X10, 117), FONT_RANK(7X10, 118), FONT_RANK(7X10, 119), FONT_RANK(7X10, 120), FONT_RANK(7X10, 121),
+FONT_RANK(7X10, 122), FONT_RANK(7X10, 123), FONT_RANK(7X10, 124), FONT_RANK(7X10, 125), FONT_RANK(7X10, 126),
+};
+
+#define FONT_7X10_INDEX fontindex_7x10
+
+#else
+#define SSD1306_FONT_7X10_GLYPHS(c) 1
+#define FONT_7X10_INDEX NULL
+#endif
+
+/**
+ * Column-major encoding for 7x10 font, generated from fontmap_7x10.
+ * Each glyph is made of 2 page(s) of 7 bytes.
+ */
+static const uint8_t fontcols_7x10 [] = {
+#if FONT_HAS(7X10, 32)
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // sp
+#endif
+#if FONT_HAS(7X10, 33)
+0x00, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // '!'
+#endif
+#if FONT_HAS(7X10, 34)
+0x00, 0x00, 0x07, 0x00, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // '"'
+#endif
+#if FONT_HAS(7X10, 35)
+0x00, 0xF4, 0x2F, 0x24, 0xF4, 0x2F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // '#'
+#endif
+#if FONT_HAS(7X10, 36)
+0x00, 0x66, 0x89, 0xFF, 0x89, 0x72, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,  // '$'
+#endif
+#if FONT_HAS(7X10, 37)
+0x00, 0x26, 0x19, 0x6E, 0x94, 0x62, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // '%'
+#endif
+#if FONT_HAS(7X10, 38)
+0x00, 0x60, 0x96, 0x99, 0x66, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // '&'
+#endif
+#if FONT_HAS(7X10, 39)
+0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // '''
+#endif
+#if FONT_HAS(7X10, 40)
+0x00, 0x00, 0xFC, 0x02, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x02, 0x00, 0x00,  // '('
+#endif
+#if FONT_HAS(7X10, 41)
+0x00, 0x00, 0x01, 0x02, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x02, 0x01, 0x00, 0x00, 0x00,  // ')'
+#endif
+#if FONT_HAS(7X10, 42)
+0x00, 0x00, 0x0A, 0x07, 0x0A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // '*'
+#endif
+#if FONT_HAS(7X10, 43)
+0x00, 0x10, 0x10, 0x7C, 0x10, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // '+'
+#endif
+#if FONT_HAS(7X10, 44)
+0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00,  // ','
+#endif
+#if FONT_HAS(7X10, 45)
+0x00, 0x00, 0x20, 0x20, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // '-'
+#endif
+#if FONT_HAS(7X10, 46)
+0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // '.'
+#endif
+#if FONT_HAS(7X10, 47)
+0x00, 0x00, 0xC0, 0x3C, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // '/'
+#endif
+#if FONT_HAS(7X10, 48)
+0x00, 0x7E, 0x81, 0x89, 0x81, 0x7E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // '0'
+#endif
+#if FONT_HAS(7X10, 49)
+0x00, 0x04, 0x02, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // '1'
+#endif
+#if FONT_HAS(7X10, 50)
+0x00, 0x86, 0xC1, 0xA1, 0x91, 0x8E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // '2'
+#endif
+#if FONT_HAS(7X10, 51)
+0x00, 0x42, 0x81, 0x89, 0x89, 0x76, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // '3'
+#endif
+#if FONT_HAS(7X10, 52)
+0x00, 0x30, 0x2C, 0x22, 0xFF, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // '4'
+#endif
+#if FONT_HAS(7X10, 53)
+0x00, 0x4F, 0x89, 0x89, 0x89, 0x71, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // '5'
+#endif
+#if FONT_HAS(7X10, 54)
+0x00, 0x7E, 0x89, 0x89, 0x89, 0x72, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // '6'
+#endif
+#if FONT_HAS(7X10, 55)
+0x00, 0x01, 0xE1, 0x19, 0x05, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // '7'
+#endif
+#if FONT_HAS(7X10, 56)
+0x00, 0x76, 0x89, 0x89, 0x89, 0x76, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // '8'
+#endif
+#if FONT_HAS(7X10, 57)
+0x00, 0x4E, 0x91, 0x91, 0x91, 0x7E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // '9'
+#endif
+#if FONT_HAS(7X10, 58)
+0x00, 0x00, 0x00, 0x84, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // ':'
+#endif
+#if FONT_HAS(7X10, 59)
+0x00, 0x00, 0x00, 0x88, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00,  // ';'
+#endif
+#if FONT_HAS(7X10, 60)
+0x00, 0x10, 0x28, 0x28, 0x44, 0x44, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // '<'
+#endif
+#if FONT_HAS(7X10, 61)
+0x00, 0x28, 0x28, 0x28, 0x28, 0x28, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // '='
+#endif
+#if FONT_HAS(7X10, 62)
+0x00, 0x44, 0x44, 0x28, 0x28, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // '>'
+#endif
+#if FONT_HAS(7X10, 63)
+0x00, 0x02, 0x01, 0xB1, 0x09, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // '?'
+#endif
+#if FONT_HAS(7X10, 64)
+0x00, 0x7E, 0x81, 0x99, 0x95, 0x1E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // '@'
+#endif
+#if FONT_HAS(7X10, 65)
+0x00, 0xE0, 0x3E, 0x21, 0x3E, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // 'A'
+#endif
+#if FONT_HAS(7X10, 66)
+0x00, 0xFF, 0x89, 0x89, 0x89, 0x76, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // 'B'
+#endif
+#if FONT_HAS(7X10, 67)
+0x00, 0x7E, 0x81, 0x81, 0x81, 0x42, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // 'C'
+#endif
+#if FONT_HAS(7X10, 68)
+0x00, 0xFF, 0x81, 0x81, 0x42, 0x3C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // 'D'
+#endif
+#if FONT_HAS(7X10, 69)
+0x00, 0xFF, 0x89, 0x89, 0x89, 0x89, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // 'E'
+#endif
+#if FONT_HAS(7X10, 70)
+0x00, 0xFF, 0x09, 0x09, 0x09, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // 'F'
+#endif
+#if FONT_HAS(7X10, 71)
+0x00, 0x7E, 0x81, 0x91, 0x91, 0x72, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // 'G'
+#endif
+#if FONT_HAS(7X10, 72)
+0x00, 0xFF, 0x08, 0x08, 0x08, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // 'H'
+#endif
+#if FONT_HAS(7X10, 73)
+0x00, 0x00, 0x81, 0xFF, 0x81, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // 'I'
+#endif
+#if FONT_HAS(7X10, 74)
+0x00, 0x40, 0x80, 0x80, 0x80, 0x7F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // 'J'
+#endif
+#if FONT_HAS(7X10, 75)
+0x00, 0xFF, 0x08, 0x14, 0x62, 0x81, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // 'K'
+#endif
+#if FONT_HAS(7X10, 76)
+0x00, 0xFF, 0x80, 0x80, 0x80, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // 'L'
+#endif
+#if FONT_HAS(7X10, 77)
+0x00, 0xFF, 0x06, 0x08, 0x06, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // 'M'
+#endif
+#if FONT_HAS(7X10, 78)
+0x00, 0xFF, 0x06, 0x18, 0x60, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // 'N'
+#endif
+#if FONT_HAS(7X10, 79)
+0x00, 0x7E, 0x81, 0x81, 0x81, 0x7E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // 'O'
+#endif
+#if FONT_HAS(7X10, 80)
+0x00, 0xFF, 0x11, 0x11, 0x11, 0x0E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // 'P'
+#endif
+#if FONT_HAS(7X10, 81)
+0x00, 0x7E, 0x81, 0xC1, 0x81, 0x7E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00,  // 'Q'
+#endif
+#if FONT_HAS(7X10, 82)
+0x00, 0xFF, 0x11, 0x11, 0x71, 0x8E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // 'R'
+#endif
+#if FONT_HAS(7X10, 83)
+0x00, 0x46, 0x89, 0x89, 0x91, 0x62, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // 'S'
+#endif
+#if FONT_HAS(7X10, 84)
+0x00, 0x01, 0x01, 0xFF, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // 'T'
+#endif
+#if FONT_HAS(7X10, 85)
+0x00, 0x7F, 0x80, 0x80, 0x80, 0x7F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // 'U'
+#endif
+#if FONT_HAS(7X10, 86)
+0x00, 0x07, 0x38, 0xC0, 0x38, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // 'V'
+#endif
+#if FONT_HAS(7X10, 87)
+0x00, 0x3F, 0xE0, 0x1C, 0xE0, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // 'W'
+#endif
+#if FONT_HAS(7X10, 88)
+0x00, 0x81, 0x66, 0x18, 0x66, 0x81, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // 'X'
+#endif
+#if FONT_HAS(7X10, 89)
+0x00, 0x03, 0x0C, 0xF0, 0x0C, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // 'Y'
+#endif
+#if FONT_HAS(7X10, 90)
+0x00, 0xC1, 0xA1, 0x99, 0x85, 0x83, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // 'Z'
+#endif
+#if FONT_HAS(7X10, 91)
+0x00, 0x00, 0x00, 0xFF, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x02, 0x00, 0x00,  // '['
+#endif
+#if FONT_HAS(7X10, 92)
+0x00, 0x00, 0x03, 0x3C, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // '\'
+#endif
+#if FONT_HAS(7X10, 93)
+0x00, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x03, 0x00, 0x00, 0x00,  // ']'
+#endif
+#if FONT_HAS(7X10, 94)
+0x00, 0x08, 0x06, 0x01, 0x06, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // '^'
+#endif
+#if FONT_HAS(7X10, 95)
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,  // '_'
+#endif
+#if FONT_HAS(7X10, 96)
+0x00, 0x00, 0x01, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // '`'
+#endif
+#if FONT_HAS(7X10, 97)
+0x00, 0x68, 0x94, 0x94, 0x54, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // 'a'
+#endif
+#if FONT_HAS(7X10, 98)
+0x00, 0xFF, 0x48, 0x84, 0x84, 0x78, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // 'b'
+#endif
+#if FONT_HAS(7X10, 99)
+0x00, 0x78, 0x84, 0x84, 0x84, 0x48, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // 'c'
+#endif
+#if FONT_HAS(7X10, 100)
+0x00, 0x78, 0x84, 0x84, 0x48, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // 'd'
+#endif
+#if FONT_HAS(7X10, 101)
+0x00, 0x78, 0x94, 0x94, 0x94, 0x58, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // 'e'
+#endif
+#if FONT_HAS(7X10, 102)
+0x00, 0x04, 0x04, 0xFE, 0x05, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // 'f'
+#endif
+#if FONT_HAS(7X10, 103)
+0x00, 0x78, 0x84, 0x84, 0x48, 0xFC, 0x00, 0x00, 0x02, 0x02, 0x02, 0x02, 0x01, 0x00,  // 'g'
+#endif
+#if FONT_HAS(7X10, 104)
+0x00, 0xFF, 0x08, 0x04, 0x04, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // 'h'
+#endif
+#if FONT_HAS(7X10, 105)
+0x00, 0x04, 0x04, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // 'i'
+#endif
+#if FONT_HAS(7X10, 106)
+0x00, 0x04, 0x04, 0xFD, 0x00, 0x00, 0x00, 0x02, 0x02, 0x02, 0x01, 0x00, 0x00, 0x00,  // 'j'
+#endif
+#if FONT_HAS(7X10, 107)
+0x00, 0xFF, 0x10, 0x28, 0x44, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // 'k'
+#endif
+#if FONT_HAS(7X10, 108)
+0x00, 0x01, 0x01, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // 'l'
+#endif
+#if FONT_HAS(7X10, 109)
+0x00, 0xFC, 0x04, 0xFC, 0x04, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // 'm'
+#endif
+#if FONT_HAS(7X10, 110)
+0x00, 0xFC, 0x08, 0x04, 0x04, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // 'n'
+#endif
+#if FONT_HAS(7X10, 111)
+0x00, 0x78, 0x84, 0x84, 0x84, 0x78, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // 'o'
+#endif
+#if FONT_HAS(7X10, 112)
+0x00, 0xFC, 0x48, 0x84, 0x84, 0x78, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00,  // 'p'
+#endif
+#if FONT_HAS(7X10, 113)
+0x00, 0x78, 0x84, 0x84, 0x48, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00,  // 'q'
+#endif
+#if FONT_HAS(7X10, 114)
+0x00, 0xFC, 0x08, 0x04, 0x04, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // 'r'
+#endif
+#if FONT_HAS(7X10, 115)
+0x00, 0x48, 0x94, 0x94, 0xA4, 0x48, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // 's'
+#endif
+#if FONT_HAS(7X10, 116)
+0x00, 0x04, 0x7F, 0x84, 0x84, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // 't'
+#endif
+#if FONT_HAS(7X10, 117)
+0x00, 0x7C, 0x80, 0x80, 0x40, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // 'u'
+#endif
+#if FONT_HAS(7X10, 118)
+0x00, 0x0C, 0x70, 0x80, 0x70, 0x0C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // 'v'
+#endif
+#if FONT_HAS(7X10, 119)
+0x00, 0x3C, 0xE0, 0x1C, 0xE0, 0x3C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // 'w'
+#endif
+#if FONT_HAS(7X10, 120)
+0x00, 0x84, 0x48, 0x30, 0x48, 0x84, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // 'x'
+#endif
+#if FONT_HAS(7X10, 121)
+0x00, 0x0C, 0x30, 0xC0, 0x30, 0x0C, 0x00, 0x00, 0x02, 0x02, 0x01, 0x00, 0x00, 0x00,  // 'y'
+#endif
+#if FONT_HAS(7X10, 122)
+0x00, 0xC4, 0xA4, 0x94, 0x8C, 0x84, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // 'z'
+#endif
+#if FONT_HAS(7X10, 123)
+0x00, 0x00, 0x30, 0xCF, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x02, 0x00, 0x00,  // '{'
+#endif
+#if FONT_HAS(7X10, 124)
+0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00,  // '|'
+#endif
+#if FONT_HAS(7X10, 125)
+0x00, 0x00, 0x01, 0xCF, 0x30, 0x00, 0x00, 0x00, 0x00, 0x02, 0x03, 0x00, 0x00, 0x00,  // '}'
+#endif
+#if FONT_HAS(7X10, 126)
+0x00, 0x18, 0x08, 0x08, 0x10, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // '~'
+#endif
+};
+
+#ifdef ENABLE_FONT_11X18
+
+#ifdef SSD1306_FONT_11X18_GLYPHS
+
+enum {
+FONT_11X18_RANK_32 = 0,
+FONT_RANK_AFTER(11X18, 33, 32), FONT_RANK_AFTER(11X18, 34, 33), FONT_RANK_AFTER(11X18, 35, 34),
+FONT_RANK_AFTER(11X18, 36, 35), FONT_RANK_AFTER(11X18, 37, 36), FONT_RANK_AFTER(11X18, 38, 37),
+FONT_RANK_AFTER(11X18, 39, 38), FONT_RANK_AFTER(11X18, 40, 39), FONT_RANK_AFTER(11X18, 41, 40),
+FONT_RANK_AFTER(11X18, 42, 41), FONT_RANK_AFTER(11X18, 43, 42), FONT_RANK_AFTER(11X18, 44, 43),
+FONT_RANK_AFTER(11X18, 45, 44), FONT_RANK_AFTER(11X18, 46, 45), FONT_RANK_AFTER(11X18, 47, 46),
+FONT_RANK_AFTER(11X18, 48, 47), FONT_RANK_AFTER(11X18, 49, 48), FONT_RANK_AFTER(11X18, 50, 49),
+FONT_RANK_AFTER(11X18, 51, 50), FONT_RANK_AFTER(11X18, 52, 51), FONT_RANK_AFTER(11X18, 53, 52),
+FONT_RANK_AFTER(11X18, 54, 53), FONT_RANK_AFTER(11X18, 55, 54), FONT_RANK_AFTER(11X18, 56, 55),
+FONT_RANK_AFTER(11X18, 57, 56), FONT_RANK_AFTER(11X18, 58, 57), FONT_RANK_AFTER(11X18, 59, 58),
+FONT_RANK_AFTER(11X18, 60, 59), FONT_RANK_AFTER(11X18, 61, 60), FONT_RANK_AFTER(11X18, 62, 61),
+FONT_RANK_AFTER(11X18, 63, 62), FONT_RANK_AFTER(11X18, 64, 63), FONT_RANK_AFTER(11X18, 65, 64),
+FONT_RANK_AFTER(11X18, 66, 65), FONT_RANK_AFTER(11X18, 67, 66), FONT_RANK_AFTER(11X18, 68, 67),
+FONT_RANK_AFTER(11X18, 69, 68), FONT_RANK_AFTER(11X18, 70, 69), FONT_RANK_AFTER(11X18, 71, 70),
+FONT_RANK_AFTER(11X18, 72, 71), FONT_RANK_AFTER(11X18, 73, 72), FONT_RANK_AFTER(11X18, 74, 73),
+FONT_RANK_AFTER(11X18, 75, 74), FONT_RANK_AFTER(11X18, 76, 75), FONT_RANK_AFTER(11X18, 77, 76),
+FONT_RANK_AFTER(11X18, 78, 77), FONT_RANK_AFTER(11X18, 79, 78), FONT_RANK_AFTER(11X18, 80, 79),
+FONT_RANK_AFTER(11X18, 81, 80), FONT_RANK_AFTER(11X18, 82, 81), FONT_RANK_AFTER(11X18, 83, 82),
+FONT_RANK_AFTER(11X18, 84, 83), FONT_RANK_AFTER(11X18, 85, 84), FONT_RANK_AFTER(11X18, 86, 85),
+FONT_RANK_AFTER(11X18, 87, 86), FONT_RANK_AFTER(11X18, 88, 87), FONT_RANK_AFTER(11X18, 89, 88),
+FONT_RANK_AFTER(11X18, 90, 89), FONT_RANK_AFTER(11X18, 91, 90), FONT_RANK_AFTER(11X18, 92, 91),
+FONT_RANK_AFTER(11X18, 93, 92), FONT_RANK_AFTER(11X18, 94, 93), FONT_RANK_AFTER(11X18, 95, 94),
+FONT_RANK_AFTER(11X18, 96, 95), FONT_RANK_AFTER(11X18, 97, 96), FONT_RANK_AFTER(11X18, 98, 97),
+FONT_RANK_AFTER(11X18, 99, 98), FONT_RANK_AFTER(11X18, 100, 99), FONT_RANK_AFTER(11X18, 101, 100),
+FONT_RANK_AFTER(11X18, 102, 101), FONT_RANK_AFTER(11X18, 103, 102), FONT_RANK_AFTER(11X18, 104, 103),
+FONT_RANK_AFTER(11X18, 105, 104), FONT_RANK_AFTER(11X18, 106, 105), FONT_RANK_AFTER(11X18, 107, 106),
+FONT_RANK_AFTER(11X18, 108, 107), FONT_RANK_AFTER(11X18, 109, 108), FONT_RANK_AFTER(11X18, 110, 109),
+FONT_RANK_AFTER(11X18, 111, 110), FONT_RANK_AFTER(11X18, 112, 111), FONT_RANK_AFTER(11X18, 113, 112),
+FONT_RANK_AFTER(11X18, 114, 113), FONT_RANK_AFTER(11X18, 115, 114), FONT_RANK_AFTER(11X18, 116, 115),
+FONT_RANK_AFTER(11X18, 117, 116), FONT_RANK_AFTER(11X18, 118, 117), FONT_RANK_AFTER(11X18, 119, 118),
+FONT_RANK_AFTER(11X18, 120, 119), FONT_RANK_AFTER(11X18, 121, 120), FONT_RANK_AFTER(11X18, 122, 121),
+FONT_RANK_AFTER(11X18, 123, 122), FONT_RANK_AFTER(11X18, 124, 123), FONT_RANK_AFTER(11X18, 125, 124),
+FONT_RANK_AFTER(11X18, 126, 125),
+};
+
+/**
+ * Index of each glyph of 11x18 font in fontcols_11x18.
+ */
+static const uint8_t fontindex_11x18 [] = {
+FONT_RANK(11X18, 32), FONT_RANK(11X18, 33), FONT_RANK(11X18, 34), FONT_RANK(11X18, 35), FONT_RANK(11X18, 36), FONT_RANK(11X18, 37),
+FONT_RANK(11X18, 38), FONT_RANK(11X18, 39), FONT_RANK(11X18, 40), FONT_RANK(11X18, 41), FONT_RANK(11X18, 42), FONT_RANK(11X18, 43),
+FONT_RANK(11X18, 44), FONT_RANK(11X18, 45), FONT_RANK(11X18, 46), FONT_RANK(11X18, 47), FONT_RANK(11X18, 48), FONT_RANK(11X18, 49),
+FONT_RANK(11X18, 50), FONT_RANK(11X18, 51), FONT_RANK(11X18, 52), FONT_RANK(11X18, 53), FONT_RANK(11X18, 54), FONT_RANK(11X18, 55),
+FONT_RANK(11X18, 56), FONT_RANK(11X18, 57), FONT_RANK(11X18, 58), FONT_RANK(11X18, 59), FONT_RANK(11X18, 60), FONT_RANK(11X18, 61),
+FONT_RANK(11X18, 62), FONT_RANK(11X18, 63), FONT_RANK(11X18, 64), FONT_RANK(11X18, 65), FONT_RANK(11X18, 66), FONT_RANK(11X18, 67),
+FONT_RANK(11X18, 68), FONT_RANK(11X18, 69), FONT_RANK(11X18, 70), FONT_RANK(11X18, 71), FONT_RANK(11X18, 72), FONT_RANK(11X18, 73),
+FONT_RANK(11X18, 74), FONT_RANK(11X18, 75), FONT_RANK(11X18, 76), FONT_RANK(11X18, 77), FONT_RANK(11X18, 78), FONT_RANK(11X18, 79),
+FONT_RANK(11X18, 80), FONT_RANK(11X18, 81), FONT_RANK(11X18, 82), FONT_RANK(11X18, 83), FONT_RANK(11X18, 84), FONT_RANK(11X18, 85),
+FONT_RANK(11X18, 86), FONT_RANK(11X18, 87), FONT_RANK(11X18, 88), FONT_RANK(11X18, 89), FONT_RANK(11X18, 90), FONT_RANK(11X18, 91),
+FONT_RANK(11X18, 92), FONT_RANK(11X18, 93), FONT_RANK(11X18, 94), FONT_RANK(11X18, 95), FONT_RANK(11X18, 96), FONT_RANK(11X18, 97),
+FONT_RANK(11X18, 98), FONT_RANK(11X18, 99), FONT_RANK(11X18, 100), FONT_RANK(11X18, 101), FONT_RANK(11X18, 102), FONT_RANK(11X18, 103),
+FONT_RANK(11X18, 104), FONT_RANK(11X18, 105), FONT_RANK(11X18, 106), FONT_RANK(11X18, 107), FONT_RANK(11X18, 108), FONT_RANK(11X18, 109),
+FONT_RANK(11X18, 110), FONT_RANK(11X18, 111), FONT_RANK(11X18, 112), FONT_RANK(11X18, 113), FONT_RANK(11X18, 114), FONT_RANK(11X18, 115),
+FONT_RANK(11X18, 116), FONT_RANK(11X18, 117), FONT_RANK(11X18, 118), FONT_RANK(11X18, 119), FONT_RANK(11X18, 120), FONT_RANK(11X18, 121),
+FONT_RANK(11X18, 122), FONT_RANK(11X18, 123), FONT_RANK(11X18, 124), FONT_RANK(11X18, 125), FONT_RANK(11X18, 126),
+};
+
+#define FONT_11X18_INDEX fontindex_11x18
+
+#else
+#define SSD1306_FONT_11X18_GLYPHS(c) 1
+#define FONT_11X18_INDEX NULL
+#endif
+
+/**
+ * Column-major encoding for 11x18 font, generated from fontmap_11x18.
+ * Each glyph is made of 3 page(s) of 11 bytes.
+ */
+static const uint8_t fontcols_11x18 [] = {
+#if FONT_HAS(11X18, 32)
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // sp
+#endif
+#if FONT_HAS(11X18, 33)
+0x00, 0x00, 0x00, 0x00, 0xFE, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6F, 0x6F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // '!'
+#endif
+#if FONT_HAS(11X18, 34)
+0x00, 0x00, 0x00, 0x3E, 0x3E, 0x00, 0x3E, 0x3E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // '"'
+#endif
+#if FONT_HAS(11X18, 35)
+0x00, 0x60, 0x60, 0xFE, 0xFE, 0x60, 0x60, 0xFE, 0xFE, 0x60, 0x00, 0x00, 0x06, 0x7F, 0x7F, 0x06, 0x06, 0x7F, 0x7F, 0x06, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // '#'
+#endif
+#if FONT_HAS(11X18, 36)
+0x00, 0x38, 0x7C, 0xEE, 0xC6, 0xFE, 0x86, 0x1C, 0x18, 0x00, 0x00, 0x00, 0x1C, 0x3C, 0x70, 0x60, 0xFF, 0x61, 0x3F, 0x1E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00,  // '$'
+#endif
+#if FONT_HAS(11X18, 37)
+0x3C, 0x7E, 0x42, 0x7E, 0x3C, 0x80, 0xC0, 0x60, 0x30, 0x18, 0x00, 0x00, 0x18, 0x0C, 0x06, 0x03, 0x3D, 0x7E, 0x42, 0x7E, 0x3C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // '%'
+#endif
+#if FONT_HAS(11X18, 38)
+0x00, 0x00, 0x3C, 0x7E, 0xC6, 0xC6, 0x7E, 0x3C, 0x00, 0x00, 0x00, 0x00, 0x1E, 0x3F, 0x61, 0x61, 0x63, 0x36, 0x1C, 0x7F, 0x23, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // '&'
+#endif
+#if FONT_HAS(11X18, 39)
+0x00, 0x00, 0x00, 0x00, 0x3E, 0x3E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // '''
+#endif
+#if FONT_HAS(11X18, 40)
+0x00, 0x00, 0x00, 0x00, 0xC0, 0xF8, 0x1C, 0x06, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x7F, 0xE0, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x02, 0x00, 0x00,  // '('
+#endif
+#if FONT_HAS(11X18, 41)
+0x00, 0x00, 0x01, 0x06, 0x1C, 0xF8, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0xE0, 0x7F, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // ')'
+#endif
+#if FONT_HAS(11X18, 42)
+0x00, 0x00, 0x2C, 0x38, 0x1E, 0x1E, 0x38, 0x2C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // '*'
+#endif
+#if FONT_HAS(11X18, 43)
+0x80, 0x80, 0x80, 0x80, 0xF8, 0xF8, 0x80, 0x80, 0x80, 0x80, 0x00, 0x01, 0x01, 0x01, 0x01, 0x1F, 0x1F, 0x01, 0x01, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // '+'
+#endif
+#if FONT_HAS(11X18, 44)
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x60, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00,  // ','
+#endif
+#if FONT_HAS(11X18, 45)
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x06, 0x06, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // '-'
+#endif
+#if FONT_HAS(11X18, 46)
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x60, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // '.'
+#endif
+#if FONT_HAS(11X18, 47)
+0x00, 0x00, 0x00, 0x00, 0x00, 0xF0, 0xFE, 0x0E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x70, 0x7F, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // '/'
+#endif
+#if FONT_HAS(11X18, 48)
+0x00, 0xF0, 0xFC, 0x0E, 0x86, 0x86, 0x0E, 0xFC, 0xF0, 0x00, 0x00, 0x00, 0x0F, 0x3F, 0x70, 0x61, 0x61, 0x70, 0x3F, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // '0'
+#endif
+#if FONT_HAS(11X18, 49)
+0x00, 0x00, 0x30, 0x18, 0x0C, 0xFE, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x7F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // '1'
+#endif
+#if FONT_HAS(11X18, 50)
+0x00, 0x38, 0x3C, 0x0E, 0x06, 0x06, 0x8E, 0xFC, 0x78, 0x00, 0x00, 0x00, 0x70, 0x78, 0x6C, 0x66, 0x63, 0x61, 0x60, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // '2'
+#endif
+#if FONT_HAS(11X18, 51)
+0x00, 0x18, 0x1C, 0x06, 0xC6, 0xC6, 0xFC, 0x38, 0x00, 0x00, 0x00, 0x00, 0x18, 0x38, 0x70, 0x60, 0x60, 0x71, 0x3F, 0x1E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // '3'
+#endif
+#if FONT_HAS(11X18, 52)
+0x00, 0x00, 0x80, 0xF0, 0x3C, 0xFE, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0E, 0x0F, 0x0D, 0x0C, 0x7F, 0x7F, 0x0C, 0x0C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // '4'
+#endif
+#if FONT_HAS(11X18, 53)
+0x00, 0xFE, 0xFE, 0x86, 0xC6, 0xC6, 0xC6, 0x86, 0x00, 0x00, 0x00, 0x00, 0x19, 0x39, 0x70, 0x60, 0x60, 0x71, 0x3F, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // '5'
+#endif
+#if FONT_HAS(11X18, 54)
+0x00, 0xF0, 0xFC, 0x8E, 0xC6, 0xC6, 0xCE, 0x9C, 0x18, 0x00, 0x00, 0x00, 0x0F, 0x3F, 0x71, 0x60, 0x60, 0x71, 0x3F, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // '6'
+#endif
+#if FONT_HAS(11X18, 55)
+0x00, 0x06, 0x06, 0x06, 0x06, 0xC6, 0xF6, 0x3E, 0x0E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x70, 0x7F, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // '7'
+#endif
+#if FONT_HAS(11X18, 56)
+0x00, 0x38, 0x7C, 0x86, 0x86, 0x86, 0x8E, 0x7C, 0x38, 0x00, 0x00, 0x00, 0x1E, 0x3F, 0x61, 0x61, 0x61, 0x61, 0x3F, 0x1E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // '8'
+#endif
+#if FONT_HAS(11X18, 57)
+0x00, 0xF8, 0xFC, 0x8E, 0x06, 0x06, 0x8E, 0xFC, 0xF0, 0x00, 0x00, 0x00, 0x18, 0x39, 0x73, 0x63, 0x63, 0x71, 0x3F, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // '9'
+#endif
+#if FONT_HAS(11X18, 58)
+0x00, 0x00, 0x00, 0x00, 0x60, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x60, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // ':'
+#endif
+#if FONT_HAS(11X18, 59)
+0x00, 0x00, 0x00, 0x00, 0xC0, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x60, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00,  // ';'
+#endif
+#if FONT_HAS(11X18, 60)
+0x00, 0x00, 0x80, 0x80, 0xC0, 0x40, 0x60, 0x20, 0x30, 0x00, 0x00, 0x00, 0x01, 0x03, 0x02, 0x06, 0x04, 0x0C, 0x08, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // '<'
+#endif
+#if FONT_HAS(11X18, 61)
+0x00, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x00, 0x00, 0x00, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // '='
+#endif
+#if FONT_HAS(11X18, 62)
+0x00, 0x30, 0x20, 0x60, 0x40, 0xC0, 0x80, 0x80, 0x00, 0x00, 0x00, 0x00, 0x18, 0x08, 0x0C, 0x04, 0x06, 0x02, 0x03, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // '>'
+#endif
+#if FONT_HAS(11X18, 63)
+0x00, 0x18, 0x1C, 0x0E, 0x06, 0x06, 0x86, 0xCE, 0xFC, 0x78, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6E, 0x6F, 0x03, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // '?'
+#endif
+#if FONT_HAS(11X18, 64)
+0x00, 0xF0, 0xFC, 0x1E, 0xC6, 0xC6, 0x66, 0xFC, 0xF8, 0x00, 0x00, 0x00, 0x0F, 0x3F, 0x70, 0x63, 0x67, 0x36, 0x07, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // '@'
+#endif
+#if FONT_HAS(11X18, 65)
+0x00, 0x00, 0x80, 0xF8, 0x7E, 0x06, 0x7E, 0xF8, 0x80, 0x00, 0x00, 0x00, 0x70, 0x7F, 0x0F, 0x06, 0x06, 0x06, 0x0F, 0x7F, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // 'A'
+#endif
+#if FONT_HAS(11X18, 66)
+0x00, 0xFE, 0xFE, 0x86, 0x86, 0x86, 0xFC, 0x78, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x7F, 0x61, 0x61, 0x61, 0x73, 0x3E, 0x1C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // 'B'
+#endif
+#if FONT_HAS(11X18, 67)
+0x00, 0xF0, 0xFC, 0x0E, 0x06, 0x06, 0x06, 0x1C, 0x18, 0x00, 0x00, 0x00, 0x0F, 0x3F, 0x70, 0x60, 0x60, 0x60, 0x38, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // 'C'
+#endif
+#if FONT_HAS(11X18, 68)
+0x00, 0xFE, 0xFE, 0x06, 0x06, 0x06, 0x1C, 0xFC, 0xF0, 0x00, 0x00, 0x00, 0x7F, 0x7F, 0x60, 0x60, 0x60, 0x38, 0x1F, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // 'D'
+#endif
+#if FONT_HAS(11X18, 69)
+0x00, 0xFE, 0xFE, 0x86, 0x86, 0x86, 0x86, 0x86, 0x06, 0x00, 0x00, 0x00, 0x7F, 0x7F, 0x61, 0x61, 0x61, 0x61, 0x61, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // 'E'
+#endif
+#if FONT_HAS(11X18, 70)
+0x00, 0xFE, 0xFE, 0x86, 0x86, 0x86, 0x86, 0x86, 0x06, 0x00, 0x00, 0x00, 0x7F, 0x7F, 0x01, 0x01, 0x01, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // 'F'
+#endif
+#if FONT_HAS(11X18, 71)
+0x00, 0xF0, 0xFC, 0x0E, 0x06, 0x06, 0x06, 0x1C, 0x18, 0x00, 0x00, 0x00, 0x0F, 0x3F, 0x70, 0x60, 0x60, 0x63, 0x3F, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // 'G'
+#endif
+#if FONT_HAS(11X18, 72)
+0x00, 0xFE, 0xFE, 0x80, 0x80, 0x80, 0x80, 0xFE, 0xFE, 0x00, 0x00, 0x00, 0x7F, 0x7F, 0x01, 0x01, 0x01, 0x01, 0x7F, 0x7F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // 'H'
+#endif
+#if FONT_HAS(11X18, 73)
+0x00, 0x00, 0x06, 0x06, 0xFE, 0xFE, 0x06, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x60, 0x60, 0x7F, 0x7F, 0x60, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // 'I'
+#endif
+#if FONT_HAS(11X18, 74)
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFE, 0xFE, 0x00, 0x00, 0x00, 0x1C, 0x3C, 0x70, 0x60, 0x60, 0x70, 0x3F, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // 'J'
+#endif
+#if FONT_HAS(11X18, 75)
+0x00, 0xFE, 0xFE, 0x80, 0xC0, 0x70, 0x38, 0x0C, 0x06, 0x02, 0x00, 0x00, 0x7F, 0x7F, 0x01, 0x01, 0x07, 0x0E, 0x38, 0x70, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // 'K'
+#endif
+#if FONT_HAS(11X18, 76)
+0x00, 0xFE, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x7F, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // 'L'
+#endif
+#if FONT_HAS(11X18, 77)
+0x00, 0xFE, 0xFE, 0x1E, 0xF8, 0x80, 0xF8, 0x0E, 0xFE, 0xFE, 0x00, 0x00, 0x7F, 0x7F, 0x00, 0x00, 0x01, 0x00, 0x00, 0x7F, 0x7F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // 'M'
+#endif
+#if FONT_HAS(11X18, 78)
+0x00, 0xFE, 0xFE, 0x3E, 0xF8, 0xC0, 0x00, 0xFE, 0xFE, 0x00, 0x00, 0x00, 0x7F, 0x7F, 0x00, 0x01, 0x1F, 0x7C, 0x7F, 0x7F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // 'N'
+#endif
+#if FONT_HAS(11X18, 79)
+0x00, 0xF0, 0xFC, 0x0E, 0x06, 0x06, 0x0E, 0xFC, 0xF0, 0x00, 0x00, 0x00, 0x0F, 0x3F, 0x70, 0x60, 0x60, 0x70, 0x3F, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // 'O'
+#endif
+#if FONT_HAS(11X18, 80)
+0x00, 0xFE, 0xFE, 0x06, 0x06, 0x06, 0x8E, 0xFC, 0xF8, 0x00, 0x00, 0x00, 0x7F, 0x7F, 0x03, 0x03, 0x03, 0x03, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // 'P'
+#endif
+#if FONT_HAS(11X18, 81)
+0x00, 0xF0, 0xFC, 0x0E, 0x06, 0x06, 0x0E, 0xFC, 0xF0, 0x00, 0x00, 0x00, 0x0F, 0x3F, 0x70, 0x60, 0x6C, 0x78, 0x3F, 0x2F, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // 'Q'
+#endif
+#if FONT_HAS(11X18, 82)
+0x00, 0xFE, 0xFE, 0x86, 0x86, 0x86, 0xCE, 0xFC, 0x78, 0x00, 0x00, 0x00, 0x7F, 0x7F, 0x01, 0x01, 0x03, 0x0F, 0x3C, 0x70, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // 'R'
+#endif
+#if FONT_HAS(11X18, 83)
+0x00, 0x00, 0x78, 0xFC, 0xC6, 0x86, 0x86, 0x1C, 0x18, 0x00, 0x00, 0x00, 0x0C, 0x3C, 0x70, 0x60, 0x61, 0x63, 0x3F, 0x1E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // 'S'
+#endif
+#if FONT_HAS(11X18, 84)
+0x06, 0x06, 0x06, 0x06, 0xFE, 0xFE, 0x06, 0x06, 0x06, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x7F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // 'T'
+#endif
+#if FONT_HAS(11X18, 85)
+0x00, 0xFE, 0xFE, 0x00, 0x00, 0x00, 0x00, 0xFE, 0xFE, 0x00, 0x00, 0x00, 0x1F, 0x3F, 0x70, 0x60, 0x60, 0x70, 0x3F, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // 'U'
+#endif
+#if FONT_HAS(11X18, 86)
+0x00, 0x0E, 0x7E, 0xF0, 0x80, 0x00, 0x80, 0xF0, 0x7E, 0x0E, 0x00, 0x00, 0x00, 0x00, 0x07, 0x3F, 0x78, 0x3F, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // 'V'
+#endif
+#if FONT_HAS(11X18, 87)
+0x7E, 0xFE, 0x00, 0x00, 0xC0, 0xC0, 0x00, 0x00, 0xFE, 0x7E, 0x00, 0x00, 0x7F, 0x70, 0x1E, 0x03, 0x03, 0x1E, 0x70, 0x7F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // 'W'
+#endif
+#if FONT_HAS(11X18, 88)
+0x02, 0x0E, 0x3C, 0x70, 0xE0, 0xC0, 0x70, 0x38, 0x0E, 0x02, 0x00, 0x40, 0x70, 0x38, 0x1E, 0x0F, 0x07, 0x0E, 0x3C, 0x70, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // 'X'
+#endif
+#if FONT_HAS(11X18, 89)
+0x02, 0x0E, 0x3C, 0xF0, 0xC0, 0xC0, 0xF0, 0x3C, 0x0E, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x7F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // 'Y'
+#endif
+#if FONT_HAS(11X18, 90)
+0x00, 0x00, 0x06, 0x06, 0x86, 0xC6, 0x76, 0x3E, 0x0E, 0x00, 0x00, 0x00, 0x70, 0x78, 0x6E, 0x67, 0x61, 0x60, 0x60, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // 'Z'
+#endif
+#if FONT_HAS(11X18, 91)
+0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x03, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x03, 0x03, 0x03, 0x00, 0x00, 0x00,  // '['
+#endif
+#if FONT_HAS(11X18, 92)
+0x00, 0x00, 0x00, 0x0E, 0xFE, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x7F, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // '\'
+#endif
+#if FONT_HAS(11X18, 93)
+0x00, 0x00, 0x00, 0x03, 0x03, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x03, 0x03, 0x03, 0x00, 0x00, 0x00, 0x00,  // ']'
+#endif
+#if FONT_HAS(11X18, 94)
+0x00, 0x80, 0xE0, 0x78, 0x0E, 0x0E, 0x78, 0xE0, 0x80, 0x00, 0x00, 0x00, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // '^'
+#endif
+#if FONT_HAS(11X18, 95)
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,  // '_'
+#endif
+#if FONT_HAS(11X18, 96)
+0x00, 0x00, 0x02, 0x06, 0x0E, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // '`'
+#endif
+#if FONT_HAS(11X18, 97)
+0x00, 0x80, 0xC0, 0x60, 0x60, 0x60, 0x60, 0xE0, 0xC0, 0x00, 0x00, 0x00, 0x38, 0x7C, 0x66, 0x66, 0x26, 0x36, 0x3F, 0x7F, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // 'a'
+#endif
+#if FONT_HAS(11X18, 98)
+0x00, 0xFE, 0xFE, 0xC0, 0x60, 0x60, 0xE0, 0xC0, 0x80, 0x00, 0x00, 0x00, 0x7F, 0x7F, 0x30, 0x60, 0x60, 0x70, 0x3F, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // 'b'
+#endif
+#if FONT_HAS(11X18, 99)
+0x00, 0x80, 0xC0, 0xE0, 0x60, 0x60, 0xE0, 0xC0, 0x80, 0x00, 0x00, 0x00, 0x1F, 0x3F, 0x70, 0x60, 0x60, 0x70, 0x39, 0x19, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // 'c'
+#endif
+#if FONT_HAS(11X18, 100)
+0x00, 0x80, 0xC0, 0xE0, 0x60, 0x60, 0xC0, 0xFE, 0xFE, 0x00, 0x00, 0x00, 0x1F, 0x3F, 0x70, 0x60, 0x60, 0x30, 0x7F, 0x7F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // 'd'
+#endif
+#if FONT_HAS(11X18, 101)
+0x00, 0x80, 0xC0, 0xE0, 0x60, 0x60, 0xE0, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x3F, 0x76, 0x66, 0x66, 0x66, 0x37, 0x17, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // 'e'
+#endif
+#if FONT_HAS(11X18, 102)
+0x00, 0x60, 0x60, 0x60, 0xFC, 0xFE, 0x66, 0x66, 0x66, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x7F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // 'f'
+#endif
+#if FONT_HAS(11X18, 103)
+0x00, 0xC0, 0xE0, 0x70, 0x30, 0x30, 0x60, 0xF0, 0xF0, 0x00, 0x00, 0x00, 0x8F, 0x9F, 0x38, 0x30, 0x30, 0x98, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x01, 0x03, 0x03, 0x03, 0x03, 0x03, 0x01, 0x00, 0x00, 0x00,  // 'g'
+#endif
+#if FONT_HAS(11X18, 104)
+0x00, 0xFE, 0xFE, 0xC0, 0x60, 0x60, 0x60, 0xE0, 0xC0, 0x00, 0x00, 0x00, 0x7F, 0x7F, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x7F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // 'h'
+#endif
+#if FONT_HAS(11X18, 105)
+0x00, 0x00, 0x60, 0x60, 0x60, 0xE6, 0xE6, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x7F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // 'i'
+#endif
+#if FONT_HAS(11X18, 106)
+0x00, 0x00, 0x30, 0x30, 0x30, 0xF3, 0xF3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x03, 0x03, 0x03, 0x03, 0x01, 0x00, 0x00, 0x00, 0x00,  // 'j'
+#endif
+#if FONT_HAS(11X18, 107)
+0x00, 0xFE, 0xFE, 0x00, 0x00, 0x80, 0xC0, 0x60, 0x20, 0x00, 0x00, 0x00, 0x7F, 0x7F, 0x06, 0x03, 0x07, 0x1C, 0x38, 0x60, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // 'k'
+#endif
+#if FONT_HAS(11X18, 108)
+0x00, 0x00, 0x06, 0x06, 0x06, 0xFE, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x7F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // 'l'
+#endif
+#if FONT_HAS(11X18, 109)
+0xE0, 0xE0, 0x40, 0x60, 0xE0, 0xE0, 0xC0, 0x60, 0xE0, 0xC0, 0x00, 0x7F, 0x7F, 0x00, 0x00, 0x7F, 0x7F, 0x00, 0x00, 0x7F, 0x7F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // 'm'
+#endif
+#if FONT_HAS(11X18, 110)
+0x00, 0xE0, 0xE0, 0xC0, 0x60, 0x60, 0x60, 0xE0, 0xC0, 0x00, 0x00, 0x00, 0x7F, 0x7F, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x7F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // 'n'
+#endif
+#if FONT_HAS(11X18, 111)
+0x00, 0x80, 0xC0, 0xE0, 0x60, 0x60, 0xE0, 0xC0, 0x80, 0x00, 0x00, 0x00, 0x1F, 0x3F, 0x70, 0x60, 0x60, 0x70, 0x3F, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // 'o'
+#endif
+#if FONT_HAS(11X18, 112)
+0x00, 0xF0, 0xF0, 0x60, 0x30, 0x30, 0x70, 0xE0, 0xC0, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x18, 0x30, 0x30, 0x38, 0x1F, 0x0F, 0x00, 0x00, 0x00, 0x03, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // 'p'
+#endif
+#if FONT_HAS(11X18, 113)
+0x00, 0xC0, 0xE0, 0x70, 0x30, 0x30, 0x60, 0xF0, 0xF0, 0x00, 0x00, 0x00, 0x0F, 0x1F, 0x38, 0x30, 0x30, 0x18, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x03, 0x00, 0x00,  // 'q'
+#endif
+#if FONT_HAS(11X18, 114)
+0x00, 0x20, 0xE0, 0xC0, 0xC0, 0x60, 0x60, 0xE0, 0x40, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x7F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // 'r'
+#endif
+#if FONT_HAS(11X18, 115)
+0x00, 0x80, 0xC0, 0x60, 0x60, 0x60, 0x60, 0xC0, 0xC0, 0x00, 0x00, 0x00, 0x33, 0x37, 0x66, 0x66, 0x66, 0x66, 0x3E, 0x1C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // 's'
+#endif
+#if FONT_HAS(11X18, 116)
+0x00, 0x60, 0x60, 0xF8, 0xFC, 0x60, 0x60, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x7F, 0x60, 0x60, 0x60, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // 't'
+#endif
+#if FONT_HAS(11X18, 117)
+0x00, 0xE0, 0xE0, 0x00, 0x00, 0x00, 0x00, 0xE0, 0xE0, 0x00, 0x00, 0x00, 0x3F, 0x7F, 0x60, 0x60, 0x60, 0x30, 0x7F, 0x7F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // 'u'
+#endif
+#if FONT_HAS(11X18, 118)
+0x00, 0x20, 0xE0, 0xC0, 0x00, 0x00, 0x00, 0xC0, 0xE0, 0x20, 0x00, 0x00, 0x00, 0x01, 0x0F, 0x3E, 0x70, 0x7E, 0x0F, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // 'v'
+#endif
+#if FONT_HAS(11X18, 119)
+0xE0, 0xE0, 0x00, 0xE0, 0xE0, 0xE0, 0x00, 0xE0, 0xE0, 0x00, 0x00, 0x00, 0x1F, 0x78, 0x1F, 0x00, 0x1F, 0x78, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // 'w'
+#endif
+#if FONT_HAS(11X18, 120)
+0x00, 0x20, 0xE0, 0xC0, 0x00, 0x00, 0xC0, 0xE0, 0x20, 0x00, 0x00, 0x00, 0x40, 0x70, 0x39, 0x0F, 0x0F, 0x39, 0x70, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // 'x'
+#endif
+#if FONT_HAS(11X18, 121)
+0x00, 0x30, 0xF0, 0xC0, 0x00, 0x00, 0x80, 0xF0, 0x70, 0x00, 0x00, 0x00, 0x00, 0x01, 0x8F, 0xFE, 0xF0, 0x7F, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x03, 0x03, 0x03, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00,  // 'y'
+#endif
+#if FONT_HAS(11X18, 122)
+0x00, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0xE0, 0xE0, 0x60, 0x00, 0x00, 0x60, 0x70, 0x78, 0x6C, 0x66, 0x63, 0x61, 0x60, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // 'z'
+#endif
+#if FONT_HAS(11X18, 123)
+0x00, 0x00, 0x00, 0x00, 0x80, 0xFE, 0xFF, 0x03, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x07, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x03, 0x03, 0x03, 0x00, 0x00,  // '{'
+#endif
+#if FONT_HAS(11X18, 124)
+0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x03, 0x00, 0x00, 0x00, 0x00,  // '|'
+#endif
+#if FONT_HAS(11X18, 125)
+0x00, 0x00, 0x03, 0x03, 0xFF, 0xFE, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFC, 0xFF, 0x07, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x03, 0x03, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00,  // '}'
+#endif
+#if FONT_HAS(11X18, 126)
+0x00, 0x00, 0x80, 0x80, 0x80, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 0x03, 0x01, 0x01, 0x01, 0x03, 0x03, 0x03, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // '~'
+#endif
+};
+
+#endif
+
+#ifdef ENABLE_FONT_16X26
+
+#ifdef SSD1306_FONT_16X26_GLYPHS
+
+enum {
+FONT_16X26_RANK_32 = 0,
+FONT_RANK_AFTER(16X26, 33, 32), FONT_RANK_AFTER(16X26, 34, 33), FONT_RANK_AFTER(16X26, 35, 34),
+FONT_RANK_AFTER(16X26, 36, 35), FONT_RANK_AFTER(16X26, 37, 36), FONT_RANK_AFTER(16X26, 38, 37),
+FONT_RANK_AFTER(16X26, 39, 38), FONT_RANK_AFTER(16X26, 40, 39), FONT_RANK_AFTER(16X26, 41, 40),
+FONT_RANK_AFTER(16X26, 42, 41), FONT_RANK_AFTER(16X26, 43, 42), FONT_RANK_AFTER(16X26, 44, 43),
+FONT_RANK_AFTER(16X26, 45, 44), FONT_RANK_AFTER(16X26, 46, 45), FONT_RANK_AFTER(16X26, 47, 46),
+FONT_RANK_AFTER(16X26, 48, 47), FONT_RANK_AFTER(16X26, 49, 48), FONT_RANK_AFTER(16X26, 50, 49),
+FONT_RANK_AFTER(16X26, 51, 50), FONT_RANK_AFTER(16X26, 52, 51), FONT_RANK_AFTER(16X26, 53, 52),
+FONT_RANK_AFTER(16X26, 54, 53), FONT_RANK_AFTER(16X26, 55, 54), FONT_RANK_AFTER(16X26, 56, 55),
+FONT_RANK_AFTER(16X26, 57, 56), FONT_RANK_AFTER(16X26, 58, 57), FONT_RANK_AFTER(16X26, 59, 58),
+FONT_RANK_AFTER(16X26, 60, 59), FONT_RANK_AFTER(16X26, 61, 60), FONT_RANK_AFTER(16X26, 62, 61),
+FONT_RANK_AFTER(16X26, 63, 62), FONT_RANK_AFTER(16X26, 64, 63), FONT_RANK_AFTER(16X26, 65, 64),
+FONT_RANK_AFTER(16X26, 66, 65), FONT_RANK_AFTER(16X26, 67, 66), FONT_RANK_AFTER(16X26, 68, 67),
+FONT_RANK_AFTER(16X26, 69, 68), FONT_RANK_AFTER(16X26, 70, 69), FONT_RANK_AFTER(16X26, 71, 70),
+FONT_RANK_AFTER(16X26, 72, 71), FONT_RANK_AFTER(16X26, 73, 72), FONT_RANK_AFTER(16X26, 74, 73),
+FONT_RANK_AFTER(16X26, 75, 74), FONT_RANK_AFTER(16X26, 76, 75), FONT_RANK_AFTER(16X26, 77, 76),
+FONT_RANK_AFTER(16X26, 78, 77), FONT_RANK_AFTER(16X26, 79, 78), FONT_RANK_AFTER(16X26, 80, 79),
+FONT_RANK_AFTER(16X26, 81, 80), FONT_RANK_AFTER(16X26, 82, 81), FONT_RANK_AFTER(16X26, 83, 82),
+FONT_RANK_AFTER(16X26, 84, 83), FONT_RANK_AFTER(16X26, 85, 84), FONT_RANK_AFTER(16X26, 86, 85),
+FONT_RANK_AFTER(16X26, 87, 86), FONT_RANK_AFTER(16X26, 88, 87), FONT_RANK_AFTER(16X26, 89, 88),
+FONT_RANK_AFTER(16X26, 90, 89), FONT_RANK_AFTER(16X26, 91, 90), FONT_RANK_AFTER(16X26, 92, 91),
+FONT_RANK_AFTER(16X26, 93, 92), FONT_RANK_AFTER(16X26, 94, 93), FONT_RANK_AFTER(16X26, 95, 94),
+FONT_RANK_AFTER(16X26, 96, 95), FONT_RANK_AFTER(16X26, 97, 96), FONT_RANK_AFTER(16X26, 98, 97),
+FONT_RANK_AFTER(16X26, 99, 98), FONT_RANK_AFTER(16X26, 100, 99), FONT_RANK_AFTER(16X26, 101, 100),
+FONT_RANK_AFTER(16X26, 102, 101), FONT_RANK_AFTER(16X26, 103, 102), FONT_RANK_AFTER(16X26, 104, 103),
+FONT_RANK_AFTER(16X26, 105, 104), FONT_RANK_AFTER(16X26, 106, 105), FONT_RANK_AFTER(16X26, 107, 106),
+FONT_RANK_AFTER(16X26, 108, 107), FONT_RANK_AFTER(16X26, 109, 108), FONT_RANK_AFTER(16X26, 110, 109),
+FONT_RANK_AFTER(16X26, 111, 110), FONT_RANK_AFTER(16X26, 112, 111), FONT_RANK_AFTER(16X26, 113, 112),
+FONT_RANK_AFTER(16X26, 114, 113), FONT_RANK_AFTER(16X26, 115, 114), FONT_RANK_AFTER(16X26, 116, 115),
+FONT_RANK_AFTER(16X26, 117, 116), FONT_RANK_AFTER(16X26, 118, 117), FONT_RANK_AFTER(16X26, 119, 118),
+FONT_RANK_AFTER(16X26, 120, 119), FONT_RANK_AFTER(16X26, 121, 120), FONT_RANK_AFTER(16X26, 122, 121),
+FONT_RANK_AFTER(16X26, 123, 122), FONT_RANK_AFTER(16X26, 124, 123), FONT_RANK_AFTER(16X26, 125, 124),
+FONT_RANK_AFTER(16X26, 126, 125),
+};
+
+/**
+ * Index of each glyph of 16x26 font in fontcols_16x26.
+ */
+static const uint8_t fontindex_16x26 [] = {
+FONT_RANK(16X26, 32), FONT_RANK(16X26, 33), FONT_RANK(16X26, 34), FONT_RANK(16X26, 35), FONT_RANK(16X26, 36), FONT_RANK(16X26, 37),
+FONT_RANK(16X26, 38), FONT_RANK(16X26, 39), FONT_RANK(16X26, 40), FONT_RANK(16X26, 41), FONT_RANK(16X26, 42), FONT_RANK(16X26, 43),
+FONT_RANK(16X26, 44), FONT_RANK(16X26, 45), FONT_RANK(16X26, 46), FONT_RANK(16X26, 47), FONT_RANK(16X26, 48), FONT_RANK(16X26, 49),
+FONT_RANK(16X26, 50), FONT_RANK(16X26, 51), FONT_RANK(16X26, 52), FONT_RANK(16X26, 53), FONT_RANK(16X26, 54), FONT_RANK(16X26, 55),
+FONT_RANK(16X26, 56), FONT_RANK(16X26, 57), FONT_RANK(16X26, 58), FONT_RANK(16X26, 59), FONT_RANK(16X26, 60), FONT_RANK(16X26, 61),
+FONT_RANK(16X26, 62), FONT_RANK(16X26, 63), FONT_RANK(16X26, 64), FONT_RANK(16X26, 65), FONT_RANK(16X26, 66), FONT_RANK(16X26, 67),
+FONT_RANK(16X26, 68), FONT_RANK(16X26, 69), FONT_RANK(16X26, 70), FONT_RANK(16X26, 71), FONT_RANK(16X26, 72), FONT_RANK(16X26, 73),
+FONT_RANK(16X26, 74), FONT_RANK(16X26, 75), FONT_RANK(16X26, 76), FONT_RANK(16X26, 77), FONT_RANK(16X26, 78), FONT_RANK(16X26, 79),
+FONT_RANK(16X26, 80), FONT_RANK(16X26, 81), FONT_RANK(16X26, 82), FONT_RANK(16X26, 83), FONT_RANK(16X26, 84), FONT_RANK(16X26, 85),
+FONT_RANK(16X26, 86), FONT_RANK(16X26, 87), FONT_RANK(16X26, 88), FONT_RANK(16X26, 89), FONT_RANK(16X26, 90), FONT_RANK(16X26, 91),
+FONT_RANK(16X26, 92), FONT_RANK(16X26, 93), FONT_RANK(16X26, 94), FONT_RANK(16X26, 95), FONT_RANK(16X26, 96), FONT_RANK(16X26, 97),
+FONT_RANK(16X26, 98), FONT_RANK(16X26, 99), FONT_RANK(16X26, 100), FONT_RANK(16X26, 101), FONT_RANK(16X26, 102), FONT_RANK(16X26, 103),
+FONT_RANK(16X26, 104), FONT_RANK(16X26, 105), FONT_RANK(16X26, 106), FONT_RANK(16X26, 107), FONT_RANK(16X26, 108), FONT_RANK(16X26, 109),
+FONT_RANK(16X26, 110), FONT_RANK(16X26, 111), FONT_RANK(16X26, 112), FONT_RANK(16X26, 113), FONT_RANK(16X26, 114), FONT_RANK(16X26, 115),
+FONT_RANK(16X26, 116), FONT_RANK(16X26, 117), FONT_RANK(16X26, 118), FONT_RANK(16X26, 119), FONT_RANK(16X26, 120), FONT_RANK(16X26, 121),
+FONT_RANK(16X26, 122), FONT_RANK(16X26, 123), FONT_RANK(16X26, 124), FONT_RANK(16X26, 125), FONT_RANK(16X26, 126),
+};
+
+#define FONT_16X26_INDEX fontindex_16x26
+
+#else
+#define SSD1306_FONT_16X26_GLYPHS(c) 1
+#define FONT_16X26_INDEX NULL
+#endif
+
+/**
+ * Column-major encoding for 16x26 font, generated from fontmap_16x26.
+ * Each glyph is made of 4 page(s) of 16 bytes.
+ */
+static const uint8_t fontcols_16x26 [] = {
+#if FONT_HAS(16X26, 32)
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // sp
+#endif
+#if FONT_HAS(16X26, 33)
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x7F, 0x7F, 0x7F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1C, 0x1C, 0x1C, 0x1C, 0x1C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // '!'
+#endif
+#if FONT_HAS(16X26, 34)
+0x00, 0x00, 0x00, 0x7F, 0x7F, 0x7F, 0x7F, 0x00, 0x00, 0x00, 0x7F, 0x7F, 0x7F, 0x7F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // '"'
+#endif
+#if FONT_HAS(16X26, 35)
+0x00, 0x80, 0xC0, 0xC0, 0xC0, 0xE0, 0xFE, 0xFF, 0xFF, 0xC7, 0xC0, 0xFC, 0xFF, 0xFF, 0xCF, 0xC0, 0x60, 0x60, 0x60, 0xE0, 0xFE, 0xFF, 0xFF, 0x6F, 0xE0, 0xFC, 0xFF, 0xFF, 0x7F, 0x60, 0x60, 0x60, 0x00, 0x00, 0x1C, 0x1F, 0x1F, 0x0F, 0x00, 0x18, 0x1F, 0x1F, 0x1F, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // '#'
+#endif
+#if FONT_HAS(16X26, 36)
+0x00, 0x00, 0x00, 0xFC, 0xFE, 0xFE, 0xFF, 0x87, 0xFF, 0xFF, 0xFF, 0x03, 0x07, 0x07, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x03, 0x07, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0xF8, 0xF8, 0xF0, 0x00, 0x00, 0x00, 0x0C, 0x0C, 0x1C, 0x1C, 0x18, 0x7F, 0x7F, 0x7F, 0x7F, 0x1F, 0x0F, 0x0F, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // '$'
+#endif
+#if FONT_HAS(16X26, 37)
+0xFE, 0xFE, 0xFF, 0x03, 0x01, 0xCF, 0xFF, 0xFE, 0xFC, 0x80, 0xE0, 0xF0, 0xFC, 0x3E, 0x1F, 0x07, 0x01, 0x01, 0x03, 0x83, 0xC2, 0xF3, 0xFB, 0x7F, 0xFF, 0xFF, 0xFB, 0xF9, 0x18, 0x18, 0xF8, 0xF8, 0x18, 0x1C, 0x1F, 0x0F, 0x07, 0x01, 0x00, 0x00, 0x07, 0x0F, 0x1F, 0x1F, 0x18, 0x18, 0x1F, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // '%'
+#endif
+#if FONT_HAS(16X26, 38)
+0x00, 0x00, 0x00, 0x38, 0xFE, 0xFF, 0xFF, 0xFF, 0x83, 0xFF, 0xFF, 0xFE, 0x7E, 0x00, 0x00, 0x00, 0xF8, 0xFC, 0xFC, 0xFE, 0x0F, 0x07, 0x1F, 0x3F, 0xFF, 0xFD, 0xF1, 0xE0, 0x80, 0xF0, 0xFC, 0xFC, 0x03, 0x07, 0x0F, 0x1F, 0x1E, 0x1C, 0x18, 0x18, 0x18, 0x1D, 0x1F, 0x0F, 0x1F, 0x1F, 0x1F, 0x1D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // '&'
+#endif
+#if FONT_HAS(16X26, 39)
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x7F, 0x7F, 0x7F, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // '''
+#endif
+#if FONT_HAS(16X26, 40)
+0x00, 0x00, 0x00, 0x00, 0x00, 0xE0, 0xF0, 0xFC, 0xFC, 0x3E, 0x0F, 0x07, 0x03, 0x03, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x81, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x0F, 0x3F, 0x3F, 0x7C, 0xF0, 0xE0, 0xC0, 0xC0, 0x80, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0x01, 0x01,  // '('
+#endif
+#if FONT_HAS(16X26, 41)
+0x00, 0x01, 0x01, 0x03, 0x03, 0x07, 0x0F, 0x3E, 0xFC, 0xFC, 0xF0, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x81, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x80, 0x80, 0xC0, 0xC0, 0xE0, 0xF0, 0x7C, 0x3F, 0x3F, 0x0F, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // ')'
+#endif
+#if FONT_HAS(16X26, 42)
+0x00, 0x00, 0x38, 0x38, 0x38, 0x30, 0xF3, 0xFF, 0x1F, 0xBF, 0xF1, 0xB0, 0x38, 0x38, 0x38, 0x30, 0x00, 0x00, 0x00, 0x04, 0x06, 0x0F, 0x0F, 0x07, 0x01, 0x03, 0x0F, 0x0F, 0x0F, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // '*'
+#endif
+#if FONT_HAS(16X26, 43)
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xC0, 0xC0, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0xFF, 0xFF, 0xFF, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x1F, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // '+'
+#endif
+#if FONT_HAS(16X26, 44)
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1E, 0xFE, 0xFE, 0xFE, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x03, 0x03, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // ','
+#endif
+#if FONT_HAS(16X26, 45)
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // '-'
+#endif
+#if FONT_HAS(16X26, 46)
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // '.'
+#endif
+#if FONT_HAS(16X26, 47)
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xC0, 0xF0, 0xFC, 0xFF, 0x3F, 0x0F, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0xC0, 0xF0, 0xFC, 0xFF, 0x3F, 0x0F, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0xC0, 0xF0, 0xFC, 0xFF, 0x3F, 0x0F, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // '/'
+#endif
+#if FONT_HAS(16X26, 48)
+0x00, 0xE0, 0xF8, 0xFC, 0xFE, 0x7F, 0x0F, 0x07, 0x03, 0x07, 0x0F, 0x7F, 0xFE, 0xFC, 0xF8, 0xE0, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0xC0, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x03, 0x07, 0x0F, 0x1F, 0x1E, 0x1C, 0x18, 0x1C, 0x1E, 0x1F, 0x0F, 0x07, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // '0'
+#endif
+#if FONT_HAS(16X26, 49)
+0x00, 0x00, 0x0C, 0x0C, 0x0C, 0x0E, 0x0E, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x18, 0x18, 0x18, 0x18, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x18, 0x18, 0x18, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // '1'
+#endif
+#if FONT_HAS(16X26, 50)
+0x00, 0x00, 0x06, 0x06, 0x07, 0x07, 0x03, 0x03, 0x03, 0x07, 0xFF, 0xFE, 0xFE, 0xFC, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0xE0, 0xF0, 0xF8, 0x7C, 0x3E, 0x1F, 0x0F, 0x07, 0x03, 0x00, 0x00, 0x00, 0x00, 0x1E, 0x1F, 0x1F, 0x1F, 0x1B, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // '2'
+#endif
+#if FONT_HAS(16X26, 51)
+0x00, 0x00, 0x00, 0x06, 0x07, 0x07, 0x03, 0x03, 0x03, 0x07, 0xFF, 0xFF, 0xFE, 0xFC, 0x38, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x06, 0x06, 0x06, 0x07, 0x0F, 0x1F, 0xFF, 0xFD, 0xF8, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x1C, 0x1C, 0x1C, 0x18, 0x18, 0x18, 0x1C, 0x1E, 0x0F, 0x0F, 0x07, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // '3'
+#endif
+#if FONT_HAS(16X26, 52)
+0x00, 0x00, 0x00, 0x00, 0x80, 0xE0, 0xF0, 0xF8, 0x7E, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x60, 0x78, 0x7C, 0x7F, 0x7F, 0x67, 0x63, 0x60, 0x60, 0xFF, 0xFF, 0xFF, 0xFF, 0x60, 0x60, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x1F, 0x1F, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // '4'
+#endif
+#if FONT_HAS(16X26, 53)
+0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x03, 0x03, 0x03, 0x03, 0x07, 0x0F, 0xBF, 0xFE, 0xFE, 0xFC, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x1C, 0x1C, 0x1C, 0x18, 0x18, 0x18, 0x1C, 0x1F, 0x0F, 0x0F, 0x07, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // '5'
+#endif
+#if FONT_HAS(16X26, 54)
+0x00, 0x00, 0xE0, 0xF8, 0xFC, 0xFE, 0x3E, 0x0F, 0x07, 0x03, 0x03, 0x03, 0x07, 0x07, 0x06, 0x00, 0x00, 0x0C, 0xFF, 0xFF, 0xFF, 0xFF, 0x0E, 0x07, 0x03, 0x03, 0x07, 0x0F, 0xFF, 0xFE, 0xFC, 0xF8, 0x00, 0x00, 0x01, 0x07, 0x0F, 0x0F, 0x1F, 0x1C, 0x18, 0x18, 0x1C, 0x1E, 0x0F, 0x0F, 0x07, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // '6'
+#endif
+#if FONT_HAS(16X26, 55)
+0x00, 0x00, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0xC7, 0xF7, 0xFF, 0x7F, 0x3F, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0xE0, 0xF8, 0xFE, 0x7F, 0x1F, 0x07, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x1F, 0x1F, 0x1F, 0x1F, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // '7'
+#endif
+#if FONT_HAS(16X26, 56)
+0x00, 0x00, 0x30, 0xFC, 0xFE, 0xFF, 0xFF, 0x87, 0x03, 0x03, 0x87, 0xFF, 0xFF, 0xFE, 0x7C, 0x00, 0x00, 0xC0, 0xF0, 0xF8, 0xFD, 0xFF, 0x1F, 0x07, 0x0F, 0x0F, 0x1F, 0x7F, 0xFD, 0xF8, 0xF0, 0xE0, 0x00, 0x01, 0x07, 0x0F, 0x0F, 0x1F, 0x1C, 0x1C, 0x18, 0x18, 0x1C, 0x1E, 0x0F, 0x0F, 0x07, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // '8'
+#endif
+#if FONT_HAS(16X26, 57)
+0x00, 0xE0, 0xF8, 0xFC, 0xFE, 0xFF, 0x07, 0x03, 0x03, 0x07, 0x0F, 0xFF, 0xFE, 0xFC, 0xF8, 0xE0, 0x00, 0x01, 0x07, 0x0F, 0x0F, 0x1F, 0x1C, 0x18, 0x18, 0x18, 0x1C, 0xEF, 0xFF, 0xFF, 0xFF, 0x3F, 0x00, 0x00, 0x0C, 0x1C, 0x1C, 0x18, 0x18, 0x18, 0x1C, 0x1C, 0x1F, 0x0F, 0x07, 0x03, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // '9'
+#endif
+#if FONT_HAS(16X26, 58)
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x03, 0x03, 0x03, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // ':'
+#endif
+#if FONT_HAS(16X26, 59)
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x03, 0x03, 0x03, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1E, 0xFE, 0xFE, 0xFE, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x03, 0x03, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // ';'
+#endif
+#if FONT_HAS(16X26, 60)
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x80, 0xC0, 0xC0, 0x20, 0x20, 0x70, 0x70, 0xF8, 0xF8, 0xFC, 0xDC, 0x8E, 0x8E, 0x07, 0x07, 0x03, 0x03, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0x03, 0x03, 0x07, 0x07, 0x0E, 0x0E, 0x1C, 0x1C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // '<'
+#endif
+#if FONT_HAS(16X26, 61)
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8C, 0x8C, 0x8C, 0x8C, 0x8C, 0x8C, 0x8C, 0x8C, 0x8C, 0x8C, 0x8C, 0x8C, 0x8C, 0x8C, 0x8C, 0x8C, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // '='
+#endif
+#if FONT_HAS(16X26, 62)
+0xC0, 0xC0, 0xC0, 0x80, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0x03, 0x03, 0x07, 0x07, 0x8E, 0x8E, 0xDC, 0xDC, 0xF8, 0xF8, 0x70, 0x70, 0x20, 0x18, 0x1C, 0x1C, 0x0E, 0x0E, 0x07, 0x07, 0x03, 0x03, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // '>'
+#endif
+#if FONT_HAS(16X26, 63)
+0x00, 0x00, 0x1E, 0x1F, 0x1F, 0x03, 0x03, 0x03, 0x03, 0x03, 0x87, 0xFF, 0xFE, 0xFE, 0x7C, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x60, 0x78, 0x7C, 0x7E, 0x7F, 0x07, 0x03, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1C, 0x1C, 0x1C, 0x1C, 0x1C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // '?'
+#endif
+#if FONT_HAS(16X26, 64)
+0x00, 0xE0, 0xF8, 0xFC, 0x7E, 0x1E, 0x8F, 0xC7, 0xE3, 0xF3, 0x73, 0x37, 0x7F, 0xFE, 0xFE, 0xF8, 0x3F, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0xFF, 0xFF, 0xFF, 0xC1, 0xC0, 0xF0, 0xFE, 0xFF, 0xFF, 0xFF, 0x00, 0x01, 0x03, 0x07, 0x0F, 0x0E, 0x1C, 0x1D, 0x19, 0x19, 0x19, 0x1D, 0x1C, 0x0D, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // '@'
+#endif
+#if FONT_HAS(16X26, 65)
+0x00, 0x00, 0x00, 0x00, 0x00, 0xE0, 0xF8, 0xF8, 0xF8, 0xF8, 0xF8, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE0, 0xF8, 0xFF, 0xFF, 0xDF, 0xC3, 0xC0, 0xC7, 0xFF, 0xFF, 0xFF, 0xFC, 0xE0, 0x80, 0x1C, 0x1F, 0x1F, 0x1F, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x07, 0x1F, 0x1F, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // 'A'
+#endif
+#if FONT_HAS(16X26, 66)
+0x00, 0x00, 0xF8, 0xF8, 0xF8, 0xF8, 0x18, 0x18, 0x18, 0x18, 0x38, 0xF8, 0xF8, 0xF0, 0xE0, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x18, 0x18, 0x18, 0x3C, 0x3E, 0xFF, 0xF7, 0xE7, 0xE3, 0xC0, 0x00, 0x00, 0x1F, 0x1F, 0x1F, 0x1F, 0x18, 0x18, 0x18, 0x18, 0x18, 0x1C, 0x1F, 0x0F, 0x0F, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // 'B'
+#endif
+#if FONT_HAS(16X26, 67)
+0x00, 0x00, 0xC0, 0xE0, 0xE0, 0xF0, 0x70, 0x38, 0x38, 0x18, 0x18, 0x18, 0x18, 0x38, 0x38, 0x38, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xC1, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x07, 0x07, 0x0F, 0x0F, 0x1E, 0x1C, 0x18, 0x18, 0x18, 0x18, 0x18, 0x1C, 0x1C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // 'C'
+#endif
+#if FONT_HAS(16X26, 68)
+0x00, 0xF8, 0xF8, 0xF8, 0xF8, 0x18, 0x18, 0x18, 0x18, 0x38, 0x38, 0xF8, 0xF0, 0xF0, 0xE0, 0xC0, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x1F, 0x1F, 0x1F, 0x1F, 0x18, 0x18, 0x18, 0x18, 0x1C, 0x1C, 0x0F, 0x0F, 0x07, 0x07, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // 'D'
+#endif
+#if FONT_HAS(16X26, 69)
+0x00, 0x00, 0xF8, 0xF8, 0xF8, 0xF8, 0xF8, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x00, 0x00, 0x00, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // 'E'
+#endif
+#if FONT_HAS(16X26, 70)
+0x00, 0x00, 0x00, 0xF8, 0xF8, 0xF8, 0xF8, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x00, 0x00, 0x00, 0x1F, 0x1F, 0x1F, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // 'F'
+#endif
+#if FONT_HAS(16X26, 71)
+0x00, 0x80, 0xC0, 0xE0, 0xF0, 0xF0, 0x78, 0x38, 0x38, 0x18, 0x18, 0x18, 0x18, 0x38, 0x38, 0x30, 0x3C, 0xFF, 0xFF, 0xFF, 0xFF, 0x81, 0x00, 0x00, 0x00, 0x30, 0x30, 0x30, 0xF0, 0xF0, 0xF0, 0xF0, 0x00, 0x01, 0x03, 0x07, 0x0F, 0x0F, 0x1E, 0x1C, 0x1C, 0x18, 0x18, 0x18, 0x1F, 0x1F, 0x1F, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // 'G'
+#endif
+#if FONT_HAS(16X26, 72)
+0x00, 0xF8, 0xF8, 0xF8, 0xF8, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF8, 0xF8, 0xF8, 0xF8, 0xF8, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x18, 0x18, 0x18, 0x18, 0x18, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // 'H'
+#endif
+#if FONT_HAS(16X26, 73)
+0x00, 0x00, 0x18, 0x18, 0x18, 0x18, 0xF8, 0xF8, 0xF8, 0xF8, 0xF8, 0x18, 0x18, 0x18, 0x18, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x18, 0x18, 0x18, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x18, 0x18, 0x18, 0x18, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // 'I'
+#endif
+#if FONT_HAS(16X26, 74)
+0x00, 0x00, 0x00, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0xF8, 0xF8, 0xF8, 0xF8, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x1C, 0x1C, 0x1C, 0x18, 0x18, 0x18, 0x1C, 0x1F, 0x0F, 0x0F, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // 'J'
+#endif
+#if FONT_HAS(16X26, 75)
+0x00, 0x00, 0xF8, 0xF8, 0xF8, 0xF8, 0x00, 0x00, 0x80, 0xC0, 0xE0, 0xF8, 0x78, 0x38, 0x18, 0x08, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x3E, 0x7F, 0xFF, 0xF7, 0xE3, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x1F, 0x1F, 0x1F, 0x00, 0x00, 0x00, 0x03, 0x07, 0x0F, 0x1F, 0x1E, 0x1C, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // 'K'
+#endif
+#if FONT_HAS(16X26, 76)
+0x00, 0x00, 0xF8, 0xF8, 0xF8, 0xF8, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // 'L'
+#endif
+#if FONT_HAS(16X26, 77)
+0xF8, 0xF8, 0xF8, 0xF8, 0xF8, 0xF0, 0xC0, 0x00, 0x00, 0x00, 0xC0, 0xF8, 0xF8, 0xF8, 0xF8, 0xF8, 0xFF, 0xFF, 0xFF, 0xFF, 0x0F, 0x3F, 0xFF, 0xFE, 0xF0, 0xFE, 0xFF, 0x1F, 0x03, 0xFF, 0xFF, 0xFF, 0x1F, 0x1F, 0x1F, 0x1F, 0x00, 0x00, 0x01, 0x01, 0x01, 0x01, 0x00, 0x00, 0x00, 0x1F, 0x1F, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // 'M'
+#endif
+#if FONT_HAS(16X26, 78)
+0x00, 0xF8, 0xF8, 0xF8, 0xF8, 0xF8, 0xE0, 0xC0, 0x00, 0x00, 0x00, 0x00, 0xF8, 0xF8, 0xF8, 0xF8, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x07, 0x0F, 0x3F, 0xFF, 0xFC, 0xF8, 0xE0, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x1F, 0x1F, 0x1F, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x01, 0x07, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // 'N'
+#endif
+#if FONT_HAS(16X26, 79)
+0x00, 0xC0, 0xE0, 0xF0, 0xF0, 0x78, 0x38, 0x18, 0x18, 0x18, 0x38, 0x78, 0xF0, 0xF0, 0xE0, 0xC0, 0x7E, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x03, 0x07, 0x0F, 0x0F, 0x1E, 0x1C, 0x18, 0x18, 0x18, 0x1C, 0x1E, 0x0F, 0x0F, 0x07, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // 'O'
+#endif
+#if FONT_HAS(16X26, 80)
+0x00, 0x00, 0xF8, 0xF8, 0xF8, 0xF8, 0xF8, 0x18, 0x18, 0x18, 0x18, 0x38, 0xF8, 0xF8, 0xF0, 0xF0, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x30, 0x30, 0x30, 0x38, 0x3C, 0x1F, 0x1F, 0x0F, 0x0F, 0x00, 0x00, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // 'P'
+#endif
+#if FONT_HAS(16X26, 81)
+0x00, 0xC0, 0xE0, 0xF0, 0xF0, 0x78, 0x38, 0x18, 0x18, 0x18, 0x38, 0x78, 0xF0, 0xF0, 0xE0, 0xC0, 0x7E, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x03, 0x07, 0x0F, 0x0F, 0x1E, 0x1C, 0x18, 0x18, 0x38, 0x7C, 0x7E, 0xFF, 0xEF, 0xC7, 0xC3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01,  // 'Q'
+#endif
+#if FONT_HAS(16X26, 82)
+0x00, 0x00, 0xF8, 0xF8, 0xF8, 0xF8, 0x18, 0x18, 0x18, 0x38, 0x78, 0xF8, 0xF0, 0xF0, 0xE0, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x30, 0x70, 0xF8, 0xF8, 0xFE, 0xDF, 0x8F, 0x0F, 0x03, 0x00, 0x00, 0x00, 0x1F, 0x1F, 0x1F, 0x1F, 0x00, 0x00, 0x00, 0x01, 0x03, 0x0F, 0x1F, 0x1F, 0x1E, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // 'R'
+#endif
+#if FONT_HAS(16X26, 83)
+0x00, 0x00, 0xE0, 0xF0, 0xF0, 0xF8, 0x38, 0x18, 0x18, 0x18, 0x18, 0x18, 0x38, 0x38, 0x30, 0x00, 0x00, 0x00, 0x03, 0x07, 0x0F, 0x0F, 0x1E, 0x1C, 0x1C, 0x3C, 0x38, 0x78, 0xF8, 0xF0, 0xF0, 0xE0, 0x00, 0x00, 0x0E, 0x1C, 0x1C, 0x1C, 0x18, 0x18, 0x18, 0x18, 0x1C, 0x1E, 0x0F, 0x0F, 0x07, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // 'S'
+#endif
+#if FONT_HAS(16X26, 84)
+0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0xF8, 0xF8, 0xF8, 0xF8, 0xF8, 0x18, 0x18, 0x18, 0x18, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // 'T'
+#endif
+#if FONT_HAS(16X26, 85)
+0x00, 0xF8, 0xF8, 0xF8, 0xF8, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF8, 0xF8, 0xF8, 0xF8, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x07, 0x0F, 0x0F, 0x1F, 0x1C, 0x18, 0x18, 0x18, 0x1C, 0x1F, 0x0F, 0x0F, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // 'U'
+#endif
+#if FONT_HAS(16X26, 86)
+0x38, 0xF8, 0xF8, 0xF8, 0xE0, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xC0, 0xF8, 0xF8, 0xF8, 0x00, 0x00, 0x07, 0x3F, 0xFF, 0xFF, 0xFC, 0xF0, 0x80, 0xE0, 0xF8, 0xFF, 0xFF, 0x1F, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // 'V'
+#endif
+#if FONT_HAS(16X26, 87)
+0xF8, 0xF8, 0xF8, 0xF0, 0x00, 0x00, 0x80, 0x80, 0x80, 0x80, 0x80, 0x00, 0x00, 0xC0, 0xF8, 0xF8, 0x03, 0xFF, 0xFF, 0xFF, 0xF8, 0xF0, 0xFF, 0xFF, 0x3F, 0xFF, 0xFF, 0xF8, 0xE0, 0xFF, 0xFF, 0xFF, 0x00, 0x01, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x03, 0x00, 0x03, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // 'W'
+#endif
+#if FONT_HAS(16X26, 88)
+0x08, 0x18, 0x78, 0xF8, 0xF8, 0xF0, 0xE0, 0x80, 0x00, 0x00, 0xC0, 0xE0, 0xF0, 0xF8, 0x78, 0x18, 0x00, 0x00, 0x00, 0x00, 0xC1, 0xE7, 0xFF, 0xFF, 0x7F, 0xFF, 0xFF, 0xE3, 0xC1, 0x80, 0x00, 0x00, 0x10, 0x1C, 0x1E, 0x1F, 0x0F, 0x03, 0x01, 0x00, 0x00, 0x01, 0x03, 0x07, 0x1F, 0x1F, 0x1E, 0x1C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // 'X'
+#endif
+#if FONT_HAS(16X26, 89)
+0x08, 0x38, 0xF8, 0xF8, 0xF8, 0xE0, 0x80, 0x00, 0x00, 0x00, 0x00, 0xC0, 0xE0, 0xF8, 0xF8, 0x38, 0x00, 0x00, 0x00, 0x01, 0x07, 0x0F, 0xFF, 0xFF, 0xFC, 0xFE, 0xFF, 0x0F, 0x07, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // 'Y'
+#endif
+#if FONT_HAS(16X26, 90)
+0x00, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x98, 0xD8, 0xF8, 0xF8, 0xF8, 0x78, 0x00, 0x00, 0x00, 0x00, 0xC0, 0xE0, 0xF0, 0xF8, 0x7E, 0x3F, 0x1F, 0x07, 0x03, 0x01, 0x00, 0x00, 0x00, 0x1C, 0x1E, 0x1F, 0x1F, 0x1F, 0x1B, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // 'Z'
+#endif
+#if FONT_HAS(16X26, 91)
+0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,  // '['
+#endif
+#if FONT_HAS(16X26, 92)
+0x00, 0x03, 0x0F, 0x3F, 0xFF, 0xFC, 0xF0, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x0F, 0x3F, 0xFF, 0xFC, 0xF0, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x0F, 0x3F, 0xFF, 0xFC, 0xF0, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0x01,  // '\'
+#endif
+#if FONT_HAS(16X26, 93)
+0x00, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00,  // ']'
+#endif
+#if FONT_HAS(16X26, 94)
+0x00, 0x00, 0x00, 0x00, 0x00, 0xE0, 0xF8, 0xFE, 0x7F, 0xFF, 0xF8, 0xE0, 0x80, 0x00, 0x00, 0x00, 0x00, 0x80, 0xF0, 0xFC, 0xFF, 0x3F, 0x0F, 0x03, 0x00, 0x01, 0x0F, 0x3F, 0xFF, 0xFC, 0xF0, 0xC0, 0x00, 0x01, 0x01, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // '^'
+#endif
+#if FONT_HAS(16X26, 95)
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // '_'
+#endif
+#if FONT_HAS(16X26, 96)
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // '`'
+#endif
+#if FONT_HAS(16X26, 97)
+0x00, 0x00, 0x80, 0x80, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0x80, 0x00, 0x00, 0x00, 0x80, 0xC1, 0xE1, 0xE1, 0xF1, 0x70, 0x30, 0x30, 0x31, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x07, 0x0F, 0x1F, 0x1F, 0x1E, 0x18, 0x18, 0x18, 0x1C, 0x0F, 0x0F, 0x1F, 0x1F, 0x1F, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // 'a'
+#endif
+#if FONT_HAS(16X26, 98)
+0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0x80, 0x80, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x03, 0x01, 0x00, 0x00, 0x01, 0x03, 0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x1F, 0x1F, 0x1F, 0x0F, 0x1C, 0x1C, 0x18, 0x18, 0x1C, 0x1F, 0x0F, 0x0F, 0x07, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // 'b'
+#endif
+#if FONT_HAS(16X26, 99)
+0x00, 0x00, 0x00, 0x00, 0x80, 0x80, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0x80, 0x00, 0x70, 0xFE, 0xFF, 0xFF, 0xFF, 0x07, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0x01, 0x00, 0x00, 0x03, 0x07, 0x0F, 0x0F, 0x1F, 0x1C, 0x1C, 0x18, 0x18, 0x18, 0x18, 0x1C, 0x1C, 0x0C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // 'c'
+#endif
+#if FONT_HAS(16X26, 100)
+0x00, 0x00, 0x00, 0x80, 0x80, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0xFC, 0xFF, 0xFF, 0xFF, 0x9F, 0x01, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x01, 0x07, 0x0F, 0x1F, 0x1F, 0x1C, 0x18, 0x18, 0x1C, 0x0E, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // 'd'
+#endif
+#if FONT_HAS(16X26, 101)
+0x00, 0x00, 0x00, 0x00, 0x80, 0x80, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0x80, 0x00, 0x00, 0x00, 0xF8, 0xFE, 0xFF, 0xFF, 0xFF, 0x33, 0x31, 0x30, 0x30, 0x31, 0x3F, 0x3F, 0x3F, 0x3F, 0x3C, 0x00, 0x00, 0x03, 0x07, 0x0F, 0x0F, 0x1E, 0x1C, 0x18, 0x18, 0x18, 0x18, 0x18, 0x1C, 0x1C, 0x0C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // 'e'
+#endif
+#if FONT_HAS(16X26, 102)
+0x00, 0xC0, 0xC0, 0xC0, 0xC0, 0xF8, 0xFE, 0xFF, 0xFF, 0xFF, 0xC3, 0xC1, 0xC1, 0xC1, 0xC1, 0xC3, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // 'f'
+#endif
+#if FONT_HAS(16X26, 103)
+0x00, 0x00, 0x00, 0x80, 0x80, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0x80, 0xC0, 0xC0, 0xC0, 0xC0, 0x00, 0xFC, 0xFF, 0xFF, 0xFF, 0x8F, 0x01, 0x00, 0x00, 0x01, 0x01, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x01, 0x07, 0x0F, 0x1F, 0x1F, 0x1C, 0x18, 0x18, 0x1C, 0x0E, 0xFF, 0xFF, 0xFF, 0xFF, 0x1F, 0x00, 0x00, 0x03, 0x03, 0x03, 0x02, 0x02, 0x02, 0x02, 0x03, 0x03, 0x03, 0x03, 0x01, 0x00, 0x00,  // 'g'
+#endif
+#if FONT_HAS(16X26, 104)
+0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0x80, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x07, 0x03, 0x01, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x1F, 0x1F, 0x1F, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // 'h'
+#endif
+#if FONT_HAS(16X26, 105)
+0x00, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC3, 0xC3, 0xC3, 0xC3, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x1F, 0x1F, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // 'i'
+#endif
+#if FONT_HAS(16X26, 106)
+0x00, 0x00, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC3, 0xC3, 0xC3, 0xC3, 0xC3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x7F, 0x00, 0x00, 0x00, 0x00, 0x03, 0x03, 0x03, 0x02, 0x02, 0x02, 0x03, 0x03, 0x03, 0x03, 0x01, 0x00, 0x00, 0x00, 0x00,  // 'j'
+#endif
+#if FONT_HAS(16X26, 107)
+0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x80, 0xC0, 0xC0, 0xC0, 0xC0, 0x40, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x70, 0xFC, 0xFE, 0xFF, 0xCF, 0x87, 0x03, 0x01, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x1F, 0x1F, 0x1F, 0x00, 0x00, 0x01, 0x03, 0x07, 0x1F, 0x1F, 0x1E, 0x1C, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // 'k'
+#endif
+#if FONT_HAS(16X26, 108)
+0x00, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // 'l'
+#endif
+#if FONT_HAS(16X26, 109)
+0xC0, 0xC0, 0xC0, 0xC0, 0x80, 0xC0, 0xC0, 0xC0, 0xC0, 0x80, 0x80, 0xC0, 0xC0, 0xC0, 0xC0, 0x80, 0xFF, 0xFF, 0xFF, 0xFF, 0x0F, 0x03, 0x07, 0xFF, 0xFF, 0xFF, 0x0F, 0x03, 0x03, 0xFF, 0xFF, 0xFF, 0x1F, 0x1F, 0x1F, 0x1F, 0x00, 0x00, 0x00, 0x1F, 0x1F, 0x1F, 0x00, 0x00, 0x00, 0x1F, 0x1F, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // 'm'
+#endif
+#if FONT_HAS(16X26, 110)
+0x00, 0x00, 0xC0, 0xC0, 0xC0, 0xC0, 0x80, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0x80, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x07, 0x03, 0x01, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x1F, 0x1F, 0x1F, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // 'n'
+#endif
+#if FONT_HAS(16X26, 111)
+0x00, 0x00, 0x00, 0x80, 0x80, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0x80, 0x80, 0x00, 0x00, 0x00, 0xFC, 0xFF, 0xFF, 0xFF, 0x07, 0x01, 0x00, 0x00, 0x00, 0x01, 0x07, 0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0x01, 0x07, 0x0F, 0x0F, 0x1F, 0x1C, 0x18, 0x18, 0x18, 0x1C, 0x1F, 0x0F, 0x0F, 0x07, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // 'o'
+#endif
+#if FONT_HAS(16X26, 112)
+0x00, 0x00, 0xC0, 0xC0, 0xC0, 0xC0, 0x80, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0x80, 0x80, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x03, 0x01, 0x00, 0x00, 0x01, 0x03, 0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x1E, 0x1C, 0x18, 0x18, 0x1C, 0x1F, 0x1F, 0x0F, 0x07, 0x01, 0x00, 0x00, 0x03, 0x03, 0x03, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // 'p'
+#endif
+#if FONT_HAS(16X26, 113)
+0x00, 0x00, 0x00, 0x80, 0x80, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0x80, 0xC0, 0xC0, 0xC0, 0x00, 0x00, 0xFC, 0xFF, 0xFF, 0xFF, 0x07, 0x01, 0x00, 0x00, 0x01, 0x01, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x03, 0x07, 0x0F, 0x1F, 0x1F, 0x1C, 0x18, 0x18, 0x1C, 0x0E, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x03, 0x03, 0x03, 0x00,  // 'q'
+#endif
+#if FONT_HAS(16X26, 114)
+0x00, 0x00, 0x00, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0x80, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x07, 0x03, 0x01, 0x00, 0x00, 0x07, 0x07, 0x07, 0x00, 0x00, 0x00, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // 'r'
+#endif
+#if FONT_HAS(16X26, 115)
+0x00, 0x00, 0x00, 0x80, 0x80, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0x80, 0x00, 0x00, 0x00, 0x0E, 0x1F, 0x1F, 0x3F, 0x3F, 0x38, 0x70, 0x70, 0xF0, 0xE0, 0xE1, 0xE1, 0xC1, 0x00, 0x00, 0x00, 0x0C, 0x1C, 0x1C, 0x1C, 0x18, 0x18, 0x18, 0x18, 0x1C, 0x1F, 0x0F, 0x0F, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // 's'
+#endif
+#if FONT_HAS(16X26, 116)
+0x00, 0xC0, 0xC0, 0xC0, 0xC0, 0xF8, 0xF8, 0xF8, 0xF8, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x0F, 0x1F, 0x1F, 0x1C, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // 't'
+#endif
+#if FONT_HAS(16X26, 117)
+0x00, 0x00, 0xC0, 0xC0, 0xC0, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0xC0, 0xC0, 0xC0, 0xC0, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x07, 0x0F, 0x1F, 0x1F, 0x1C, 0x18, 0x1C, 0x1E, 0x0F, 0x1F, 0x1F, 0x1F, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // 'u'
+#endif
+#if FONT_HAS(16X26, 118)
+0x40, 0xC0, 0xC0, 0xC0, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0xC0, 0xC0, 0xC0, 0x00, 0x01, 0x0F, 0x3F, 0xFF, 0xFE, 0xF8, 0xC0, 0x00, 0xC0, 0xF0, 0xFE, 0xFF, 0x3F, 0x0F, 0x01, 0x00, 0x00, 0x00, 0x00, 0x01, 0x07, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // 'v'
+#endif
+#if FONT_HAS(16X26, 119)
+0xC0, 0xC0, 0xC0, 0xC0, 0x00, 0x00, 0x00, 0x80, 0x80, 0x80, 0x80, 0x00, 0x00, 0x00, 0xC0, 0xC0, 0x0F, 0xFF, 0xFF, 0xFF, 0xF0, 0xF0, 0xFF, 0xFF, 0x1F, 0xFF, 0xFF, 0xFC, 0xC0, 0xFE, 0xFF, 0xFF, 0x00, 0x01, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x01, 0x00, 0x01, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // 'w'
+#endif
+#if FONT_HAS(16X26, 120)
+0x00, 0x40, 0xC0, 0xC0, 0xC0, 0xC0, 0x80, 0x00, 0x00, 0x00, 0x00, 0x80, 0xC0, 0xC0, 0xC0, 0x40, 0x00, 0x00, 0x01, 0x03, 0x07, 0xDF, 0xFF, 0xFE, 0xFC, 0xFC, 0xFF, 0xDF, 0x87, 0x03, 0x00, 0x00, 0x00, 0x10, 0x1C, 0x1E, 0x1F, 0x0F, 0x07, 0x01, 0x01, 0x03, 0x07, 0x1F, 0x1F, 0x1E, 0x1C, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // 'x'
+#endif
+#if FONT_HAS(16X26, 121)
+0x40, 0xC0, 0xC0, 0xC0, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0xC0, 0xC0, 0xC0, 0x00, 0x01, 0x07, 0x3F, 0xFF, 0xFF, 0xF8, 0xE0, 0x80, 0xC0, 0xF8, 0xFE, 0xFF, 0x3F, 0x07, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x83, 0xFF, 0xFF, 0xFF, 0x7F, 0x0F, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x02, 0x02, 0x03, 0x03, 0x03, 0x03, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // 'y'
+#endif
+#if FONT_HAS(16X26, 122)
+0x00, 0x00, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x80, 0xC0, 0xE0, 0xF0, 0xF8, 0x7C, 0x3E, 0x1F, 0x0F, 0x07, 0x03, 0x01, 0x00, 0x18, 0x1C, 0x1F, 0x1F, 0x1F, 0x1B, 0x19, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // 'z'
+#endif
+#if FONT_HAS(16X26, 123)
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3E, 0xFF, 0xFF, 0xFF, 0xC3, 0x01, 0x01, 0x01, 0x01, 0x00, 0x00, 0x00, 0x18, 0x18, 0x18, 0x18, 0x3C, 0xFF, 0xFF, 0xE7, 0x81, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7C, 0xFF, 0xFF, 0xFF, 0xC3, 0x80, 0x80, 0x80, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x00,  // '{'
+#endif
+#if FONT_HAS(16X26, 124)
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // '|'
+#endif
+#if FONT_HAS(16X26, 125)
+0x00, 0x00, 0x01, 0x01, 0x01, 0x01, 0x83, 0xFF, 0xFF, 0xFF, 0x3E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x81, 0xE7, 0xFF, 0xFF, 0x3C, 0x18, 0x18, 0x18, 0x18, 0x00, 0x00, 0x00, 0x80, 0x80, 0x80, 0x80, 0xC1, 0xFF, 0xFF, 0xFF, 0x7C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // '}'
+#endif
+#if FONT_HAS(16X26, 126)
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xC0, 0xF0, 0xF8, 0xF8, 0x18, 0x18, 0x38, 0x78, 0x70, 0xF0, 0xE0, 0xC0, 0xC0, 0xF8, 0xF8, 0x78, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // '~'
+#endif
+};
+
 #endif
 
+#ifdef ENABLE_FONT_7X10P
+
+#ifndef SSD1306_FONT_7X10P_GLYPHS
+#define SSD1306_FONT_7X10P_GLYPHS(c) 1
+#endif
+
+/**
+ * Proportional encoding for 7x10 font, generated from fontmap_7x10.
+ * Each glyph is made of 2 page(s) of as many bytes as its width.
+ */
+static const uint8_t fontcols_7x10p [] = {
+#if FONT_HAS(7X10P, 32)
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // sp
+#endif
+#if FONT_HAS(7X10P, 33)
+0xBF, 0x00, 0x00, 0x00,  // '!'
+#endif
+#if FONT_HAS(7X10P, 34)
+0x07, 0x00, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00,  // '"'
+#endif
+#if FONT_HAS(7X10P, 35)
+0xF4, 0x2F, 0x24, 0xF4, 0x2F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // '#'
+#endif
+#if FONT_HAS(7X10P, 36)
+0x66, 0x89, 0xFF, 0x89, 0x72, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,  // '$'
+#endif
+#if FONT_HAS(7X10P, 37)
+0x26, 0x19, 0x6E, 0x94, 0x62, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // '%'
+#endif
+#if FONT_HAS(7X10P, 38)
+0x60, 0x96, 0x99, 0x66, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // '&'
+#endif
+#if FONT_HAS(7X10P, 39)
+0x07, 0x00, 0x00, 0x00,  // '''
+#endif
+#if FONT_HAS(7X10P, 40)
+0xFC, 0x02, 0x01, 0x00, 0x00, 0x01, 0x02, 0x00,  // '('
+#endif
+#if FONT_HAS(7X10P, 41)
+0x01, 0x02, 0xFC, 0x00, 0x02, 0x01, 0x00, 0x00,  // ')'
+#endif
+#if FONT_HAS(7X10P, 42)
+0x0A, 0x07, 0x0A, 0x00, 0x00, 0x00, 0x00, 0x00,  // '*'
+#endif
+#if FONT_HAS(7X10P, 43)
+0x10, 0x10, 0x7C, 0x10, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // '+'
+#endif
+#if FONT_HAS(7X10P, 44)
+0x80, 0x00, 0x03, 0x00,  // ','
+#endif
+#if FONT_HAS(7X10P, 45)
+0x20, 0x20, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00,  // '-'
+#endif
+#if FONT_HAS(7X10P, 46)
+0x80, 0x00, 0x00, 0x00,  // '.'
+#endif
+#if FONT_HAS(7X10P, 47)
+0xC0, 0x3C, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00,  // '/'
+#endif
+#if FONT_HAS(7X10P, 48)
+0x7E, 0x81, 0x89, 0x81, 0x7E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // '0'
+#endif
+#if FONT_HAS(7X10P, 49)
+0x04, 0x02, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00,  // '1'
+#endif
+#if FONT_HAS(7X10P, 50)
+0x86, 0xC1, 0xA1, 0x91, 0x8E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // '2'
+#endif
+#if FONT_HAS(7X10P, 51)
+0x42, 0x81, 0x89, 0x89, 0x76, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // '3'
+#endif
+#if FONT_HAS(7X10P, 52)
+0x30, 0x2C, 0x22, 0xFF, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // '4'
+#endif
+#if FONT_HAS(7X10P, 53)
+0x4F, 0x89, 0x89, 0x89, 0x71, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // '5'
+#endif
+#if FONT_HAS(7X10P, 54)
+0x7E, 0x89, 0x89, 0x89, 0x72, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // '6'
+#endif
+#if FONT_HAS(7X10P, 55)
+0x01, 0xE1, 0x19, 0x05, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // '7'
+#endif
+#if FONT_HAS(7X10P, 56)
+0x76, 0x89, 0x89, 0x89, 0x76, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // '8'
+#endif
+#if FONT_HAS(7X10P, 57)
+0x4E, 0x91, 0x91, 0x91, 0x7E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // '9'
+#endif
+#if FONT_HAS(7X10P, 58)
+0x84, 0x00, 0x00, 0x00,  // ':'
+#endif
+#if FONT_HAS(7X10P, 59)
+0x88, 0x00, 0x03, 0x00,  // ';'
+#endif
+#if FONT_HAS(7X10P, 60)
+0x10, 0x28, 0x28, 0x44, 0x44, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // '<'
+#endif
+#if FONT_HAS(7X10P, 61)
+0x28, 0x28, 0x28, 0x28, 0x28, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // '='
+#endif
+#if FONT_HAS(7X10P, 62)
+0x44, 0x44, 0x28, 0x28, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // '>'
+#endif
+#if FONT_HAS(7X10P, 63)
+0x02, 0x01, 0xB1, 0x09, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // '?'
+#endif
+#if FONT_HAS(7X10P, 64)
+0x7E, 0x81, 0x99, 0x95, 0x1E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // '@'
+#endif
+#if FONT_HAS(7X10P, 65)
+0xE0, 0x3E, 0x21, 0x3E, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // 'A'
+#endif
+#if FONT_HAS(7X10P, 66)
+0xFF, 0x89, 0x89, 0x89, 0x76, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // 'B'
+#endif
+#if FONT_HAS(7X10P, 67)
+0x7E, 0x81, 0x81, 0x81, 0x42, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // 'C'
+#endif
+#if FONT_HAS(7X10P, 68)
+0xFF, 0x81, 0x81, 0x42, 0x3C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // 'D'
+#endif
+#if FONT_HAS(7X10P, 69)
+0xFF, 0x89, 0x89, 0x89, 0x89, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // 'E'
+#endif
+#if FONT_HAS(7X10P, 70)
+0xFF, 0x09, 0x09, 0x09, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // 'F'
+#endif
+#if FONT_HAS(7X10P, 71)
+0x7E, 0x81, 0x91, 0x91, 0x72, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // 'G'
+#endif
+#if FONT_HAS(7X10P, 72)
+0xFF, 0x08, 0x08, 0x08, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // 'H'
+#endif
+#if FONT_HAS(7X10P, 73)
+0x81, 0xFF, 0x81, 0x00, 0x00, 0x00, 0x00, 0x00,  // 'I'
+#endif
+#if FONT_HAS(7X10P, 74)
+0x40, 0x80, 0x80, 0x80, 0x7F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // 'J'
+#endif
+#if FONT_HAS(7X10P, 75)
+0xFF, 0x08, 0x14, 0x62, 0x81, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // 'K'
+#endif
+#if FONT_HAS(7X10P, 76)
+0xFF, 0x80, 0x80, 0x80, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // 'L'
+#endif
+#if FONT_HAS(7X10P, 77)
+0xFF, 0x06, 0x08, 0x06, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // 'M'
+#endif
+#if FONT_HAS(7X10P, 78)
+0xFF, 0x06, 0x18, 0x60, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // 'N'
+#endif
+#if FONT_HAS(7X10P, 79)
+0x7E, 0x81, 0x81, 0x81, 0x7E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // 'O'
+#endif
+#if FONT_HAS(7X10P, 80)
+0xFF, 0x11, 0x11, 0x11, 0x0E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // 'P'
+#endif
+#if FONT_HAS(7X10P, 81)
+0x7E, 0x81, 0xC1, 0x81, 0x7E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00,  // 'Q'
+#endif
+#if FONT_HAS(7X10P, 82)
+0xFF, 0x11, 0x11, 0x71, 0x8E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // 'R'
+#endif
+#if FONT_HAS(7X10P, 83)
+0x46, 0x89, 0x89, 0x91, 0x62, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // 'S'
+#endif
+#if FONT_HAS(7X10P, 84)
+0x01, 0x01, 0xFF, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // 'T'
+#endif
+#if FONT_HAS(7X10P, 85)
+0x7F, 0x80, 0x80, 0x80, 0x7F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // 'U'
+#endif
+#if FONT_HAS(7X10P, 86)
+0x07, 0x38, 0xC0, 0x38, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // 'V'
+#endif
+#if FONT_HAS(7X10P, 87)
+0x3F, 0xE0, 0x1C, 0xE0, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // 'W'
+#endif
+#if FONT_HAS(7X10P, 88)
+0x81, 0x66, 0x18, 0x66, 0x81, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // 'X'
+#endif
+#if FONT_HAS(7X10P, 89)
+0x03, 0x0C, 0xF0, 0x0C, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // 'Y'
+#endif
+#if FONT_HAS(7X10P, 90)
+0xC1, 0xA1, 0x99, 0x85, 0x83, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // 'Z'
+#endif
+#if FONT_HAS(7X10P, 91)
+0xFF, 0x01, 0x00, 0x03, 0x02, 0x00,  // '['
+#endif
+#if FONT_HAS(7X10P, 92)
+0x03, 0x3C, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00,  // '\'
+#endif
+#if FONT_HAS(7X10P, 93)
+0x01, 0xFF, 0x00, 0x02, 0x03, 0x00,  // ']'
+#endif
+#if FONT_HAS(7X10P, 94)
+0x08, 0x06, 0x01, 0x06, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // '^'
+#endif
+#if FONT_HAS(7X10P, 95)
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x00,  // '_'
+#endif
+#if FONT_HAS(7X10P, 96)
+0x01, 0x02, 0x00, 0x00, 0x00, 0x00,  // '`'
+#endif
+#if FONT_HAS(7X10P, 97)
+0x68, 0x94, 0x94, 0x54, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // 'a'
+#endif
+#if FONT_HAS(7X10P, 98)
+0xFF, 0x48, 0x84, 0x84, 0x78, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // 'b'
+#endif
+#if FONT_HAS(7X10P, 99)
+0x78, 0x84, 0x84, 0x84, 0x48, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // 'c'
+#endif
+#if FONT_HAS(7X10P, 100)
+0x78, 0x84, 0x84, 0x48, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // 'd'
+#endif
+#if FONT_HAS(7X10P, 101)
+0x78, 0x94, 0x94, 0x94, 0x58, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // 'e'
+#endif
+#if FONT_HAS(7X10P, 102)
+0x04, 0x04, 0xFE, 0x05, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // 'f'
+#endif
+#if FONT_HAS(7X10P, 103)
+0x78, 0x84, 0x84, 0x48, 0xFC, 0x00, 0x02, 0x02, 0x02, 0x02, 0x01, 0x00,  // 'g'
+#endif
+#if FONT_HAS(7X10P, 104)
+0xFF, 0x08, 0x04, 0x04, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // 'h'
+#endif
+#if FONT_HAS(7X10P, 105)
+0x04, 0x04, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00,  // 'i'
+#endif
+#if FONT_HAS(7X10P, 106)
+0x00, 0x04, 0x04, 0xFD, 0x00, 0x02, 0x02, 0x02, 0x01, 0x00,  // 'j'
+#endif
+#if FONT_HAS(7X10P, 107)
+0xFF, 0x10, 0x28, 0x44, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // 'k'
+#endif
+#if FONT_HAS(7X10P, 108)
+0x01, 0x01, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00,  // 'l'
+#endif
+#if FONT_HAS(7X10P, 109)
+0xFC, 0x04, 0xFC, 0x04, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // 'm'
+#endif
+#if FONT_HAS(7X10P, 110)
+0xFC, 0x08, 0x04, 0x04, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // 'n'
+#endif
+#if FONT_HAS(7X10P, 111)
+0x78, 0x84, 0x84, 0x84, 0x78, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // 'o'
+#endif
+#if FONT_HAS(7X10P, 112)
+0xFC, 0x48, 0x84, 0x84, 0x78, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00,  // 'p'
+#endif
+#if FONT_HAS(7X10P, 113)
+0x78, 0x84, 0x84, 0x48, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00,  // 'q'
+#endif
+#if FONT_HAS(7X10P, 114)
+0xFC, 0x08, 0x04, 0x04, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // 'r'
+#endif
+#if FONT_HAS(7X10P, 115)
+0x48, 0x94, 0x94, 0xA4, 0x48, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // 's'
+#endif
+#if FONT_HAS(7X10P, 116)
+0x04, 0x7F, 0x84, 0x84, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // 't'
+#endif
+#if FONT_HAS(7X10P, 117)
+0x7C, 0x80, 0x80, 0x40, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // 'u'
+#endif
+#if FONT_HAS(7X10P, 118)
+0x0C, 0x70, 0x80, 0x70, 0x0C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // 'v'
+#endif
+#if FONT_HAS(7X10P, 119)
+0x3C, 0xE0, 0x1C, 0xE0, 0x3C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // 'w'
+#endif
+#if FONT_HAS(7X10P, 120)
+0x84, 0x48, 0x30, 0x48, 0x84, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // 'x'
+#endif
+#if FONT_HAS(7X10P, 121)
+0x0C, 0x30, 0xC0, 0x30, 0x0C, 0x00, 0x02, 0x02, 0x01, 0x00, 0x00, 0x00,  // 'y'
+#endif
+#if FONT_HAS(7X10P, 122)
+0xC4, 0xA4, 0x94, 0x8C, 0x84, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // 'z'
+#endif
+#if FONT_HAS(7X10P, 123)
+0x30, 0xCF, 0x01, 0x00, 0x00, 0x03, 0x02, 0x00,  // '{'
+#endif
+#if FONT_HAS(7X10P, 124)
+0xFF, 0x00, 0x03, 0x00,  // '|'
+#endif
+#if FONT_HAS(7X10P, 125)
+0x01, 0xCF, 0x30, 0x00, 0x02, 0x03, 0x00, 0x00,  // '}'
+#endif
+#if FONT_HAS(7X10P, 126)
+0x18, 0x08, 0x08, 0x10, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // '~'
+#endif
+};
+
+/**
+ * Width in pixels of each glyph of 7x10p font, 0 if left out.
+ */
+static const uint8_t fontwidths_7x10p [] = {
+FONT_WIDTH(7X10P, 32, 3), FONT_WIDTH(7X10P, 33, 2), FONT_WIDTH(7X10P, 34, 4), FONT_WIDTH(7X10P, 35, 6), FONT_WIDTH(7X10P, 36, 6), FONT_WIDTH(7X10P, 37, 6),
+FONT_WIDTH(7X10P, 38, 6), FONT_WIDTH(7X10P, 39, 2), FONT_WIDTH(7X10P, 40, 4), FONT_WIDTH(7X10P, 41, 4), FONT_WIDTH(7X10P, 42, 4), FONT_WIDTH(7X10P, 43, 6),
+FONT_WIDTH(7X10P, 44, 2), FONT_WIDTH(7X10P, 45, 4), FONT_WIDTH(7X10P, 46, 2), FONT_WIDTH(7X10P, 47, 4), FONT_WIDTH(7X10P, 48, 6), FONT_WIDTH(7X10P, 49, 4),
+FONT_WIDTH(7X10P, 50, 6), FONT_WIDTH(7X10P, 51, 6), FONT_WIDTH(7X10P, 52, 6), FONT_WIDTH(7X10P, 53, 6), FONT_WIDTH(7X10P, 54, 6), FONT_WIDTH(7X10P, 55, 6),
+FONT_WIDTH(7X10P, 56, 6), FONT_WIDTH(7X10P, 57, 6), FONT_WIDTH(7X10P, 58, 2), FONT_WIDTH(7X10P, 59, 2), FONT_WIDTH(7X10P, 60, 6), FONT_WIDTH(7X10P, 61, 6),
+FONT_WIDTH(7X10P, 62, 6), FONT_WIDTH(7X10P, 63, 6), FONT_WIDTH(7X10P, 64, 6), FONT_WIDTH(7X10P, 65, 6), FONT_WIDTH(7X10P, 66, 6), FONT_WIDTH(7X10P, 67, 6),
+FONT_WIDTH(7X10P, 68, 6), FONT_WIDTH(7X10P, 69, 6), FONT_WIDTH(7X10P, 70, 6), FONT_WIDTH(7X10P, 71, 6), FONT_WIDTH(7X10P, 72, 6), FONT_WIDTH(7X10P, 73, 4),
+FONT_WIDTH(7X10P, 74, 6), FONT_WIDTH(7X10P, 75, 6), FONT_WIDTH(7X10P, 76, 6), FONT_WIDTH(7X10P, 77, 6), FONT_WIDTH(7X10P, 78, 6), FONT_WIDTH(7X10P, 79, 6),
+FONT_WIDTH(7X10P, 80, 6), FONT_WIDTH(7X10P, 81, 6), FONT_WIDTH(7X10P, 82, 6), FONT_WIDTH(7X10P, 83, 6), FONT_WIDTH(7X10P, 84, 6), FONT_WIDTH(7X10P, 85, 6),
+FONT_WIDTH(7X10P, 86, 6), FONT_WIDTH(7X10P, 87, 6), FONT_WIDTH(7X10P, 88, 6), FONT_WIDTH(7X10P, 89, 6), FONT_WIDTH(7X10P, 90, 6), FONT_WIDTH(7X10P, 91, 3),
+FONT_WIDTH(7X10P, 92, 4), FONT_WIDTH(7X10P, 93, 3), FONT_WIDTH(7X10P, 94, 6), FONT_WIDTH(7X10P, 95, 8), FONT_WIDTH(7X10P, 96, 3), FONT_WIDTH(7X10P, 97, 6),
+FONT_WIDTH(7X10P, 98, 6), FONT_WIDTH(7X10P, 99, 6), FONT_WIDTH(7X10P, 100, 6), FONT_WIDTH(7X10P, 101, 6), FONT_WIDTH(7X10P, 102, 6), FONT_WIDTH(7X10P, 103, 6),
+FONT_WIDTH(7X10P, 104, 6), FONT_WIDTH(7X10P, 105, 4), FONT_WIDTH(7X10P, 106, 5), FONT_WIDTH(7X10P, 107, 6), FONT_WIDTH(7X10P, 108, 4), FONT_WIDTH(7X10P, 109, 6),
+FONT_WIDTH(7X10P, 110, 6), FONT_WIDTH(7X10P, 111, 6), FONT_WIDTH(7X10P, 112, 6), FONT_WIDTH(7X10P, 113, 6), FONT_WIDTH(7X10P, 114, 6), FONT_WIDTH(7X10P, 115, 6),
+FONT_WIDTH(7X10P, 116, 5), FONT_WIDTH(7X10P, 117, 6), FONT_WIDTH(7X10P, 118, 6), FONT_WIDTH(7X10P, 119, 6), FONT_WIDTH(7X10P, 120, 6), FONT_WIDTH(7X10P, 121, 6),
+FONT_WIDTH(7X10P, 122, 6), FONT_WIDTH(7X10P, 123, 4), FONT_WIDTH(7X10P, 124, 2), FONT_WIDTH(7X10P, 125, 4), FONT_WIDTH(7X10P, 126, 6),
+};
+
+enum {
+FONT_7X10P_OFFSET_32 = 0,
+FONT_OFFSET_AFTER(7X10P, 33, 32, 6), FONT_OFFSET_AFTER(7X10P, 34, 33, 4), FONT_OFFSET_AFTER(7X10P, 35, 34, 8),
+FONT_OFFSET_AFTER(7X10P, 36, 35, 12), FONT_OFFSET_AFTER(7X10P, 37, 36, 12), FONT_OFFSET_AFTER(7X10P, 38, 37, 12),
+FONT_OFFSET_AFTER(7X10P, 39, 38, 12), FONT_OFFSET_AFTER(7X10P, 40, 39, 4), FONT_OFFSET_AFTER(7X10P, 41, 40, 8),
+FONT_OFFSET_AFTER(7X10P, 42, 41, 8), FONT_OFFSET_AFTER(7X10P, 43, 42, 8), FONT_OFFSET_AFTER(7X10P, 44, 43, 12),
+FONT_OFFSET_AFTER(7X10P, 45, 44, 4), FONT_OFFSET_AFTER(7X10P, 46, 45, 8), FONT_OFFSET_AFTER(7X10P, 47, 46, 4),
+FONT_OFFSET_AFTER(7X10P, 48, 47, 8), FONT_OFFSET_AFTER(7X10P, 49, 48, 12), FONT_OFFSET_AFTER(7X10P, 50, 49, 8),
+FONT_OFFSET_AFTER(7X10P, 51, 50, 12), FONT_OFFSET_AFTER(7X10P, 52, 51, 12), FONT_OFFSET_AFTER(7X10P, 53, 52, 12),
+FONT_OFFSET_AFTER(7X10P, 54, 53, 12), FONT_OFFSET_AFTER(7X10P, 55, 54, 12), FONT_OFFSET_AFTER(7X10P, 56, 55, 12),
+FONT_OFFSET_AFTER(7X10P, 57, 56, 12), FONT_OFFSET_AFTER(7X10P, 58, 57, 12), FONT_OFFSET_AFTER(7X10P, 59, 58, 4),
+FONT_OFFSET_AFTER(7X10P, 60, 59, 4), FONT_OFFSET_AFTER(7X10P, 61, 60, 12), FONT_OFFSET_AFTER(7X10P, 62, 61, 12),
+FONT_OFFSET_AFTER(7X10P, 63, 62, 12), FONT_OFFSET_AFTER(7X10P, 64, 63, 12), FONT_OFFSET_AFTER(7X10P, 65, 64, 12),
+FONT_OFFSET_AFTER(7X10P, 66, 65, 12), FONT_OFFSET_AFTER(7X10P, 67, 66, 12), FONT_OFFSET_AFTER(7X10P, 68, 67, 12),
+FONT_OFFSET_AFTER(7X10P, 69, 68, 12), FONT_OFFSET_AFTER(7X10P, 70, 69, 12), FONT_OFFSET_AFTER(7X10P, 71, 70, 12),
+FONT_OFFSET_AFTER(7X10P, 72, 71, 12), FONT_OFFSET_AFTER(7X10P, 73, 72, 12), FONT_OFFSET_AFTER(7X10P, 74, 73, 8),
+FONT_OFFSET_AFTER(7X10P, 75, 74, 12), FONT_OFFSET_AFTER(7X10P, 76, 75, 12), FONT_OFFSET_AFTER(7X10P, 77, 76, 12),
+FONT_OFFSET_AFTER(7X10P, 78, 77, 12), FONT_OFFSET_AFTER(7X10P, 79, 78, 12), FONT_OFFSET_AFTER(7X10P, 80, 79, 12),
+FONT_OFFSET_AFTER(7X10P, 81, 80, 12), FONT_OFFSET_AFTER(7X10P, 82, 81, 12), FONT_OFFSET_AFTER(7X10P, 83, 82, 12),
+FONT_OFFSET_AFTER(7X10P, 84, 83, 12), FONT_OFFSET_AFTER(7X10P, 85, 84, 12), FONT_OFFSET_AFTER(7X10P, 86, 85, 12),
+FONT_OFFSET_AFTER(7X10P, 87, 86, 12), FONT_OFFSET_AFTER(7X10P, 88, 87, 12), FONT_OFFSET_AFTER(7X10P, 89, 88, 12),
+FONT_OFFSET_AFTER(7X10P, 90, 89, 12), FONT_OFFSET_AFTER(7X10P, 91, 90, 12), FONT_OFFSET_AFTER(7X10P, 92, 91, 6),
+FONT_OFFSET_AFTER(7X10P, 93, 92, 8), FONT_OFFSET_AFTER(7X10P, 94, 93, 6), FONT_OFFSET_AFTER(7X10P, 95, 94, 12),
+FONT_OFFSET_AFTER(7X10P, 96, 95, 16), FONT_OFFSET_AFTER(7X10P, 97, 96, 6), FONT_OFFSET_AFTER(7X10P, 98, 97, 12),
+FONT_OFFSET_AFTER(7X10P, 99, 98, 12), FONT_OFFSET_AFTER(7X10P, 100, 99, 12), FONT_OFFSET_AFTER(7X10P, 101, 100, 12),
+FONT_OFFSET_AFTER(7X10P, 102, 101, 12), FONT_OFFSET_AFTER(7X10P, 103, 102, 12), FONT_OFFSET_AFTER(7X10P, 104, 103, 12),
+FONT_OFFSET_AFTER(7X10P, 105, 104, 12), FONT_OFFSET_AFTER(7X10P, 106, 105, 8), FONT_OFFSET_AFTER(7X10P, 107, 106, 10),
+FONT_OFFSET_AFTER(7X10P, 108, 107, 12), FONT_OFFSET_AFTER(7X10P, 109, 108, 8), FONT_OFFSET_AFTER(7X10P, 110, 109, 12),
+FONT_OFFSET_AFTER(7X10P, 111, 110, 12), FONT_OFFSET_AFTER(7X10P, 112, 111, 12), FONT_OFFSET_AFTER(7X10P, 113, 112, 12),
+FONT_OFFSET_AFTER(7X10P, 114, 113, 12), FONT_OFFSET_AFTER(7X10P, 115, 114, 12), FONT_OFFSET_AFTER(7X10P, 116, 115, 12),
+FONT_OFFSET_AFTER(7X10P, 117, 116, 10), FONT_OFFSET_AFTER(7X10P, 118, 117, 12), FONT_OFFSET_AFTER(7X10P, 119, 118, 12),
+FONT_OFFSET_AFTER(7X10P, 120, 119, 12), FONT_OFFSET_AFTER(7X10P, 121, 120, 12), FONT_OFFSET_AFTER(7X10P, 122, 121, 12),
+FONT_OFFSET_AFTER(7X10P, 123, 122, 12), FONT_OFFSET_AFTER(7X10P, 124, 123, 8), FONT_OFFSET_AFTER(7X10P, 125, 124, 4),
+FONT_OFFSET_AFTER(7X10P, 126, 125, 8),
+};
+
+/**
+ * Offset of each glyph of 7x10p font in fontcols_7x10p.
+ */
+static const uint16_t fontoffsets_7x10p [] = {
+FONT_7X10P_OFFSET_32, FONT_7X10P_OFFSET_33, FONT_7X10P_OFFSET_34, FONT_7X10P_OFFSET_35, FONT_7X10P_OFFSET_36, FONT_7X10P_OFFSET_37,
+FONT_7X10P_OFFSET_38, FONT_7X10P_OFFSET_39, FONT_7X10P_OFFSET_40, FONT_7X10P_OFFSET_41, FONT_7X10P_OFFSET_42, FONT_7X10P_OFFSET_43,
+FONT_7X10P_OFFSET_44, FONT_7X10P_OFFSET_45, FONT_7X10P_OFFSET_46, FONT_7X10P_OFFSET_47, FONT_7X10P_OFFSET_48, FONT_7X10P_OFFSET_49,
+FONT_7X10P_OFFSET_50, FONT_7X10P_OFFSET_51, FONT_7X10P_OFFSET_52, FONT_7X10P_OFFSET_53, FONT_7X10P_OFFSET_54, FONT_7X10P_OFFSET_55,
+FONT_7X10P_OFFSET_56, FONT_7X10P_OFFSET_57, FONT_7X10P_OFFSET_58, FONT_7X10P_OFFSET_59, FONT_7X10P_OFFSET_60, FONT_7X10P_OFFSET_61,
+FONT_7X10P_OFFSET_62, FONT_7X10P_OFFSET_63, FONT_7X10P_OFFSET_64, FONT_7X10P_OFFSET_65, FONT_7X10P_OFFSET_66, FONT_7X10P_OFFSET_67,
+FONT_7X10P_OFFSET_68, FONT_7X10P_OFFSET_69, FONT_7X10P_OFFSET_70, FONT_7X10P_OFFSET_71, FONT_7X10P_OFFSET_72, FONT_7X10P_OFFSET_73,
+FONT_7X10P_OFFSET_74, FONT_7X10P_OFFSET_75, FONT_7X10P_OFFSET_76, FONT_7X10P_OFFSET_77, FONT_7X10P_OFFSET_78, FONT_7X10P_OFFSET_79,
+FONT_7X10P_OFFSET_80, FONT_7X10P_OFFSET_81, FONT_7X10P_OFFSET_82, FONT_7X10P_OFFSET_83, FONT_7X10P_OFFSET_84, FONT_7X10P_OFFSET_85,
+FONT_7X10P_OFFSET_86, FONT_7X10P_OFFSET_87, FONT_7X10P_OFFSET_88, FONT_7X10P_OFFSET_89, FONT_7X10P_OFFSET_90, FONT_7X10P_OFFSET_91,
+FONT_7X10P_OFFSET_92, FONT_7X10P_OFFSET_93, FONT_7X10P_OFFSET_94, FONT_7X10P_OFFSET_95, FONT_7X10P_OFFSET_96, FONT_7X10P_OFFSET_97,
+FONT_7X10P_OFFSET_98, FONT_7X10P_OFFSET_99, FONT_7X10P_OFFSET_100, FONT_7X10P_OFFSET_101, FONT_7X10P_OFFSET_102, FONT_7X10P_OFFSET_103,
+FONT_7X10P_OFFSET_104, FONT_7X10P_OFFSET_105, FONT_7X10P_OFFSET_106, FONT_7X10P_OFFSET_107, FONT_7X10P_OFFSET_108, FONT_7X10P_OFFSET_109,
+FONT_7X10P_OFFSET_110, FONT_7X10P_OFFSET_111, FONT_7X10P_OFFSET_112, FONT_7X10P_OFFSET_113, FONT_7X10P_OFFSET_114, FONT_7X10P_OFFSET_115,
+FONT_7X10P_OFFSET_116, FONT_7X10P_OFFSET_117, FONT_7X10P_OFFSET_118, FONT_7X10P_OFFSET_119, FONT_7X10P_OFFSET_120, FONT_7X10P_OFFSET_121,
+FONT_7X10P_OFFSET_122, FONT_7X10P_OFFSET_123, FONT_7X10P_OFFSET_124, FONT_7X10P_OFFSET_125, FONT_7X10P_OFFSET_126,
+};
+
+#endif
+
+// END OF GENERATED FONTS
+
 
 /**
  * Single instance of 7x10 font.
@@ -351,7 +1858,9 @@ static const uint16_t fontmap_16x26 [] = {
 static const ssd1306_font_t font_7x10 = {
     .font_width  = 7,
     .font_height = 10,
-    .font_map    = (void*)fontmap_7x10
+    .font_map    = FONT_7X10_MAP,
+    .font_cols   = fontcols_7x10,
+    .glyph_index = FONT_7X10_INDEX
 };
 
 
@@ -363,7 +1872,9 @@ static const ssd1306_font_t font_7x10 = {
 static const ssd1306_font_t font_11x18 = {
     .font_width  = 11,
     .font_height = 18,
-    .font_map    = (void*)fontmap_11x18
+    .font_map    = FONT_11X18_MAP,
+    .font_cols   = fontcols_11x18,
+    .glyph_index = FONT_11X18_INDEX
 };
 
 #endif
@@ -377,7 +1888,26 @@ static const ssd1306_font_t font_11x18 = {
 static const ssd1306_font_t font_16x26 = {
     .font_width  = 16,
     .font_height = 26,
-    .font_map    = (void*)fontmap_16x26
+    .font_map    = FONT_16X26_MAP,
+    .font_cols   = fontcols_16x26,
+    .glyph_index = FONT_16X26_INDEX
+};
+
+#endif
+
+
+#ifdef ENABLE_FONT_7X10P
+
+/**
+ * Single instance of proportional 7x10 font.
+ */
+static const ssd1306_font_t font_7x10p = {
+    .font_width    = 8,
+    .font_height   = 10,
+    .font_map      = NULL,
+    .font_cols     = fontcols_7x10p,
+    .glyph_widths  = fontwidths_7x10p,
+    .glyph_offsets = fontoffsets_7x10p
 };
 
 #endif
@@ -395,6 +1925,9 @@ const ssd1306_font_t * get_font_ptr(ssd1306_font_name_t font_name) {
 #endif
 #ifdef ENABLE_FONT_16X26
         case FONT_16X26: return &font_16x26; break;
+#endif
+#ifdef ENABLE_FONT_7X10P
+        case FONT_7X10P: return &font_7x10p; break;
 #endif
         default: return NULL;
     }
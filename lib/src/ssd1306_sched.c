@@ -0,0 +1,249 @@
+/**
+ * @file   ssd1306_sched.c
+ * @brief  SSD1306 OLED display C library.
+ *
+ * @copyright
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  any later version.
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ *  GNU General Public License for more details.
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program. If not, see <http://www.gnu.org/licenses/>.
+ *
+ * @author Giovanni Scotti
+ */
+
+
+#include <string.h> // for memset.
+#include "ssd1306_sched.h"
+
+
+#ifdef SSD1306_ENABLE_ASYNC
+
+///////////////////////////////////////////////////////////
+///////////////////////////////////////////////////////////
+// PRIVATE FUNCTIONS
+///////////////////////////////////////////////////////////
+///////////////////////////////////////////////////////////
+
+static void
+ssd1306_sched_complete(ssd1306_status_t status, void *ctx);
+
+
+/**
+ * Returns the slot of the given display.
+ *
+ * @param  sched_ptr   a pointer to a ssd1306_sched_t structure.
+ * @param  ssd1306_ptr a pointer to a ssd1306_t structure.
+ * @return the index of the slot, num_slots if the display is unknown.
+ */
+static uint8_t
+ssd1306_sched_find(const ssd1306_sched_t *sched_ptr,
+        const ssd1306_t *ssd1306_ptr) {
+
+    uint8_t s = 0;
+
+    while (s < sched_ptr->num_slots && sched_ptr->slots[s].display != ssd1306_ptr)
+        s++;
+
+    return s;
+}
+
+
+/**
+ * Notifies the user about the end of a frame.
+ *
+ * @param  slot_ptr the slot of the display.
+ * @param  status   the outcome of the frame.
+ */
+static void
+ssd1306_sched_notify(ssd1306_sched_slot_t *slot_ptr, ssd1306_status_t status) {
+
+    slot_ptr->last_status = status;
+    if (slot_ptr->sched->callback != NULL)
+        slot_ptr->sched->callback(status, slot_ptr->display);
+}
+
+
+/**
+ * Starts the frame of the next queued display of the given bus, in
+ * round-robin order. The bus must have been claimed by the caller: it
+ * is released if there is nothing left to be sent.
+ * Frames of clean displays are over right away.
+ *
+ * @param  sched_ptr a pointer to a ssd1306_sched_t structure.
+ * @param  bus       the index of the bus.
+ */
+static void
+ssd1306_sched_next(ssd1306_sched_t *sched_ptr, uint8_t bus) {
+
+    ssd1306_sched_bus_t *bus_ptr = &sched_ptr->buses[bus];
+
+    for (uint8_t n = 0; n < sched_ptr->num_slots; n++) {
+        ssd1306_sched_slot_t *slot_ptr = &sched_ptr->slots[bus_ptr->cursor];
+
+        bus_ptr->cursor = (bus_ptr->cursor + 1) % sched_ptr->num_slots;
+        if (slot_ptr->bus != bus || !slot_ptr->queued)
+            continue;
+
+        slot_ptr->queued = false;
+        if (!ssd1306_is_dirty(slot_ptr->display)) {
+            ssd1306_sched_notify(slot_ptr, SSD1306_OK);
+            continue;
+        }
+
+        // Since the display is dirty, a started frame always ends with
+        // a call to ssd1306_sched_complete.
+        ssd1306_status_t status = ssd1306_update_dirty_async(
+                slot_ptr->display, ssd1306_sched_complete, slot_ptr);
+        if (status == SSD1306_OK) return;
+
+        ssd1306_sched_notify(slot_ptr, status);
+    }
+
+    bus_ptr->active = false;
+}
+
+
+/**
+ * Claims the given bus and starts its next frame, unless a frame is
+ * already being sent: in that case the bus will be served by the
+ * completion of the ongoing frame.
+ *
+ * @param  sched_ptr a pointer to a ssd1306_sched_t structure.
+ * @param  bus       the index of the bus.
+ */
+static void
+ssd1306_sched_kick(ssd1306_sched_t *sched_ptr, uint8_t bus) {
+
+    if (sched_ptr->buses[bus].active) return;
+
+    sched_ptr->buses[bus].active = true;
+    ssd1306_sched_next(sched_ptr, bus);
+}
+
+
+/**
+ * Completion callback of the frames started by the scheduler. The next
+ * frame of the same bus is started right away, so that displays sharing
+ * a channel are served back to back.
+ *
+ * @param status the outcome of the frame.
+ * @param ctx    the slot of the display.
+ */
+static void
+ssd1306_sched_complete(ssd1306_status_t status, void *ctx) {
+
+    ssd1306_sched_slot_t *slot_ptr = (ssd1306_sched_slot_t *)ctx;
+
+    ssd1306_sched_notify(slot_ptr, status);
+    ssd1306_sched_next(slot_ptr->sched, slot_ptr->bus);
+}
+
+
+///////////////////////////////////////////////////////////
+///////////////////////////////////////////////////////////
+// PUBLIC API
+///////////////////////////////////////////////////////////
+///////////////////////////////////////////////////////////
+
+ssd1306_status_t
+ssd1306_sched_init(ssd1306_sched_t *sched_ptr, ssd1306_callback_t callback) {
+
+    if (sched_ptr == NULL) return SSD1306_WRONG_PARAMS;
+
+    memset(sched_ptr, 0, sizeof(ssd1306_sched_t));
+    sched_ptr->callback = callback;
+    return SSD1306_OK;
+}
+
+
+ssd1306_status_t
+ssd1306_sched_add(ssd1306_sched_t *sched_ptr, ssd1306_t *ssd1306_ptr) {
+
+    if (ssd1306_ptr == NULL || ssd1306_ptr->initialized == false)
+        return SSD1306_NOINIT;
+    if (sched_ptr->num_slots == SSD1306_SCHED_MAX_DISPLAYS ||
+            ssd1306_sched_find(sched_ptr, ssd1306_ptr) != sched_ptr->num_slots)
+        return SSD1306_WRONG_PARAMS;
+
+    // Displays are grouped by i2c channel.
+    uint8_t bus = 0;
+    while (bus < sched_ptr->num_buses &&
+            sched_ptr->buses[bus].channel != ssd1306_ptr->i2c_channel)
+        bus++;
+
+    if (bus == sched_ptr->num_buses) {
+        sched_ptr->buses[bus].channel = ssd1306_ptr->i2c_channel;
+        sched_ptr->buses[bus].cursor  = 0;
+        sched_ptr->buses[bus].active  = false;
+        sched_ptr->num_buses++;
+    }
+
+    ssd1306_sched_slot_t *slot_ptr = &sched_ptr->slots[sched_ptr->num_slots];
+    slot_ptr->display     = ssd1306_ptr;
+    slot_ptr->sched       = sched_ptr;
+    slot_ptr->bus         = bus;
+    slot_ptr->queued      = false;
+    slot_ptr->last_status = SSD1306_OK;
+    sched_ptr->num_slots++;
+
+    return SSD1306_OK;
+}
+
+
+ssd1306_status_t
+ssd1306_sched_submit(ssd1306_sched_t *sched_ptr, ssd1306_t *ssd1306_ptr) {
+
+    uint8_t s = ssd1306_sched_find(sched_ptr, ssd1306_ptr);
+    if (s == sched_ptr->num_slots) return SSD1306_WRONG_PARAMS;
+
+    sched_ptr->slots[s].queued = true;
+    ssd1306_sched_kick(sched_ptr, sched_ptr->slots[s].bus);
+    return SSD1306_OK;
+}
+
+
+ssd1306_status_t
+ssd1306_sched_submit_all(ssd1306_sched_t *sched_ptr) {
+
+    // All the frames are queued before any bus is started, so that each
+    // bus serves its displays back to back.
+    for (uint8_t s = 0; s < sched_ptr->num_slots; s++) {
+        if (ssd1306_is_dirty(sched_ptr->slots[s].display))
+            sched_ptr->slots[s].queued = true;
+    }
+
+    for (uint8_t bus = 0; bus < sched_ptr->num_buses; bus++)
+        ssd1306_sched_kick(sched_ptr, bus);
+
+    return SSD1306_OK;
+}
+
+
+bool
+ssd1306_sched_is_pending(const ssd1306_sched_t *sched_ptr,
+        const ssd1306_t *ssd1306_ptr) {
+
+    uint8_t s = ssd1306_sched_find(sched_ptr, ssd1306_ptr);
+    if (s == sched_ptr->num_slots) return false;
+
+    return sched_ptr->slots[s].queued || ssd1306_is_busy(ssd1306_ptr);
+}
+
+
+bool
+ssd1306_sched_is_idle(const ssd1306_sched_t *sched_ptr) {
+
+    for (uint8_t bus = 0; bus < sched_ptr->num_buses; bus++) {
+        if (sched_ptr->buses[bus].active) return false;
+    }
+
+    return true;
+}
+
+#endif
@@ -0,0 +1,222 @@
+/**
+ * @file   ssd1306_spi.c
+ * @brief  SSD1306 OLED display C library.
+ *
+ * @copyright
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  any later version.
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ *  GNU General Public License for more details.
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program. If not, see <http://www.gnu.org/licenses/>.
+ *
+ * @author Giovanni Scotti
+ */
+
+
+
+#include "ssd1306_spi.h"
+
+
+#ifdef SSD1306_ENABLE_SPI
+
+#define SSD1306_SPI_CONTROL_DC 0x40 /// Data/command bit of a control byte.
+
+
+///////////////////////////////////////////////////////////
+///////////////////////////////////////////////////////////
+// PRIVATE FUNCTIONS
+///////////////////////////////////////////////////////////
+///////////////////////////////////////////////////////////
+
+// Defined in ssd1306_config.h. Initializes the given spi peripheral and
+// resets the display. It is called by ssd1306_init_spi for each display,
+// hence it must tolerate being called more than once for the same channel.
+extern ssd1306_status_t
+ssd1306_spi_init(uint8_t channel);
+
+// Defined in ssd1306_config.h. Sends the given bytes with the D/C line
+// high if data is true (display ram bytes), low otherwise (command bytes).
+extern ssd1306_status_t
+ssd1306_spi_write(uint8_t channel, bool data,
+        const uint8_t *data_ptr, size_t data_size);
+
+#ifdef SSD1306_ENABLE_ASYNC
+// Defined in ssd1306_config.h. Starts a non-blocking version of
+// ssd1306_spi_write. The buffer stays valid until the port calls
+// ssd1306_spi_write_async_complete with the given context, which
+// must happen after returning.
+extern ssd1306_status_t
+ssd1306_spi_write_async(uint8_t channel, bool data,
+        const uint8_t *data_ptr, size_t data_size, void *ctx);
+#endif
+
+
+/**
+ * Strips the control bytes from the header of a transaction. The header
+ * is made of pairs of single command control byte and command byte,
+ * followed by one control byte.
+ *
+ * @param  header_ptr  the header bytes, ending with a control byte.
+ * @param  header_size the size of the header in bytes.
+ * @param  cmd         on output, the SSD1306_SPI_MAX_HEADER_CMDS command
+ *                     bytes at most of the header.
+ * @param  cmd_size    on output, the number of command bytes.
+ * @return the outcome of the function call.
+ */
+static ssd1306_status_t
+ssd1306_spi_strip(const uint8_t *header_ptr, size_t header_size,
+        uint8_t *cmd, size_t *cmd_size) {
+
+    *cmd_size = header_size / 2;
+    if (*cmd_size > SSD1306_SPI_MAX_HEADER_CMDS)
+        return SSD1306_WRONG_PARAMS;
+
+    for (size_t i = 0; i < *cmd_size; i++)
+        cmd[i] = header_ptr[2 * i + 1];
+
+    return SSD1306_OK;
+}
+
+
+/**
+ * Tells whether the data bytes following the given header are display
+ * ram bytes, according to the final control byte of the header.
+ *
+ * @param  header_ptr  the header bytes, ending with a control byte.
+ * @param  header_size the size of the header in bytes.
+ * @return true for display ram bytes, false for command bytes.
+ */
+static inline bool
+ssd1306_spi_is_data(const uint8_t *header_ptr, size_t header_size) {
+
+    return (header_ptr[header_size - 1] & SSD1306_SPI_CONTROL_DC) != 0;
+}
+
+
+static ssd1306_status_t
+ssd1306_spi_transport_init(void *ctx) {
+
+    const ssd1306_t *ssd1306_ptr = (const ssd1306_t *)ctx;
+    return ssd1306_spi_init(ssd1306_ptr->i2c_channel);
+}
+
+
+static size_t
+ssd1306_spi_transport_max_transfer_size(void *ctx) {
+
+    (void)ctx;
+    return 0;
+}
+
+
+static ssd1306_status_t
+ssd1306_spi_transport_write_v(void *ctx,
+        const uint8_t *header_ptr, size_t header_size,
+        const uint8_t *data_ptr, size_t data_size) {
+
+    const ssd1306_t *ssd1306_ptr = (const ssd1306_t *)ctx;
+    ssd1306_status_t status;
+    uint8_t cmd[SSD1306_SPI_MAX_HEADER_CMDS];
+    size_t cmd_size;
+
+    status = ssd1306_spi_strip(header_ptr, header_size, cmd, &cmd_size);
+    if (status != SSD1306_OK) return status;
+
+    if (cmd_size != 0) {
+        status = ssd1306_spi_write(ssd1306_ptr->i2c_channel, false,
+                cmd, cmd_size);
+        if (status != SSD1306_OK) return status;
+    }
+
+    if (data_size == 0)
+        return SSD1306_OK;
+
+    return ssd1306_spi_write(ssd1306_ptr->i2c_channel,
+            ssd1306_spi_is_data(header_ptr, header_size), data_ptr, data_size);
+}
+
+
+#ifdef SSD1306_ENABLE_ASYNC
+static ssd1306_status_t
+ssd1306_spi_transport_write_async(void *ctx,
+        const uint8_t *header_ptr, size_t header_size,
+        const uint8_t *data_ptr, size_t data_size, void *complete_ctx) {
+
+    ssd1306_t *ssd1306_ptr = (ssd1306_t *)ctx;
+    ssd1306_status_t status;
+    size_t cmd_size;
+
+    // The command bytes are sent first, with the D/C line low, by a
+    // transfer of their own: its completion starts the data bytes (see
+    // ssd1306_spi_write_async_complete), so that nothing blocks.
+    status = ssd1306_spi_strip(header_ptr, header_size,
+            ssd1306_ptr->spi_cmd, &cmd_size);
+    if (status != SSD1306_OK) return status;
+
+    ssd1306_ptr->spi_data         = ssd1306_spi_is_data(header_ptr, header_size);
+    ssd1306_ptr->spi_data_ptr     = data_ptr;
+    ssd1306_ptr->spi_data_size    = data_size;
+    ssd1306_ptr->spi_complete_ctx = complete_ctx;
+
+    if (cmd_size == 0) {
+        ssd1306_ptr->spi_data_size = 0;
+        return ssd1306_spi_write_async(ssd1306_ptr->i2c_channel,
+                ssd1306_ptr->spi_data, data_ptr, data_size, ssd1306_ptr);
+    }
+
+    return ssd1306_spi_write_async(ssd1306_ptr->i2c_channel, false,
+            ssd1306_ptr->spi_cmd, cmd_size, ssd1306_ptr);
+}
+#endif
+
+
+///////////////////////////////////////////////////////////
+///////////////////////////////////////////////////////////
+// PUBLIC API
+///////////////////////////////////////////////////////////
+///////////////////////////////////////////////////////////
+
+const ssd1306_transport_t ssd1306_spi_transport = {
+    .init              = ssd1306_spi_transport_init,
+    .max_transfer_size = ssd1306_spi_transport_max_transfer_size,
+    .write_v           = ssd1306_spi_transport_write_v,
+#ifdef SSD1306_ENABLE_ASYNC
+    .write_async       = ssd1306_spi_transport_write_async,
+#endif
+};
+
+
+ssd1306_status_t
+ssd1306_init_spi(ssd1306_t *ssd1306_ptr, uint8_t spi_channel, bool warm) {
+
+    return ssd1306_init_transport(ssd1306_ptr, &ssd1306_spi_transport,
+            ssd1306_ptr, spi_channel, warm);
+}
+
+
+#ifdef SSD1306_ENABLE_ASYNC
+void
+ssd1306_spi_write_async_complete(void *ctx, ssd1306_status_t status) {
+
+    ssd1306_t *ssd1306_ptr = (ssd1306_t *)ctx;
+    size_t data_size = ssd1306_ptr->spi_data_size;
+
+    // The command bytes are over: the data bytes follow.
+    if (status == SSD1306_OK && data_size != 0) {
+        ssd1306_ptr->spi_data_size = 0;
+        status = ssd1306_spi_write_async(ssd1306_ptr->i2c_channel,
+                ssd1306_ptr->spi_data, ssd1306_ptr->spi_data_ptr, data_size,
+                ssd1306_ptr);
+        if (status == SSD1306_OK) return;
+    }
+
+    ssd1306_i2c_write_async_complete(ssd1306_ptr->spi_complete_ctx, status);
+}
+#endif
+
+#endif
@@ -0,0 +1,407 @@
+/**
+ * @file   ssd1306_sprites.c
+ * @brief  SSD1306 OLED display C library.
+ *
+ * @copyright
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  any later version.
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ *  GNU General Public License for more details.
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program. If not, see <http://www.gnu.org/licenses/>.
+ *
+ * @author Giovanni Scotti
+ */
+
+
+#include <string.h> // for memset.
+#include "ssd1306_sprites.h"
+
+
+#ifndef SSD1306_ENABLE_PAGE_MODE
+
+#define MIN(a, b) ((a) < (b) ? (a) : (b)) /// Computes the minimum of a and b.
+#define MAX(a, b) ((a) > (b) ? (a) : (b)) /// Computes the maximum of a and b.
+
+
+/**
+ * Rectangle of the display, from (x0, y0) to (x1, y1) both included.
+ */
+typedef struct {
+    int16_t x0; /*!< First column. */
+    int16_t y0; /*!< First row. */
+    int16_t x1; /*!< Last column. */
+    int16_t y1; /*!< Last row. */
+} ssd1306_sprites_rect_t;
+
+
+///////////////////////////////////////////////////////////
+///////////////////////////////////////////////////////////
+// PRIVATE FUNCTIONS
+///////////////////////////////////////////////////////////
+///////////////////////////////////////////////////////////
+
+/**
+ * Returns a pointer to the given sprite, NULL if the index is out of range.
+ *
+ * @param  sprites_ptr a pointer to a ssd1306_sprites_t structure.
+ * @param  id          the index of the sprite.
+ * @return a pointer to the sprite or NULL.
+ */
+static inline ssd1306_sprite_t *
+ssd1306_sprites_get(ssd1306_sprites_t *sprites_ptr, uint8_t id) {
+
+    return (id < SSD1306_SPRITES_MAX) ? &sprites_ptr->sprites[id] : NULL;
+}
+
+
+/**
+ * Computes the bounds of the given sprite at its current position,
+ * clipped to the display.
+ *
+ * @param  sprite a pointer to a ssd1306_sprite_t structure.
+ * @param  rect   on output, the bounds of the sprite.
+ * @return false if the sprite does not lie on the display.
+ */
+static bool
+ssd1306_sprites_bounds(const ssd1306_sprite_t *sprite,
+        ssd1306_sprites_rect_t *rect) {
+
+    rect->x0 = MAX(sprite->x, 0);
+    rect->y0 = MAX(sprite->y, 0);
+    rect->x1 = MIN(sprite->x + sprite->w - 1, SSD1306_PXL_WIDTH - 1);
+    rect->y1 = MIN(sprite->y + sprite->h - 1, SSD1306_PXL_HEIGHT - 1);
+
+    return rect->x0 <= rect->x1 && rect->y0 <= rect->y1;
+}
+
+
+/**
+ * Returns whether two rectangles overlap.
+ *
+ * @param  a a pointer to the first rectangle.
+ * @param  b a pointer to the second rectangle.
+ * @return true if at least one pixel belongs to both.
+ */
+static inline bool
+ssd1306_sprites_overlap(const ssd1306_sprites_rect_t *a,
+        const ssd1306_sprites_rect_t *b) {
+
+    return a->x0 <= b->x1 && b->x0 <= a->x1 && a->y0 <= b->y1 && b->y0 <= a->y1;
+}
+
+
+/**
+ * Adds a rectangle to the areas to be restored, merging it with the ones
+ * it overlaps: the pixels they share are then redrawn only once.
+ *
+ * @param areas     the areas to be restored.
+ * @param num_areas the number of areas, updated on output.
+ * @param rect      the rectangle to be added.
+ */
+static void
+ssd1306_sprites_add_area(ssd1306_sprites_rect_t *areas, uint8_t *num_areas,
+        ssd1306_sprites_rect_t rect) {
+
+    uint8_t i = 0;
+
+    // The bounding box of merged areas may overlap further ones.
+    while (i < *num_areas) {
+        if (!ssd1306_sprites_overlap(&areas[i], &rect)) {
+            i++;
+            continue;
+        }
+
+        rect.x0 = MIN(rect.x0, areas[i].x0);
+        rect.y0 = MIN(rect.y0, areas[i].y0);
+        rect.x1 = MAX(rect.x1, areas[i].x1);
+        rect.y1 = MAX(rect.y1, areas[i].y1);
+        areas[i] = areas[--(*num_areas)];
+        i = 0;
+    }
+
+    areas[(*num_areas)++] = rect;
+}
+
+
+/**
+ * Draws the given sprite at its position. Masked sprites are drawn in two
+ * passes: the mask clears the pixels of the sprite, then the bitmap sets
+ * its white ones.
+ *
+ * @param  ssd1306_ptr a pointer to a ssd1306_t structure.
+ * @param  sprite      a pointer to the sprite to be drawn.
+ * @return the outcome of the function call.
+ */
+static ssd1306_status_t
+ssd1306_sprites_draw(ssd1306_t *ssd1306_ptr, const ssd1306_sprite_t *sprite) {
+
+    ssd1306_status_t status;
+
+    ssd1306_ptr->origin_x = sprite->x;
+    ssd1306_ptr->origin_y = sprite->y;
+
+    if (sprite->mask == NULL) {
+        ssd1306_ptr->rop = SSD1306_ROP_COPY;
+        return ssd1306_draw_page_bitmap(ssd1306_ptr, 0, 0, sprite->bitmap,
+                sprite->w, sprite->h, SSD1306_COLOR_WHITE, SSD1306_TEXT_OPAQUE);
+    }
+
+    ssd1306_ptr->rop = SSD1306_ROP_AND_NOT;
+    status = ssd1306_draw_page_bitmap(ssd1306_ptr, 0, 0, sprite->mask,
+            sprite->w, sprite->h, SSD1306_COLOR_WHITE, SSD1306_TEXT_TRANSPARENT);
+    if (status != SSD1306_OK) return status;
+
+    ssd1306_ptr->rop = SSD1306_ROP_OR;
+    return ssd1306_draw_page_bitmap(ssd1306_ptr, 0, 0, sprite->bitmap,
+            sprite->w, sprite->h, SSD1306_COLOR_WHITE, SSD1306_TEXT_TRANSPARENT);
+}
+
+
+/**
+ * Restores the background within the given area, then draws the visible
+ * sprites overlapping it.
+ *
+ * @param  sprites_ptr a pointer to a ssd1306_sprites_t structure.
+ * @param  area        the area to be redrawn, within the display.
+ * @return the outcome of the function call.
+ */
+static ssd1306_status_t
+ssd1306_sprites_redraw(ssd1306_sprites_t *sprites_ptr,
+        const ssd1306_sprites_rect_t *area) {
+
+    ssd1306_status_t status;
+    ssd1306_t *ssd1306_ptr = sprites_ptr->display;
+    ssd1306_sprites_rect_t bounds;
+
+    status = ssd1306_set_clip(ssd1306_ptr, area->x0, area->y0,
+            area->x1 - area->x0 + 1, area->y1 - area->y0 + 1);
+    if (status != SSD1306_OK) return status;
+
+    // The background is drawn from the default drawing state, every time.
+    ssd1306_ptr->x_pos     = 0;
+    ssd1306_ptr->y_pos     = 0;
+    ssd1306_ptr->origin_x  = 0;
+    ssd1306_ptr->origin_y  = 0;
+    ssd1306_ptr->rop       = SSD1306_ROP_COPY;
+    ssd1306_ptr->text_mode = SSD1306_TEXT_OPAQUE;
+
+    if (sprites_ptr->background != NULL)
+        status = sprites_ptr->background(ssd1306_ptr,
+                sprites_ptr->background_ctx);
+    else
+        status = ssd1306_draw_fill(ssd1306_ptr, SSD1306_COLOR_BLACK);
+    if (status != SSD1306_OK) return status;
+
+    for (uint8_t id = 0; id < SSD1306_SPRITES_MAX; id++) {
+        const ssd1306_sprite_t *sprite = &sprites_ptr->sprites[id];
+
+        if (sprite->bitmap == NULL || !sprite->visible) continue;
+        if (!ssd1306_sprites_bounds(sprite, &bounds) ||
+                !ssd1306_sprites_overlap(&bounds, area))
+            continue;
+
+        status = ssd1306_sprites_draw(ssd1306_ptr, sprite);
+        if (status != SSD1306_OK) return status;
+    }
+
+    return SSD1306_OK;
+}
+
+
+///////////////////////////////////////////////////////////
+///////////////////////////////////////////////////////////
+// PUBLIC API
+///////////////////////////////////////////////////////////
+///////////////////////////////////////////////////////////
+
+ssd1306_status_t
+ssd1306_sprites_init(ssd1306_sprites_t *sprites_ptr, ssd1306_t *ssd1306_ptr,
+        ssd1306_draw_cb_t background, void *background_ctx) {
+
+    if (ssd1306_ptr == NULL || ssd1306_ptr->initialized == false)
+        return SSD1306_NOINIT;
+
+    memset(sprites_ptr, 0, sizeof(ssd1306_sprites_t));
+    sprites_ptr->display        = ssd1306_ptr;
+    sprites_ptr->background     = background;
+    sprites_ptr->background_ctx = background_ctx;
+
+    return SSD1306_OK;
+}
+
+
+ssd1306_status_t
+ssd1306_sprites_set(ssd1306_sprites_t *sprites_ptr, uint8_t id,
+        const uint8_t *bitmap, const uint8_t *mask, uint8_t w, uint8_t h,
+        int16_t x, int16_t y) {
+
+    ssd1306_sprite_t *sprite = ssd1306_sprites_get(sprites_ptr, id);
+
+    if (sprite == NULL || (bitmap != NULL && (w == 0 || h == 0)))
+        return SSD1306_WRONG_PARAMS;
+
+    // A removed sprite is no longer drawn, but its bounds are restored.
+    sprite->bitmap  = bitmap;
+    sprite->mask    = mask;
+    sprite->w       = w;
+    sprite->h       = h;
+    sprite->x       = x;
+    sprite->y       = y;
+    sprite->visible = (bitmap != NULL);
+    sprite->changed = true;
+
+    return SSD1306_OK;
+}
+
+
+ssd1306_status_t
+ssd1306_sprites_move(ssd1306_sprites_t *sprites_ptr, uint8_t id,
+        int16_t x, int16_t y) {
+
+    ssd1306_sprite_t *sprite = ssd1306_sprites_get(sprites_ptr, id);
+
+    if (sprite == NULL || sprite->bitmap == NULL)
+        return SSD1306_WRONG_PARAMS;
+    if (sprite->x == x && sprite->y == y)
+        return SSD1306_OK;
+
+    sprite->x       = x;
+    sprite->y       = y;
+    sprite->changed = true;
+
+    return SSD1306_OK;
+}
+
+
+ssd1306_status_t
+ssd1306_sprites_show(ssd1306_sprites_t *sprites_ptr, uint8_t id, bool visible) {
+
+    ssd1306_sprite_t *sprite = ssd1306_sprites_get(sprites_ptr, id);
+
+    if (sprite == NULL || sprite->bitmap == NULL)
+        return SSD1306_WRONG_PARAMS;
+    if (sprite->visible == visible)
+        return SSD1306_OK;
+
+    sprite->visible = visible;
+    sprite->changed = true;
+
+    return SSD1306_OK;
+}
+
+
+ssd1306_status_t
+ssd1306_sprites_touch(ssd1306_sprites_t *sprites_ptr, uint8_t id) {
+
+    ssd1306_sprite_t *sprite = ssd1306_sprites_get(sprites_ptr, id);
+
+    if (sprite == NULL || sprite->bitmap == NULL)
+        return SSD1306_WRONG_PARAMS;
+
+    sprite->changed = true;
+    return SSD1306_OK;
+}
+
+
+void
+ssd1306_sprites_invalidate(ssd1306_sprites_t *sprites_ptr) {
+
+    for (uint8_t id = 0; id < SSD1306_SPRITES_MAX; id++) {
+        ssd1306_sprite_t *sprite = &sprites_ptr->sprites[id];
+
+        sprite->drawn   = false;
+        sprite->changed = (sprite->bitmap != NULL && sprite->visible);
+    }
+}
+
+
+ssd1306_status_t
+ssd1306_sprites_compose(ssd1306_sprites_t *sprites_ptr) {
+
+    ssd1306_status_t status = SSD1306_OK;
+    ssd1306_t *ssd1306_ptr = sprites_ptr->display;
+    ssd1306_sprites_rect_t areas[2 * SSD1306_SPRITES_MAX], rect;
+    uint8_t num_areas = 0;
+
+    // The old and the new bounds of each changed sprite are restored.
+    for (uint8_t id = 0; id < SSD1306_SPRITES_MAX; id++) {
+        const ssd1306_sprite_t *sprite = &sprites_ptr->sprites[id];
+
+        if (!sprite->changed) continue;
+
+        if (sprite->drawn) {
+            rect.x0 = sprite->drawn_x0;
+            rect.y0 = sprite->drawn_y0;
+            rect.x1 = sprite->drawn_x1;
+            rect.y1 = sprite->drawn_y1;
+            ssd1306_sprites_add_area(areas, &num_areas, rect);
+        }
+        if (sprite->bitmap != NULL && sprite->visible &&
+                ssd1306_sprites_bounds(sprite, &rect))
+            ssd1306_sprites_add_area(areas, &num_areas, rect);
+    }
+
+    if (num_areas == 0) return SSD1306_OK;
+
+    // Areas are redrawn without affecting the drawing state.
+    uint8_t x_pos = ssd1306_ptr->x_pos, y_pos = ssd1306_ptr->y_pos;
+    int16_t origin_x = ssd1306_ptr->origin_x, origin_y = ssd1306_ptr->origin_y;
+    uint8_t clip[4] = {
+        ssd1306_ptr->clip_x0, ssd1306_ptr->clip_y0,
+        ssd1306_ptr->clip_x1, ssd1306_ptr->clip_y1
+    };
+    ssd1306_text_mode_t text_mode = ssd1306_ptr->text_mode;
+    ssd1306_rop_t rop = ssd1306_ptr->rop;
+
+    for (uint8_t i = 0; i < num_areas && status == SSD1306_OK; i++)
+        status = ssd1306_sprites_redraw(sprites_ptr, &areas[i]);
+
+    ssd1306_ptr->x_pos     = x_pos;
+    ssd1306_ptr->y_pos     = y_pos;
+    ssd1306_ptr->origin_x  = origin_x;
+    ssd1306_ptr->origin_y  = origin_y;
+    ssd1306_ptr->clip_x0   = clip[0];
+    ssd1306_ptr->clip_y0   = clip[1];
+    ssd1306_ptr->clip_x1   = clip[2];
+    ssd1306_ptr->clip_y1   = clip[3];
+    ssd1306_ptr->text_mode = text_mode;
+    ssd1306_ptr->rop       = rop;
+    if (status != SSD1306_OK) return status;
+
+    for (uint8_t id = 0; id < SSD1306_SPRITES_MAX; id++) {
+        ssd1306_sprite_t *sprite = &sprites_ptr->sprites[id];
+
+        if (!sprite->changed) continue;
+
+        sprite->changed = false;
+        sprite->drawn   = sprite->bitmap != NULL && sprite->visible &&
+                ssd1306_sprites_bounds(sprite, &rect);
+        if (sprite->drawn) {
+            sprite->drawn_x0 = (uint8_t)rect.x0;
+            sprite->drawn_y0 = (uint8_t)rect.y0;
+            sprite->drawn_x1 = (uint8_t)rect.x1;
+            sprite->drawn_y1 = (uint8_t)rect.y1;
+        }
+    }
+
+    return SSD1306_OK;
+}
+
+
+ssd1306_status_t
+ssd1306_sprites_flush(ssd1306_sprites_t *sprites_ptr) {
+
+    ssd1306_status_t status;
+
+    status = ssd1306_sprites_compose(sprites_ptr);
+    if (status != SSD1306_OK) return status;
+
+    return ssd1306_update_dirty(sprites_ptr->display);
+}
+
+#endif
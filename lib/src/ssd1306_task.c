@@ -0,0 +1,138 @@
+/**
+ * @file   ssd1306_task.c
+ * @brief  SSD1306 OLED display C library.
+ *
+ * @copyright
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  any later version.
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ *  GNU General Public License for more details.
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program. If not, see <http://www.gnu.org/licenses/>.
+ *
+ * @author Giovanni Scotti
+ */
+
+
+#include <string.h> // for memset.
+#include "ssd1306_task.h"
+
+
+#if defined(SSD1306_ENABLE_LOCKING) && !defined(SSD1306_ENABLE_PAGE_MODE)
+
+///////////////////////////////////////////////////////////
+///////////////////////////////////////////////////////////
+// PRIVATE FUNCTIONS
+///////////////////////////////////////////////////////////
+///////////////////////////////////////////////////////////
+
+/**
+ * Returns the slot of the given display.
+ *
+ * @param  task_ptr    a pointer to a ssd1306_task_t structure.
+ * @param  ssd1306_ptr a pointer to a ssd1306_t structure.
+ * @return the index of the slot, num_slots if the display is unknown.
+ */
+static uint8_t
+ssd1306_task_find(const ssd1306_task_t *task_ptr,
+        const ssd1306_t *ssd1306_ptr) {
+
+    uint8_t s = 0;
+
+    while (s < task_ptr->num_slots && task_ptr->slots[s].display != ssd1306_ptr)
+        s++;
+
+    return s;
+}
+
+
+///////////////////////////////////////////////////////////
+///////////////////////////////////////////////////////////
+// PUBLIC API
+///////////////////////////////////////////////////////////
+///////////////////////////////////////////////////////////
+
+ssd1306_status_t
+ssd1306_task_init(ssd1306_task_t *task_ptr, const ssd1306_task_ops_t *ops,
+        void *ops_ctx, uint32_t period, ssd1306_callback_t callback) {
+
+    if (task_ptr == NULL || ops == NULL || ops->wait == NULL ||
+            ops->signal == NULL || (period != 0 && ops->sleep == NULL))
+        return SSD1306_WRONG_PARAMS;
+
+    memset(task_ptr, 0, sizeof(ssd1306_task_t));
+    task_ptr->ops      = ops;
+    task_ptr->ops_ctx  = ops_ctx;
+    task_ptr->period   = period;
+    task_ptr->callback = callback;
+    return SSD1306_OK;
+}
+
+
+ssd1306_status_t
+ssd1306_task_add(ssd1306_task_t *task_ptr, ssd1306_t *ssd1306_ptr) {
+
+    if (ssd1306_ptr == NULL || ssd1306_ptr->initialized == false)
+        return SSD1306_NOINIT;
+    if (task_ptr->num_slots == SSD1306_TASK_MAX_DISPLAYS ||
+            ssd1306_task_find(task_ptr, ssd1306_ptr) != task_ptr->num_slots)
+        return SSD1306_WRONG_PARAMS;
+
+    ssd1306_task_slot_t *slot_ptr = &task_ptr->slots[task_ptr->num_slots];
+    slot_ptr->display     = ssd1306_ptr;
+    slot_ptr->requested   = false;
+    slot_ptr->last_status = SSD1306_OK;
+    task_ptr->num_slots++;
+
+    return SSD1306_OK;
+}
+
+
+ssd1306_status_t
+ssd1306_task_request(ssd1306_task_t *task_ptr, ssd1306_t *ssd1306_ptr) {
+
+    uint8_t s = ssd1306_task_find(task_ptr, ssd1306_ptr);
+    if (s == task_ptr->num_slots) return SSD1306_WRONG_PARAMS;
+
+    task_ptr->slots[s].requested = true;
+    task_ptr->ops->signal(task_ptr->ops_ctx);
+    return SSD1306_OK;
+}
+
+
+void
+ssd1306_task_step(ssd1306_task_t *task_ptr) {
+
+    task_ptr->ops->wait(task_ptr->ops_ctx);
+
+    for (uint8_t s = 0; s < task_ptr->num_slots; s++) {
+        ssd1306_task_slot_t *slot_ptr = &task_ptr->slots[s];
+        if (!slot_ptr->requested) continue;
+
+        // Cleared before the snapshot: a request made meanwhile may find
+        // its frame already sent, at the cost of an empty update.
+        slot_ptr->requested   = false;
+        slot_ptr->last_status = ssd1306_update_snapshot(slot_ptr->display,
+                task_ptr->snapshot);
+        if (task_ptr->callback != NULL)
+            task_ptr->callback(slot_ptr->last_status, slot_ptr->display);
+    }
+
+    // Requests made while sleeping are coalesced into the next round.
+    if (task_ptr->period != 0)
+        task_ptr->ops->sleep(task_ptr->ops_ctx, task_ptr->period);
+}
+
+
+void
+ssd1306_task_run(void *task_ptr) {
+
+    for (;;)
+        ssd1306_task_step((ssd1306_task_t *)task_ptr);
+}
+
+#endif
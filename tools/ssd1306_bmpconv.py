@@ -0,0 +1,143 @@
+#!/usr/bin/env python3
+"""
+@file   ssd1306_bmpconv.py
+@brief  SSD1306 OLED display C library.
+
+Bitmap converter. Reads a PBM image (plain P1 or raw P4, black pixels being
+the set ones) and prints a C array holding it in the layout of the display
+ram, as expected by ssd1306_draw_page_bitmap: (h + 7) / 8 pages of w bytes,
+the LSB of each byte being the top row of the page. With --rle, the pages
+are run-length encoded as expected by ssd1306_draw_rle_bitmap.
+
+Usage: python3 tools/ssd1306_bmpconv.py [--rle] [--name NAME] image.pbm
+
+@copyright
+ This program is free software: you can redistribute it and/or modify
+ it under the terms of the GNU General Public License as published by
+ the Free Software Foundation, either version 3 of the License, or
+ any later version.
+ This program is distributed in the hope that it will be useful,
+ but WITHOUT ANY WARRANTY; without even the implied warranty of
+ MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ GNU General Public License for more details.
+ You should have received a copy of the GNU General Public License
+ along with this program. If not, see <http://www.gnu.org/licenses/>.
+"""
+
+import argparse
+import os
+import re
+import sys
+
+
+MAX_LITERAL = 128 # Control bytes 0x00 to 0x7F.
+MAX_REPEAT  = 129 # Control bytes 0x80 to 0xFF.
+MIN_REPEAT  = 3   # Shorter repeats are cheaper as literals.
+
+
+def read_pbm(path):
+    """Returns the width, the height and the rows of pixels of an image."""
+    with open(path, "rb") as f:
+        data = f.read()
+    # Header: magic number, width and height, comments being allowed.
+    tokens, pos = [], 0
+    while len(tokens) < 3:
+        match = re.compile(rb"\s*(#[^\n]*\n\s*)*(\S+)").match(data, pos)
+        if match is None:
+            sys.exit("invalid PBM header in " + path)
+        tokens.append(match.group(2))
+        pos = match.end()
+    magic, width, height = tokens[0], int(tokens[1]), int(tokens[2])
+    if width > 255 or height > 255:
+        sys.exit("bitmaps cannot exceed 255x255 pixels")
+
+    if magic == b"P1":
+        bits = [int(b) for b in re.findall(rb"[01]", data[pos:])]
+        rows = [bits[r * width:(r + 1) * width] for r in range(height)]
+    elif magic == b"P4":
+        stride = (width + 7) // 8
+        raw = data[pos + 1:]
+        rows = [[(raw[r * stride + c // 8] >> (7 - c % 8)) & 1
+                 for c in range(width)] for r in range(height)]
+    else:
+        sys.exit("only P1 and P4 images are supported")
+
+    if len(rows) != height or any(len(row) != width for row in rows):
+        sys.exit("truncated PBM image " + path)
+    return width, height, rows
+
+
+def to_pages(width, height, rows):
+    """Converts rows of pixels into page-major bytes."""
+    data = []
+    for p in range((height + 7) // 8):
+        for col in range(width):
+            byte = 0
+            for bit in range(8):
+                row = p * 8 + bit
+                if row < height and rows[row][col]:
+                    byte |= 1 << bit
+            data.append(byte)
+    return data
+
+
+def rle(data):
+    """Run-length encodes page-major bytes."""
+    out, literal, i = [], [], 0
+
+    def flush_literal():
+        while literal:
+            chunk = literal[:MAX_LITERAL]
+            del literal[:MAX_LITERAL]
+            out.extend([len(chunk) - 1] + chunk)
+
+    while i < len(data):
+        n = 1
+        while i + n < len(data) and data[i + n] == data[i] and n < MAX_REPEAT:
+            n += 1
+        if n >= MIN_REPEAT:
+            flush_literal()
+            out.extend([n + 126, data[i]])
+        else:
+            literal.extend(data[i:i + n])
+        i += n
+    flush_literal()
+    return out
+
+
+def main():
+    parser = argparse.ArgumentParser()
+    parser.add_argument("image")
+    parser.add_argument("--rle", action="store_true",
+                        help="run-length encode the bitmap")
+    parser.add_argument("--name", help="name of the C array")
+    args = parser.parse_args()
+
+    width, height, rows = read_pbm(args.image)
+    data = to_pages(width, height, rows)
+    name = args.name or re.sub(r"\W", "_",
+                               os.path.splitext(os.path.basename(args.image))[0])
+
+    if args.rle:
+        encoded = rle(data)
+        print("/**")
+        print(" * %dx%d bitmap, run-length encoded (%d bytes, %d raw)."
+              % (width, height, len(encoded), len(data)))
+        print(" * Draw it by means of ssd1306_draw_rle_bitmap.")
+        print(" */")
+        data = encoded
+    else:
+        print("/**")
+        print(" * %dx%d bitmap, page-major (%d bytes)."
+              % (width, height, len(data)))
+        print(" * Draw it by means of ssd1306_draw_page_bitmap.")
+        print(" */")
+
+    print("static const uint8_t %s [] = {" % name)
+    for i in range(0, len(data), 16):
+        print(", ".join("0x%02X" % b for b in data[i:i + 16]) + ",")
+    print("};")
+
+
+if __name__ == "__main__":
+    main()
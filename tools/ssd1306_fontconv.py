@@ -0,0 +1,265 @@
+#!/usr/bin/env python3
+"""
+@file   ssd1306_fontconv.py
+@brief  SSD1306 OLED display C library.
+
+Font converter. Reads the row-major font maps found in ssd1306_fonts.c
+(one byte or half-word per glyph row, MSB is the leftmost pixel) and
+regenerates, in the same file, their column-major counterparts matching
+the layout of the display ram: each glyph is stored as consecutive pages
+of font_width bytes, the LSB of each byte being the top row of the page.
+Proportional variants are generated as well, together with the tables
+giving the width and the offset of each glyph.
+
+Each glyph is guarded by the glyph predicate of its font (for instance
+SSD1306_FONT_16X26_GLYPHS(c)), so that a firmware can link only the subset
+of glyphs it draws. Offsets and the index mapping each character to its
+dense position in the subset are computed by the compiler.
+
+Usage: python3 tools/ssd1306_fontconv.py [path/to/ssd1306_fonts.c]
+
+@copyright
+ This program is free software: you can redistribute it and/or modify
+ it under the terms of the GNU General Public License as published by
+ the Free Software Foundation, either version 3 of the License, or
+ any later version.
+ This program is distributed in the hope that it will be useful,
+ but WITHOUT ANY WARRANTY; without even the implied warranty of
+ MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ GNU General Public License for more details.
+ You should have received a copy of the GNU General Public License
+ along with this program. If not, see <http://www.gnu.org/licenses/>.
+"""
+
+import os
+import re
+import sys
+
+
+# Name, width, height, bits per row and enabling macro of each font.
+FONTS = [
+    ("7x10",   7, 10,  8, None),
+    ("11x18", 11, 18, 16, "ENABLE_FONT_11X18"),
+    ("16x26", 16, 26, 16, "ENABLE_FONT_16X26"),
+]
+
+# Proportional fonts derived from the fixed width ones: source font name,
+# generated font name and enabling macro. Empty columns are trimmed on both
+# sides of each glyph, then one blank column is appended as glyph spacing.
+PROPORTIONAL_FONTS = [
+    ("7x10", "7x10p", "ENABLE_FONT_7X10P"),
+]
+
+FIRST_CHAR = 32
+BEGIN_MARK = "// BEGIN OF GENERATED FONTS (tools/ssd1306_fontconv.py)"
+END_MARK   = "// END OF GENERATED FONTS"
+
+
+def parse_rows(source, name):
+    """Returns the list of row values of the given row-major font map."""
+    match = re.search(r"fontmap_%s\s*\[\]\s*=\s*\{(.*?)\};" % name,
+                      source, re.S)
+    if match is None:
+        sys.exit("fontmap_%s not found" % name)
+    body = re.sub(r"//[^\n]*", "", match.group(1))
+    return [int(v, 16) for v in re.findall(r"0x[0-9A-Fa-f]+", body)]
+
+
+def glyph_name(index):
+    ch = chr(FIRST_CHAR + index)
+    return "sp" if ch == " " else "'%s'" % ch
+
+
+def convert(rows, width, height, row_bits):
+    """Converts row-major glyphs into column-major pages."""
+    pages = (height + 7) // 8
+    glyphs = []
+    for g in range(len(rows) // height):
+        glyph_rows = rows[g * height:(g + 1) * height]
+        data = []
+        for p in range(pages):
+            for col in range(width):
+                byte = 0
+                for bit in range(8):
+                    row = p * 8 + bit
+                    if row < height and \
+                            (glyph_rows[row] >> (row_bits - 1 - col)) & 1:
+                        byte |= 1 << bit
+                data.append(byte)
+        glyphs.append(data)
+    return glyphs
+
+
+def trim(glyph, width, height):
+    """Trims empty columns of a column-major glyph, keeping one spacing
+    column. Returns the new width and the glyph data."""
+    pages = (height + 7) // 8
+    used = [c for c in range(width)
+            if any(glyph[p * width + c] for p in range(pages))]
+    if not used:
+        # Blank glyph (e.g. space): half of the fixed width.
+        return width // 2, [0] * (pages * (width // 2))
+    first, last = used[0], used[-1]
+    new_width = last - first + 2
+    data = []
+    for p in range(pages):
+        data += glyph[p * width + first:p * width + last + 1] + [0]
+    return new_width, data
+
+
+def per_line(items, count):
+    """Joins items, count per line."""
+    return [", ".join(items[i:i + count]) + ","
+            for i in range(0, len(items), count)]
+
+
+def glyph_lines(macro, index, data):
+    """Returns the lines of a glyph guarded by the glyph predicate."""
+    code = FIRST_CHAR + index
+    return ["#if FONT_HAS(%s, %d)" % (macro, code),
+            ", ".join("0x%02X" % b for b in data) +
+            ",  // " + glyph_name(index),
+            "#endif"]
+
+
+def generate_index(name, macro, count):
+    """Returns the sparse-to-dense index of a fixed width font, generated
+    only if its glyph predicate is defined."""
+    codes = [FIRST_CHAR + i for i in range(count)]
+    ranks = ["FONT_RANK_AFTER(%s, %d, %d)" % (macro, c, c - 1)
+             for c in codes[1:]]
+    out = [
+        "#ifdef SSD1306_FONT_%s_GLYPHS" % macro,
+        "",
+        "enum {",
+        "FONT_%s_RANK_%d = 0," % (macro, codes[0]),
+    ]
+    out += per_line(ranks, 3)
+    out += [
+        "};",
+        "",
+        "/**",
+        " * Index of each glyph of %s font in fontcols_%s." % (name, name),
+        " */",
+        "static const uint8_t fontindex_%s [] = {" % name,
+    ]
+    out += per_line(["FONT_RANK(%s, %d)" % (macro, c) for c in codes], 6)
+    out += [
+        "};",
+        "",
+        "#define FONT_%s_INDEX fontindex_%s" % (macro, name),
+        "",
+        "#else",
+        "#define SSD1306_FONT_%s_GLYPHS(c) 1" % macro,
+        "#define FONT_%s_INDEX NULL" % macro,
+        "#endif",
+        "",
+    ]
+    return out
+
+
+def generate_proportional(source, name, prop_name, macro):
+    width, height, row_bits = next((w, h, b) for n, w, h, b, _ in FONTS
+                                   if n == name)
+    glyphs = convert(parse_rows(source, name), width, height, row_bits)
+    font_macro = prop_name.upper()
+    out = ["#ifdef %s" % macro, ""]
+    out += [
+        "#ifndef SSD1306_FONT_%s_GLYPHS" % font_macro,
+        "#define SSD1306_FONT_%s_GLYPHS(c) 1" % font_macro,
+        "#endif",
+        "",
+        "/**",
+        " * Proportional encoding for %s font, generated from fontmap_%s."
+        % (name, name),
+        " * Each glyph is made of %d page(s) of as many bytes as its width."
+        % ((height + 7) // 8),
+        " */",
+        "static const uint8_t fontcols_%s [] = {" % prop_name,
+    ]
+    widths, sizes = [], []
+    for index, glyph in enumerate(glyphs):
+        glyph_width, data = trim(glyph, width, height)
+        widths.append(glyph_width)
+        sizes.append(len(data))
+        out += glyph_lines(font_macro, index, data)
+    out += ["};", ""]
+    out += [
+        "/**",
+        " * Width in pixels of each glyph of %s font, 0 if left out." %
+        prop_name,
+        " */",
+        "static const uint8_t fontwidths_%s [] = {" % prop_name,
+    ]
+    out += per_line(["FONT_WIDTH(%s, %d, %d)" % (font_macro, FIRST_CHAR + i, w)
+                     for i, w in enumerate(widths)], 6)
+    out += ["};", ""]
+    codes = [FIRST_CHAR + i for i in range(len(glyphs))]
+    offsets = ["FONT_OFFSET_AFTER(%s, %d, %d, %d)" %
+               (font_macro, c, c - 1, sizes[i]) for i, c in
+               enumerate(codes[1:])]
+    out += [
+        "enum {",
+        "FONT_%s_OFFSET_%d = 0," % (font_macro, codes[0]),
+    ]
+    out += per_line(offsets, 3)
+    out += [
+        "};",
+        "",
+        "/**",
+        " * Offset of each glyph of %s font in fontcols_%s." %
+        (prop_name, prop_name),
+        " */",
+        "static const uint16_t fontoffsets_%s [] = {" % prop_name,
+    ]
+    out += per_line(["FONT_%s_OFFSET_%d" % (font_macro, c) for c in codes], 6)
+    out += ["};", "", "#endif", ""]
+    return out
+
+
+def generate(source):
+    out = [BEGIN_MARK, ""]
+    for name, width, height, row_bits, macro in FONTS:
+        glyphs = convert(parse_rows(source, name), width, height, row_bits)
+        font_macro = name.upper()
+        if macro:
+            out += ["#ifdef %s" % macro, ""]
+        out += generate_index(name, font_macro, len(glyphs))
+        out += [
+            "/**",
+            " * Column-major encoding for %s font, generated from fontmap_%s."
+            % (name, name),
+            " * Each glyph is made of %d page(s) of %d bytes."
+            % ((height + 7) // 8, width),
+            " */",
+            "static const uint8_t fontcols_%s [] = {" % name,
+        ]
+        for index, data in enumerate(glyphs):
+            out += glyph_lines(font_macro, index, data)
+        out += ["};", ""]
+        if macro:
+            out += ["#endif", ""]
+    for name, prop_name, macro in PROPORTIONAL_FONTS:
+        out += generate_proportional(source, name, prop_name, macro)
+    out.append(END_MARK)
+    return "\n".join(out)
+
+
+def main():
+    path = sys.argv[1] if len(sys.argv) > 1 else os.path.join(
+        os.path.dirname(__file__), "..", "lib", "src", "ssd1306_fonts.c")
+    with open(path) as f:
+        source = f.read()
+
+    begin = source.find(BEGIN_MARK)
+    end = source.find(END_MARK)
+    if begin < 0 or end < 0:
+        sys.exit("generated section markers not found in " + path)
+
+    source = source[:begin] + generate(source) + source[end + len(END_MARK):]
+    with open(path, "w") as f:
+        f.write(source)
+
+
+if __name__ == "__main__":
+    main()